@@ -17,6 +17,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/dali.h>
+#include <cstring>
 
 // INTERNAL INCLUDES
 #include "shared/dali-demo-strings.h"
@@ -119,6 +120,15 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   demo.SortAlphabetically(true);
 
+  // With --virtualize the pages are created on demand, only the visible page and its neighbours exist
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i], "--virtualize") == 0)
+    {
+      demo.SetVirtualized(true);
+    }
+  }
+
   // Start the event loop
   app.MainLoop();
 
@@ -27,8 +27,13 @@
 #include <chipmunk/chipmunk.h>
 #include <dali/integration-api/string-utils.h>
 #include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <string>
 using Dali::Integration::GetStdString;
 using Dali::Integration::ToDaliString;
@@ -70,9 +75,113 @@ const cpBitmask COLLISION_MASK{0xfF};
 enum BenchmarkType
 {
   ANIMATION,
+  FRAME_CALLBACK,
   PHYSICS_2D,
 };
 
+/**
+ * @brief Moves all the balls on the update thread.
+ *
+ * Positions and velocities are kept in separate arrays (structure of arrays), so the
+ * integration loop can be vectorized; the results are written with the UpdateProxy.
+ * The balls bounce off the window edges without any event thread involvement.
+ */
+class BallFrameCallback : public FrameCallbackInterface
+{
+public:
+  BallFrameCallback()
+  : mHalfWidth(0.0f),
+    mHalfHeight(0.0f),
+    mUpdateCount(0u),
+    mTotalMicroseconds(0u)
+  {
+  }
+
+  /**
+   * @brief Adds a ball, must be called before the callback is added.
+   * @param[in] id The actor ID of the ball
+   * @param[in] position The initial position of the ball
+   * @param[in] velocity The velocity of the ball in pixels per second
+   */
+  void AddBall(uint32_t id, const Vector3& position, const Vector3& velocity)
+  {
+    mIds.push_back(id);
+    mPositionX.push_back(position.x);
+    mPositionY.push_back(position.y);
+    mVelocityX.push_back(velocity.x);
+    mVelocityY.push_back(velocity.y);
+  }
+
+  /**
+   * @brief Sets the area the balls bounce in, may be called while the callback is running.
+   * @param[in] size The window size
+   */
+  void SetBounds(Window::WindowSize size)
+  {
+    mHalfWidth  = static_cast<float>(size.GetWidth()) * 0.5f;
+    mHalfHeight = static_cast<float>(size.GetHeight()) * 0.5f;
+  }
+
+  /**
+   * @brief Returns the average update thread time spent moving the balls.
+   */
+  float GetAverageMicroseconds() const
+  {
+    uint32_t updateCount = mUpdateCount;
+    return updateCount ? static_cast<float>(mTotalMicroseconds) / updateCount : 0.0f;
+  }
+
+private:
+  bool Update(UpdateProxy& updateProxy, float elapsedSeconds) override
+  {
+    auto startTime = std::chrono::steady_clock::now();
+
+    const float margin(BALL_SIZE.width * 0.5f);
+    const float minX = margin - mHalfWidth;
+    const float maxX = mHalfWidth - margin;
+    const float minY = margin - mHalfHeight;
+    const float maxY = mHalfHeight - margin;
+
+    const uint32_t count = static_cast<uint32_t>(mIds.size());
+    float*         x     = mPositionX.data();
+    float*         y     = mPositionY.data();
+    float*         vx    = mVelocityX.data();
+    float*         vy    = mVelocityY.data();
+    for(uint32_t i = 0; i < count; ++i)
+    {
+      x[i] += vx[i] * elapsedSeconds;
+      y[i] += vy[i] * elapsedSeconds;
+
+      // Same reaction as the animation simulation: the velocity turns away from the wall that was hit
+      vx[i] = x[i] < minX ? fabsf(vx[i]) : (x[i] > maxX ? -fabsf(vx[i]) : vx[i]);
+      vy[i] = y[i] < minY ? fabsf(vy[i]) : (y[i] > maxY ? -fabsf(vy[i]) : vy[i]);
+    }
+
+    for(uint32_t i = 0; i < count; ++i)
+    {
+      updateProxy.SetPosition(mIds[i], Vector3(x[i], y[i], 0.0f));
+    }
+
+    ++mUpdateCount;
+    mTotalMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+    // Keep rendering while the balls are moving
+    return true;
+  }
+
+private:
+  std::vector<uint32_t> mIds;       ///< Actor IDs of the balls
+  std::vector<float>    mPositionX; ///< Ball positions relative to the window center
+  std::vector<float>    mPositionY;
+  std::vector<float>    mVelocityX; ///< Ball velocities in pixels per second
+  std::vector<float>    mVelocityY;
+
+  std::atomic<float>    mHalfWidth;         ///< Written on the event thread when the window is resized
+  std::atomic<float>    mHalfHeight;
+  std::atomic<uint32_t> mUpdateCount;       ///< Read on the event thread for the report
+  std::atomic<uint64_t> mTotalMicroseconds;
+};
+
 /**
  * @brief The physics demo using Chipmunk2D APIs.
  */
@@ -116,6 +225,12 @@ public:
         CreateAnimationSimulation();
         break;
       }
+      case BenchmarkType::FRAME_CALLBACK:
+      {
+        DALI_LOG_ERROR("CreateFrameCallbackSimulation\n");
+        CreateFrameCallbackSimulation();
+        break;
+      }
       case BenchmarkType::PHYSICS_2D:
       {
         DALI_LOG_ERROR("CreatePhysicsSimulation\n");
@@ -140,6 +255,15 @@ public:
         }
         mBallAnimations.clear();
 
+        mType = BenchmarkType::FRAME_CALLBACK;
+
+        CreateSimulation();
+        return true;
+      }
+      case BenchmarkType::FRAME_CALLBACK:
+      {
+        DestroyFrameCallbackSimulation();
+
         mType = BenchmarkType::PHYSICS_2D;
 
         CreateSimulation();
@@ -156,6 +280,7 @@ public:
 
   void OnTerminate(Application application)
   {
+    DestroyFrameCallbackSimulation();
     UnparentAndReset(mAnimationSimRootActor);
     UnparentAndReset(mPhysicsRoot);
   }
@@ -174,6 +299,14 @@ public:
         }
         break;
       }
+      case BenchmarkType::FRAME_CALLBACK:
+      {
+        if(mBallFrameCallback)
+        {
+          mBallFrameCallback->SetBounds(newSize);
+        }
+        break;
+      }
       case BenchmarkType::PHYSICS_2D:
       {
         if(mPhysicsAdaptor)
@@ -359,6 +492,71 @@ public:
     }
   }
 
+  // BenchmarkType::FRAME_CALLBACK
+
+  void CreateFrameCallbackSimulation()
+  {
+    DALI_LOG_RELEASE_INFO("Creating frame callback simulation with %d balls\n", mBallNumber);
+
+    PositionSize windowSize = mWindow.GetPositionSize();
+
+    mFrameCallbackSimRootActor = Layer::New();
+    DevelActor::SetResizePolicy(mFrameCallbackSimRootActor, ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+    mFrameCallbackSimRootActor[Actor::Property::PARENT_ORIGIN] = Dali::ParentOrigin::CENTER;
+    mFrameCallbackSimRootActor[Actor::Property::PIVOT]         = Dali::Pivot::CENTER;
+
+    mWindow.Add(mFrameCallbackSimRootActor);
+    std::ostringstream oss;
+    oss << "Frame callback simulation of " << mBallNumber << " balls";
+    auto title = Toolkit::TextLabel::New(ToDaliString(oss.str()));
+    mFrameCallbackSimRootActor.Add(title);
+    title[Toolkit::TextLabel::Property::TEXT_COLOR]           = Color::WHITE;
+    title[Actor::Property::PARENT_ORIGIN]                     = Dali::ParentOrigin::TOP_CENTER;
+    title[Actor::Property::PIVOT]                             = Dali::Pivot::TOP_CENTER;
+    title[Toolkit::TextLabel::Property::HORIZONTAL_ALIGNMENT] = HorizontalAlignment::CENTER;
+    DevelActor::SetResizePolicy(title, ResizePolicy::USE_NATURAL_SIZE, Dimension::ALL_DIMENSIONS);
+
+    mBallFrameCallback.reset(new BallFrameCallback());
+    mBallFrameCallback->SetBounds(Window::WindowSize(windowSize.width, windowSize.height));
+
+    const float margin(BALL_SIZE.width * 0.5f);
+    const int   width  = windowSize.width / 2;
+    const int   height = windowSize.height / 2;
+    for(int i = 0; i < mBallNumber; ++i)
+    {
+      Actor ball                           = Toolkit::ImageView::New(ToDaliString(BALL_IMAGES[rand() % 4]));
+      ball[Actor::Property::PARENT_ORIGIN] = Dali::ParentOrigin::CENTER;
+      ball[Actor::Property::PIVOT]         = Dali::Pivot::CENTER;
+      ball[Actor::Property::NAME]          = "Ball";
+      ball[Actor::Property::SIZE]          = BALL_SIZE; // Halve the image size
+      mFrameCallbackSimRootActor.Add(ball);
+
+      // Same speed range as the animation simulation
+      Vector3 position(Random::Range(margin - width, width - margin), Random::Range(margin - height, height - margin), 0.0f);
+      Vector3 velocity(Random::Range(-25.0f, 25.0f), Random::Range(-25.0f, 25.0f), 0.0f);
+      velocity.Normalize();
+      velocity = velocity * Random::Range(15.0f, 50.0f);
+
+      ball[Actor::Property::POSITION] = position;
+      mBallFrameCallback->AddBall(ball.GetProperty<int>(Actor::Property::ID), position, velocity);
+    }
+
+    title.RaiseToTop();
+
+    UiContext::Get().AddFrameCallback(*mBallFrameCallback, mFrameCallbackSimRootActor);
+  }
+
+  void DestroyFrameCallbackSimulation()
+  {
+    if(mBallFrameCallback)
+    {
+      UiContext::Get().RemoveFrameCallback(*mBallFrameCallback);
+      DALI_LOG_RELEASE_INFO("Frame callback simulation: %.1f us per update\n", mBallFrameCallback->GetAverageMicroseconds());
+      mBallFrameCallback.reset();
+    }
+    UnparentAndReset(mFrameCallbackSimRootActor);
+  }
+
   // BenchmarkType::PHYSICS_2D
 
   void CreatePhysicsSimulation()
@@ -479,6 +677,7 @@ private:
   Actor                     mPhysicsRoot;
   Layer                     mPhysicsDebugLayer;
   Layer                     mAnimationSimRootActor;
+  Layer                     mFrameCallbackSimRootActor;
   cpShape*                  mLeftBound{nullptr};
   cpShape*                  mRightBound{nullptr};
   cpShape*                  mTopBound{nullptr};
@@ -489,6 +688,8 @@ private:
   std::vector<Animation> mBallAnimations;
   int                    mBallNumber;
   Timer                  mTimer;
+
+  std::unique_ptr<BallFrameCallback> mBallFrameCallback;
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
@@ -500,13 +701,16 @@ int DALI_EXPORT_API main(int argc, char** argv)
   int numberOfBalls = DEFAULT_BALL_COUNT;
   int opt           = 0;
   optind            = 1;
-  while((opt = getopt(argc, argv, "ap")) != -1)
+  while((opt = getopt(argc, argv, "afp")) != -1)
   {
     switch(opt)
     {
       case 'a':
         startType = BenchmarkType::ANIMATION;
         break;
+      case 'f':
+        startType = BenchmarkType::FRAME_CALLBACK;
+        break;
       case 'p':
         startType = BenchmarkType::PHYSICS_2D;
         break;
@@ -515,7 +719,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
         numberOfBalls = atoi(optarg);
         break;
       default:
-        fprintf(stderr, "Usage: %s [-p][-a] [n-balls]\n", argv[0]);
+        fprintf(stderr, "Usage: %s [-p][-f][-a] [n-balls]\n", argv[0]);
         exit(1);
     }
   }
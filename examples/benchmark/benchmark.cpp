@@ -17,12 +17,19 @@
 
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/actors/actor-devel.h>
+#include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
+#include "generated/benchmark-batch-vert.h"
 #include "generated/benchmark-frag.h"
 #include "generated/benchmark-vert.h"
+#include "shared/column-recycler.h"
+#include "shared/static-batcher.h"
 #include "shared/utility.h"
 using Dali::Integration::GetStdString;
 using Dali::Integration::ToDaliString;
@@ -158,10 +165,17 @@ struct VertexWithTexture
 
 bool         gUseMesh(false);
 bool         gNinePatch(false);
+bool         gRecycle(false);
+bool         gBatch(false);
+bool         gAtlas(false);
+bool         gAsyncLoad(false);
 unsigned int gRowsPerPage(25);
 unsigned int gColumnsPerPage(25);
 unsigned int gPageCount(13);
 
+const unsigned int WIGGLE_INTERVAL(100u);    ///< Interval of moving a batched actor in milliseconds
+const unsigned int WIGGLE_REPORT_COUNT(10u); ///< Number of moves between the batch rebuild reports
+
 Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
 {
   Renderer    renderer   = Renderer::New(geometry, shader);
@@ -182,6 +196,10 @@ Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
 // -p NumberOfPages (Modifies the nimber of pages )
 // --use-mesh ( Use new renderer API (as ImageView) but shares renderers between actors when possible )
 // --nine-patch ( Use nine patch images )
+// --recycle ( Creates actors only for the visible columns plus a margin and rebinds them as the columns scroll in )
+// --batch ( Implies --use-mesh, bakes the actors into a batch per texture set, moving an actor rebuilds its batch )
+// --atlas ( Implies --use-mesh, packs the images into a few atlas textures, the actors of a page share a renderer )
+// --async-load ( Implies --use-mesh, decodes the images on worker threads, the actors show their image once it is uploaded )
 
 //
 class Benchmark : public ConnectionTracker
@@ -191,7 +209,11 @@ public:
   : mApplication(application),
     mRowsPerPage(gRowsPerPage),
     mColumnsPerPage(gColumnsPerPage),
-    mPageCount(gPageCount)
+    mPageCount(gPageCount),
+    mActorColumns(gColumnsPerPage * gPageCount),
+    mWiggleCount(0),
+    mRebuildCount(0),
+    mRebuildTime(0.0)
   {
     // Connect to the Application's Init signal
     mApplication.InitSignal().Connect(this, &Benchmark::Create);
@@ -217,6 +239,28 @@ public:
     // Respond to key events
     window.KeyEventSignal().Connect(this, &Benchmark::OnKeyEvent);
 
+    if(gRecycle)
+    {
+      // Only the visible columns and a margin on both sides have actors, all of them are moved by the scroll parent
+      mParent = Actor::New();
+      mParent.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+      window.Add(mParent);
+
+      mRecycler.Initialize(mParent, mSize.x, mColumnsPerPage, mColumnsPerPage * mPageCount, [this](unsigned int slot, unsigned int column) { RebindColumn(slot, column); });
+      mActorColumns = mRecycler.GetSlotCount();
+    }
+    else if(gBatch)
+    {
+      // The batches are built in the space of the parent, so only the parent is animated
+      mParent = Actor::New();
+      mParent.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+      window.Add(mParent);
+    }
+    else
+    {
+      mParent = window.GetRootLayer();
+    }
+
     if(gUseMesh)
     {
       CreateMeshActors();
@@ -226,6 +270,15 @@ public:
       CreateImageViews();
     }
 
+    if(gBatch)
+    {
+      CreateBatches();
+    }
+    else if(gUseMesh)
+    {
+      DALI_LOG_RELEASE_INFO("Benchmark: %zu actors, %zu draw calls\n", mActor.size(), mActor.size());
+    }
+
     ShowAnimation();
   }
 
@@ -243,8 +296,7 @@ public:
 
   void CreateImageViews()
   {
-    Window       window = mApplication.GetWindow();
-    unsigned int actorCount(mRowsPerPage * mColumnsPerPage * mPageCount);
+    unsigned int actorCount(mRowsPerPage * mActorColumns);
     mImageView.resize(actorCount);
 
     for(size_t i(0); i < actorCount; ++i)
@@ -252,33 +304,194 @@ public:
       mImageView[i] = ImageView::New(ImagePath(i));
       mImageView[i].SetProperty(Actor::Property::SIZE, Vector3(0.0f, 0.0f, 0.0f));
       Dali::DevelActor::SetResizePolicy(mImageView[i], ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS);
-      window.Add(mImageView[i]);
+      mParent.Add(mImageView[i]);
     }
   }
 
   void CreateMeshActors()
   {
     unsigned int numImages = !gNinePatch ? NUM_IMAGES : NUM_NINEPATCH_IMAGES;
+    auto         start     = std::chrono::steady_clock::now();
 
     //Create all the renderers
-    std::vector<Renderer> renderers(numImages);
-    Shader                shader   = Shader::New(ToDaliStringView(SHADER_BENCHMARK_VERT), ToDaliStringView(SHADER_BENCHMARK_FRAG));
-    Geometry              geometry = DemoHelper::CreateTexturedQuad();
-    for(unsigned int i(0); i < numImages; ++i)
+    Geometry geometry = DemoHelper::CreateTexturedQuad();
+    if(gAtlas)
     {
-      renderers[i] = CreateRenderer(i, geometry, shader);
+      std::vector<std::string> imagePaths;
+      for(unsigned int i(0); i < numImages; ++i)
+      {
+        imagePaths.push_back(ImagePath(i));
+      }
+      mAtlas = DemoHelper::LoadTextureAtlas(imagePaths);
+
+      // A renderer per atlas page, the actors select their image with uAtlasRect
+      std::string vertexShader(SHADER_BENCHMARK_VERT);
+      vertexShader  = "#define ATLAS\n" + vertexShader;
+      Shader shader = Shader::New(ToDaliStringView(vertexShader), ToDaliStringView(SHADER_BENCHMARK_FRAG));
+      for(Texture& page : mAtlas.pages)
+      {
+        TextureSet textureSet = TextureSet::New();
+        textureSet.SetTexture(0u, page);
+        mRenderers.push_back(Renderer::New(geometry, shader));
+        mRenderers.back().SetTextures(textureSet);
+        mRenderers.back().SetProperty(Renderer::Property::BLEND_MODE, BlendMode::OFF);
+      }
+
+      std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+      DALI_LOG_RELEASE_INFO("Benchmark: %u images (%zu KB) packed into %zu textures (%zu KB) in %.2f ms\n", numImages, mAtlas.imageBytes / 1024u, mAtlas.pages.size(), mAtlas.pageBytes / 1024u, duration.count());
+    }
+    else if(gAsyncLoad)
+    {
+      // The renderers get their textures as the workers finish, the event thread only waits for the uploads
+      mLoader = std::unique_ptr<DemoHelper::AsyncTextureLoader>(new DemoHelper::AsyncTextureLoader());
+      mRenderers.resize(numImages);
+      Shader shader = Shader::New(ToDaliStringView(SHADER_BENCHMARK_VERT), ToDaliStringView(SHADER_BENCHMARK_FRAG));
+      for(unsigned int i(0); i < numImages; ++i)
+      {
+        TextureSet textureSet = TextureSet::New();
+        mRenderers[i]         = Renderer::New(geometry, shader);
+        mRenderers[i].SetTextures(textureSet);
+        mRenderers[i].SetProperty(Renderer::Property::BLEND_MODE, BlendMode::OFF);
+        mLoader->LoadTexture(ImagePath(i), [this, textureSet, start](Texture texture) mutable
+        {
+          textureSet.SetTexture(0u, texture);
+          if(mLoader->GetPendingCount() == 0u)
+          {
+            std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+            DALI_LOG_RELEASE_INFO("Benchmark: %u images decoded on worker threads, all textures ready in %.2f ms\n", mLoader->GetDecodeCount(), duration.count());
+          }
+        });
+      }
+
+      std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+      DALI_LOG_RELEASE_INFO("Benchmark: %u images requested in %.2f ms\n", numImages, duration.count());
+    }
+    else
+    {
+      mRenderers.resize(numImages);
+      Shader shader = Shader::New(ToDaliStringView(SHADER_BENCHMARK_VERT), ToDaliStringView(SHADER_BENCHMARK_FRAG));
+      for(unsigned int i(0); i < numImages; ++i)
+      {
+        mRenderers[i] = CreateRenderer(i, geometry, shader);
+      }
+
+      std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+      DALI_LOG_RELEASE_INFO("Benchmark: %u images loaded into separate textures in %.2f ms\n", numImages, duration.count());
     }
 
     //Create the actors
-    Window       window = mApplication.GetWindow();
-    unsigned int actorCount(mRowsPerPage * mColumnsPerPage * mPageCount);
+    unsigned int actorCount(mRowsPerPage * mActorColumns);
     mActor.resize(actorCount);
     for(size_t i(0); i < actorCount; ++i)
     {
       mActor[i] = Actor::New();
-      mActor[i].AddRenderer(renderers[i % numImages]);
+      BindImage(mActor[i], i);
       mActor[i].SetProperty(Actor::Property::SIZE, Vector3(0.0f, 0.0f, 0.0f));
-      window.Add(mActor[i]);
+      mParent.Add(mActor[i]);
+    }
+  }
+
+  /**
+   * Sets the renderer showing the given image to the mesh actor
+   */
+  void BindImage(Actor& actor, unsigned int imageIndex)
+  {
+    if(actor.GetRendererCount() > 0u)
+    {
+      actor.RemoveRenderer(0u);
+    }
+
+    if(gAtlas)
+    {
+      // Images left out of the atlas are not shown
+      const DemoHelper::AtlasRegion& region = mAtlas.regions[imageIndex % mAtlas.regions.size()];
+      if(region.page != DemoHelper::AtlasRegion::INVALID_PAGE)
+      {
+        actor.AddRenderer(mRenderers[region.page]);
+        actor.RegisterProperty("uAtlasRect", region.textureRect);
+      }
+    }
+    else
+    {
+      actor.AddRenderer(mRenderers[imageIndex % mRenderers.size()]);
+    }
+  }
+
+  /**
+   * Places the mesh actors in the grid and bakes them into the batches
+   */
+  void CreateBatches()
+  {
+    size_t count(0);
+    for(size_t i(0); i < mActorColumns; ++i)
+    {
+      for(size_t j(0); j < mRowsPerPage; ++j)
+      {
+        mActor[count].SetProperty(Actor::Property::POSITION, Vector3(mSize.x * i + mSize.x * 0.5f, mSize.y * j + mSize.y * 0.5f, 0.0f));
+        mActor[count].SetProperty(Actor::Property::SIZE, mSize);
+        ++count;
+      }
+    }
+
+    Shader batchShader = Shader::New(ToDaliStringView(SHADER_BENCHMARK_BATCH_VERT), ToDaliStringView(SHADER_BENCHMARK_FRAG));
+    auto   start       = std::chrono::steady_clock::now();
+    mBatcher           = std::unique_ptr<DemoHelper::StaticBatcher>(new DemoHelper::StaticBatcher(mParent, mRenderers[0].GetGeometry(), batchShader));
+    mBatcher->AddSubtree(mParent);
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+    DALI_LOG_RELEASE_INFO("Benchmark: %u actors, %u draw calls, batched in %.2f ms\n", mBatcher->GetMemberCount(), mBatcher->GetBatchCount(), duration.count());
+
+    mWiggleTimer = Timer::New(WIGGLE_INTERVAL);
+    mWiggleTimer.TickSignal().Connect(this, &Benchmark::OnWiggleTick);
+  }
+
+  /**
+   * Moves a batched actor back to its place and another one off its place, then rebuilds their batches
+   */
+  bool OnWiggleTick()
+  {
+    if(mWiggled)
+    {
+      mWiggled.SetProperty(Actor::Property::POSITION_Y, mWiggled.GetProperty<float>(Actor::Property::POSITION_Y) - mSize.y * 0.25f);
+    }
+    mWiggled = mActor[(mWiggleCount * 7919u) % mActor.size()];
+    mWiggled.SetProperty(Actor::Property::POSITION_Y, mWiggled.GetProperty<float>(Actor::Property::POSITION_Y) + mSize.y * 0.25f);
+
+    auto     start   = std::chrono::steady_clock::now();
+    uint32_t rebuilt = mBatcher->Update();
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+    mRebuildCount += rebuilt;
+    mRebuildTime += duration.count();
+    if(++mWiggleCount % WIGGLE_REPORT_COUNT == 0u)
+    {
+      DALI_LOG_RELEASE_INFO("Benchmark: %u batch rebuilds, %.2f ms per update\n", mRebuildCount, mRebuildTime / WIGGLE_REPORT_COUNT);
+      mRebuildCount = 0u;
+      mRebuildTime  = 0.0;
+    }
+    return true;
+  }
+
+  /**
+   * Moves the actors of the given slot to another column of the grid and binds the images of that column
+   */
+  void RebindColumn(unsigned int slot, unsigned int column)
+  {
+    for(unsigned int row(0); row < mRowsPerPage; ++row)
+    {
+      const unsigned int actorIndex = slot * mRowsPerPage + row;
+      const unsigned int gridIndex  = column * mRowsPerPage + row;
+      const float        xpos       = mSize.x * column + mSize.x * 0.5f;
+      if(gUseMesh)
+      {
+        mActor[actorIndex].SetProperty(Actor::Property::POSITION_X, xpos);
+        BindImage(mActor[actorIndex], gridIndex);
+      }
+      else
+      {
+        mImageView[actorIndex].SetProperty(Actor::Property::POSITION_X, xpos);
+        mImageView[actorIndex].SetImage(ImagePath(gridIndex));
+      }
     }
   }
 
@@ -286,6 +499,10 @@ public:
   {
     if(source == mShow)
     {
+      if(mWiggleTimer)
+      {
+        mWiggleTimer.Start();
+      }
       ScrollAnimation();
     }
     else if(source == mScroll)
@@ -304,7 +521,7 @@ public:
     const Vector2 windowSize(Vector2(window.GetPositionSize().width, window.GetPositionSize().height));
     Vector3       initialPosition(windowSize.width * 0.5f, windowSize.height * 0.5f, 1000.0f);
 
-    unsigned int totalColumns = mColumnsPerPage * mPageCount;
+    unsigned int totalColumns = mActorColumns;
 
     size_t count(0);
     float  xpos, ypos;
@@ -315,6 +532,18 @@ public:
 
     mShow = Animation::New(totalDuration);
 
+    if(gBatch)
+    {
+      // The batched actors can't be animated one by one, the whole grid flies in
+      mParent.SetProperty(Actor::Property::POSITION_Z, initialPosition.z);
+      mParent.SetProperty(Actor::Property::SCALE, Vector3::ZERO);
+      mShow.AnimateTo(Property(mParent, Actor::Property::POSITION_Z), 0.0f, AlphaFunction::EASE_OUT_BACK, TimePeriod(0.0f, totalDuration * 0.5f));
+      mShow.AnimateTo(Property(mParent, Actor::Property::SCALE), Vector3::ONE, AlphaFunction::EASE_OUT_BACK, TimePeriod(0.0f, totalDuration * 0.5f));
+      mShow.Play();
+      mShow.FinishedSignal().Connect(this, &Benchmark::OnAnimationEnd);
+      return;
+    }
+
     for(size_t i(0); i < totalColumns; ++i)
     {
       xpos = mSize.x * i;
@@ -359,6 +588,19 @@ public:
     Vector3 windowSize(Vector2(window.GetPositionSize().width, window.GetPositionSize().height));
 
     mScroll = Animation::New(10.0f);
+
+    if(gRecycle || gBatch)
+    {
+      // Same movement as below, but only the parent of the recycled or batched actors moves
+      mScroll.AnimateBy(Property(mParent, Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(0.0f, 3.0f));
+      mScroll.AnimateBy(Property(mParent, Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(3.0f, 3.0f));
+      mScroll.AnimateBy(Property(mParent, Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(6.0f, 2.0f));
+      mScroll.AnimateBy(Property(mParent, Actor::Property::POSITION), Vector3(12.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(8.0f, 2.0f));
+      mScroll.Play();
+      mScroll.FinishedSignal().Connect(this, &Benchmark::OnAnimationEnd);
+      return;
+    }
+
     size_t actorCount(static_cast<size_t>(mRowsPerPage) * mColumnsPerPage * mPageCount);
     for(size_t i(0); i < actorCount; ++i)
     {
@@ -386,7 +628,7 @@ public:
     size_t       count(0);
     unsigned int actorsPerPage(mRowsPerPage * mColumnsPerPage);
 
-    unsigned int totalColumns = mColumnsPerPage * mPageCount;
+    unsigned int totalColumns = mActorColumns;
 
     float finalZ = mApplication.GetWindow().GetRenderTaskList().GetTask(0).GetCameraActor().GetCurrentProperty<Vector3>(Actor::Property::WORLD_POSITION).z;
     float totalDuration(5.0f);
@@ -395,6 +637,16 @@ public:
 
     mHide = Animation::New(totalDuration * 2.0f);
 
+    if(gBatch)
+    {
+      mWiggleTimer.Stop();
+      mHide.AnimateTo(Property(mParent, Actor::Property::ORIENTATION), Quaternion(Radian(Degree(70.0f)), Vector3::XAXIS), AlphaFunction::EASE_OUT, TimePeriod(0.0f, totalDuration));
+      mHide.AnimateBy(Property(mParent, Actor::Property::POSITION_Z), finalZ, AlphaFunction::EASE_OUT_BACK, TimePeriod(totalDuration, totalDuration));
+      mHide.Play();
+      mHide.FinishedSignal().Connect(this, &Benchmark::OnAnimationEnd);
+      return;
+    }
+
     for(size_t i(0); i < mRowsPerPage; ++i)
     {
       for(size_t j(0); j < totalColumns; ++j)
@@ -439,13 +691,28 @@ public:
 private:
   Application& mApplication;
 
-  std::vector<Actor>     mActor;
-  std::vector<ImageView> mImageView;
+  std::vector<Actor>       mActor;
+  std::vector<ImageView>   mImageView;
+  std::vector<Renderer>    mRenderers;
+  DemoHelper::TextureAtlas mAtlas; ///< Atlas of the images in the atlas mode
+
+  std::unique_ptr<DemoHelper::AsyncTextureLoader> mLoader; ///< Loads the images in the async load mode
+
+  Actor                      mParent;   ///< Parent of the actors, scrolled in the recycle mode
+  DemoHelper::ColumnRecycler mRecycler; ///< Hands the recycled actor columns to the columns scrolling in
 
   Vector3      mSize;
   unsigned int mRowsPerPage;
   unsigned int mColumnsPerPage;
   unsigned int mPageCount;
+  unsigned int mActorColumns; ///< Number of columns with actors
+
+  std::unique_ptr<DemoHelper::StaticBatcher> mBatcher;      ///< Batches of the mesh actors in the batch mode
+  Timer                                      mWiggleTimer;  ///< Moves a batched actor periodically
+  Actor                                      mWiggled;      ///< The batched actor moved off its place
+  unsigned int                               mWiggleCount;  ///< Number of moves
+  unsigned int                               mRebuildCount; ///< Number of batch rebuilds since the last report
+  double                                     mRebuildTime;  ///< Time spent in the updates since the last report in milliseconds
 
   Animation mShow;
   Animation mScroll;
@@ -454,6 +721,16 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  // Logs the frame rate in the batch mode, so the runs with and without --batch can be compared.
+  // The adaptor reads the environment when the application is created, before the options are parsed below.
+  for(int i(1); i < argc; ++i)
+  {
+    if(std::string(argv[i]).compare("--batch") == 0)
+    {
+      setenv("DALI_FPS_TRACKING", "5", 0);
+    }
+  }
+
   Application application = Application::New(&argc, &argv);
 
   for(int i(1); i < argc; ++i)
@@ -467,6 +744,22 @@ int DALI_EXPORT_API main(int argc, char** argv)
     {
       gNinePatch = true;
     }
+    else if(arg.compare("--recycle") == 0)
+    {
+      gRecycle = true;
+    }
+    else if(arg.compare("--batch") == 0)
+    {
+      gBatch = true;
+    }
+    else if(arg.compare("--atlas") == 0)
+    {
+      gAtlas = true;
+    }
+    else if(arg.compare("--async-load") == 0)
+    {
+      gAsyncLoad = true;
+    }
     else if(arg.compare(0, 2, "-r") == 0)
     {
       gRowsPerPage = atoi(arg.substr(2, arg.size()).c_str());
@@ -481,6 +774,18 @@ int DALI_EXPORT_API main(int argc, char** argv)
     }
   }
 
+  if(gAtlas || gAsyncLoad)
+  {
+    gUseMesh = true;
+  }
+
+  if(gBatch)
+  {
+    // Batching needs the shared renderers of the mesh actors, and every actor to exist
+    gUseMesh = true;
+    gRecycle = false;
+  }
+
   Benchmark test(application);
   application.MainLoop();
 
@@ -0,0 +1,17 @@
+//@version 100
+
+precision highp float;
+INPUT highp vec3 aPosition;
+INPUT mediump vec2 aTexCoord;
+UNIFORM_BLOCK VertBlock
+{
+  UNIFORM mediump mat4 uMvpMatrix;
+};
+OUTPUT mediump vec2 vTexCoord;
+
+void main()
+{
+  // The batched quads are already transformed to the space of the batch actor
+  gl_Position = uMvpMatrix * vec4(aPosition, 1.0);
+  vTexCoord = aTexCoord;
+}
@@ -7,6 +7,9 @@ UNIFORM_BLOCK VertBlock
 {
   UNIFORM mediump mat4 uMvpMatrix;
   UNIFORM mediump vec3 uSize;
+#ifdef ATLAS
+  UNIFORM mediump vec4 uAtlasRect;
+#endif
 };
 OUTPUT mediump vec2 vTexCoord;
 
@@ -14,5 +17,10 @@ void main()
 {
   vec4 position = vec4(aPosition,0.0,1.0)*vec4(uSize,1.0);
   gl_Position = uMvpMatrix * position;
+#ifdef ATLAS
+  // The image is a part of an atlas page
+  vTexCoord = uAtlasRect.xy + aTexCoord * uAtlasRect.zw;
+#else
   vTexCoord = aTexCoord;
+#endif
 }
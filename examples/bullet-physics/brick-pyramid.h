@@ -0,0 +1,92 @@
+#ifndef BULLET_BRICK_PYRAMID_H
+#define BULLET_BRICK_PYRAMID_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Layout of the brick pyramids shared by the demo and the headless world benchmark.
+ * Both worlds are in pixel units.
+ */
+namespace BrickPyramid
+{
+const int      ROWS(10);                      ///< Rows of a pyramid, the top row has a single brick
+const uint32_t BRICKS(ROWS * (ROWS + 1) / 2); ///< Bricks of a complete pyramid
+const float    BRICK_WIDTH(60.0f);
+const float    BRICK_HEIGHT(30.0f);
+const float    BRICK_DEPTH(30.0f);
+const float    BRICK_GAP(12.0f);
+const float    BRICK_MASS(1.0f);
+const float    SPACING_X(800.0f); ///< Distance between the centres of two pyramid columns of the grid
+const float    SPACING_Z(100.0f); ///< Distance between the centres of two pyramid rows of the grid
+
+/**
+ * Grid of pyramids holding a number of bricks, the last pyramid may be incomplete
+ */
+struct Grid
+{
+  uint32_t pyramids; ///< Number of pyramids
+  uint32_t columns;  ///< Pyramids per row of the grid
+  uint32_t rows;     ///< Rows of the grid
+};
+
+/**
+ * Calculates the smallest square-ish grid of pyramids holding the bricks
+ * @param[in] brickCount The number of bricks
+ * @return The grid
+ */
+inline Grid GetGrid(uint32_t brickCount)
+{
+  Grid grid;
+  grid.pyramids = (brickCount + BRICKS - 1u) / BRICKS;
+  grid.columns  = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(grid.pyramids))));
+  grid.rows     = grid.columns ? (grid.pyramids + grid.columns - 1u) / grid.columns : 0u;
+  return grid;
+}
+
+/**
+ * Calculates the centre of a pyramid of the grid, the grid is centred on the origin
+ * @param[in] grid The grid
+ * @param[in] pyramid The index of the pyramid
+ * @param[out] x The X coordinate of the centre
+ * @param[out] z The Z coordinate of the centre
+ */
+inline void GetPyramidCenter(const Grid& grid, uint32_t pyramid, float& x, float& z)
+{
+  x = (pyramid % grid.columns + 0.5f - grid.columns * 0.5f) * SPACING_X;
+  z = (pyramid / grid.columns + 0.5f - grid.rows * 0.5f) * SPACING_Z;
+}
+
+/**
+ * Calculates the centre of a brick relative to the centre of the bottom brick row of its pyramid
+ * @param[in] row The row of the brick, row 0 is at the top and row i has i + 1 bricks
+ * @param[in] brick The index of the brick within its row, from left to right
+ * @param[out] x The horizontal offset
+ * @param[out] height The height above the bottom row, upwards
+ */
+inline void GetBrickOffset(int row, int brick, float& x, float& height)
+{
+  const float rowWidth = (row + 1) * BRICK_WIDTH + row * BRICK_GAP;
+  x                    = rowWidth * -0.5f + BRICK_WIDTH * 0.5f + brick * (BRICK_WIDTH + BRICK_GAP);
+  height               = (ROWS - 1 - row) * (BRICK_HEIGHT + BRICK_GAP);
+}
+
+} // namespace BrickPyramid
+
+#endif // BULLET_BRICK_PYRAMID_H
@@ -21,15 +21,23 @@
 
 #include <dali/devel-api/adaptor-framework/key-devel.h>
 #include <dali/devel-api/events/hit-test-algorithm.h>
+#include <dali/integration-api/debug.h>
 #include <dali/integration-api/stream-operators.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <string>
 
 #include <btBulletDynamicsCommon.h>
 
 #include "ball-renderer.h"
+#include "brick-pyramid.h"
 #include "cube-renderer.h"
+#include "world-benchmark.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit::Physics;
@@ -55,11 +63,38 @@ const std::string BALL_IMAGE    = DEMO_IMAGE_DIR "/blocks-ball.png";
 const std::string BRICK_URIS[4] = {
   DEMO_IMAGE_DIR "/blocks-brick-1.png", DEMO_IMAGE_DIR "/blocks-brick-2.png", DEMO_IMAGE_DIR "/blocks-brick-3.png", DEMO_IMAGE_DIR "/blocks-brick-4.png"};
 
+const uint32_t MAX_BRICKS{5000u};
+const uint32_t STATISTICS_INTERVAL_MS{1000u};
+
+// Bullet's default thresholds are meant for meters, most bricks of the large scene would never sleep in pixel units
+const float LINEAR_SLEEPING_THRESHOLD{8.0f};
+const float ANGULAR_SLEEPING_THRESHOLD{1.0f};
+
 class PhysicsDemoController : public ConnectionTracker
 {
 public:
-  PhysicsDemoController(Application& app)
-  : mApplication(app)
+  struct Config
+  {
+    uint32_t brickCount{0u}; ///< Number of bricks of the large scene, 0 creates the single pyramid
+  };
+
+  /**
+   * Simulation statistics gathered by the internal tick callbacks of the world,
+   * guarded by the physics accessor lock
+   */
+  struct SimulationStatistics
+  {
+    std::chrono::steady_clock::time_point stepStart;
+    double                                stepTimeSum{0.0};
+    double                                maxStepTime{0.0};
+    uint32_t                              steps{0u};
+    uint64_t                              activeBodySum{0u};
+    uint32_t                              dynamicBodies{0u};
+  };
+
+  PhysicsDemoController(Application& app, const Config& config)
+  : mApplication(app),
+    mConfig(config)
   {
     app.InitSignal().Connect(this, &PhysicsDemoController::OnInit);
     app.TerminateSignal().Connect(this, &PhysicsDemoController::OnTerminate);
@@ -108,11 +143,95 @@ public:
     mSelectedActor = mBrick;
 
     CreateBall(scopedAccessor);
-    CreateBrickPyramid(scopedAccessor, Window::WindowSize(positionSize.width, positionSize.height));
+    if(mConfig.brickCount > 0u)
+    {
+      CreateLargeScene(scopedAccessor);
+    }
+    else
+    {
+      CreateBrickPyramid(scopedAccessor, Vector3::ZERO, BrickPyramid::BRICKS);
+    }
 
     mPhysicsAdaptor.CreateSyncPoint();
   }
 
+  /**
+   * Creates exactly the requested number of bricks in pyramids on a grid centred on the original
+   * pyramid, the last pyramid may be incomplete, and starts reporting the simulation statistics
+   */
+  void CreateLargeScene(PhysicsAdaptor::ScopedPhysicsAccessorPtr& scopedAccessor)
+  {
+    const BrickPyramid::Grid grid = BrickPyramid::GetGrid(mConfig.brickCount);
+    for(uint32_t i = 0; i < grid.pyramids; ++i)
+    {
+      float x, z;
+      BrickPyramid::GetPyramidCenter(grid, i, x, z);
+      CreateBrickPyramid(scopedAccessor, Vector3(x, 0.0f, z), mConfig.brickCount - i * BrickPyramid::BRICKS);
+    }
+
+    auto bulletWorld = scopedAccessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+    bulletWorld->setInternalTickCallback(&PhysicsDemoController::OnPreTick, &mStatistics, true);
+    bulletWorld->setInternalTickCallback(&PhysicsDemoController::OnPostTick, &mStatistics, false);
+
+    DALI_LOG_RELEASE_INFO("Bullet demo: %u bricks in %u pyramids\n", mConfig.brickCount, grid.pyramids);
+
+    mStatisticsTimer = Timer::New(STATISTICS_INTERVAL_MS);
+    mStatisticsTimer.TickSignal().Connect(this, &PhysicsDemoController::OnStatisticsTimer);
+    mStatisticsTimer.Start();
+  }
+
+  static void OnPreTick(btDynamicsWorld* world, btScalar timeStep)
+  {
+    auto* statistics      = static_cast<SimulationStatistics*>(world->getWorldUserInfo());
+    statistics->stepStart = std::chrono::steady_clock::now();
+  }
+
+  static void OnPostTick(btDynamicsWorld* world, btScalar timeStep)
+  {
+    auto*        statistics = static_cast<SimulationStatistics*>(world->getWorldUserInfo());
+    const double stepTime   = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - statistics->stepStart).count();
+
+    statistics->stepTimeSum += stepTime;
+    statistics->maxStepTime = std::max(statistics->maxStepTime, stepTime);
+    ++statistics->steps;
+
+    // Sleeping bodies keep their transforms, they are the ones the actor sync could skip
+    const btCollisionObjectArray& objects       = world->getCollisionObjectArray();
+    uint32_t                      activeBodies  = 0u;
+    uint32_t                      dynamicBodies = 0u;
+    for(int i = 0; i < objects.size(); ++i)
+    {
+      if(!objects[i]->isStaticOrKinematicObject())
+      {
+        ++dynamicBodies;
+        activeBodies += objects[i]->isActive() ? 1u : 0u;
+      }
+    }
+    statistics->activeBodySum += activeBodies;
+    statistics->dynamicBodies = dynamicBodies;
+  }
+
+  bool OnStatisticsTimer()
+  {
+    SimulationStatistics statistics;
+    {
+      auto scopedAccessor = mPhysicsAdaptor.GetPhysicsAccessor(); // Ensure we get a lock
+      statistics          = mStatistics;
+      mStatistics         = SimulationStatistics();
+    }
+
+    if(statistics.steps > 0u)
+    {
+      DALI_LOG_RELEASE_INFO("Bullet demo: %u steps, step avg: %.3f ms, max: %.3f ms, active bodies: %u / %u\n",
+                            statistics.steps,
+                            statistics.stepTimeSum / statistics.steps,
+                            statistics.maxStepTime,
+                            static_cast<uint32_t>(statistics.activeBodySum / statistics.steps),
+                            statistics.dynamicBodies);
+    }
+    return true;
+  }
+
   btRigidBody* CreateRigidBody(btDiscreteDynamicsWorld* bulletWorld, float mass, const btTransform& bulletTransform, btCollisionShape* shape)
   {
     bool      isDynamic = (mass != 0.0);
@@ -125,6 +244,10 @@ public:
     auto*                                    motionState = new btDefaultMotionState(bulletTransform);
     btRigidBody::btRigidBodyConstructionInfo rigidBodyConstructionInfo(mass, motionState, shape, localInertia);
     auto*                                    body = new btRigidBody(rigidBodyConstructionInfo);
+    if(mConfig.brickCount > 0u)
+    {
+      body->setSleepingThresholds(LINEAR_SLEEPING_THRESHOLD, ANGULAR_SLEEPING_THRESHOLD);
+    }
 
     bulletWorld->addRigidBody(body);
     return body;
@@ -132,7 +255,14 @@ public:
 
   void CreateGround(PhysicsAdaptor::ScopedPhysicsAccessorPtr& scopedAccessor, Dali::Window::WindowSize windowSize)
   {
-    Dali::Vector3 size(2 * windowSize.GetWidth(), 10.f, 2 * windowSize.GetWidth());
+    float groundWidth = 2 * windowSize.GetWidth();
+    if(mConfig.brickCount > 0u)
+    {
+      // Cover the whole pyramid grid of the large scene
+      const BrickPyramid::Grid grid = BrickPyramid::GetGrid(mConfig.brickCount);
+      groundWidth                   = std::max(groundWidth, 2.0f * (grid.columns + 1.0f) * BrickPyramid::SPACING_X);
+    }
+    Dali::Vector3 size(groundWidth, 10.f, groundWidth);
     Actor         groundActor = CubeRenderer::CreateActor(size, BRICK_WALL);
 
     auto physicsActor = CreateBrick(scopedAccessor, groundActor, 0.0f, 0.1f, 0.9f, size);
@@ -206,30 +336,33 @@ public:
     return physicsActor;
   }
 
-  void CreateBrickPyramid(PhysicsAdaptor::ScopedPhysicsAccessorPtr& scopedAccessor, Dali::Window::WindowSize windowSize)
+  /**
+   * Creates a pyramid from the top row down, with at most the given number of bricks
+   */
+  void CreateBrickPyramid(PhysicsAdaptor::ScopedPhysicsAccessorPtr& scopedAccessor, Vector3 offset, uint32_t maxBricks)
   {
-    const float BRICK_MASS       = 1.0f;
+    using namespace BrickPyramid;
     const float BRICK_ELASTICITY = 0.1f;
     const float BRICK_FRICTION   = 0.6f;
-    const int   BRICK_WIDTH      = 60;
-    const int   BRICK_HEIGHT     = 30;
-    const int   BRICK_DEPTH      = 30;
-    const int   BRICK_GAP        = 12;
+
+    // The y axis points down, the bottom row floats above the ground and drops onto it
+    const float   bottomY = -2.0f * (BRICK_HEIGHT + BRICK_GAP);
+    const Vector3 brickSize(BRICK_WIDTH, BRICK_HEIGHT, BRICK_DEPTH);
 
     Dali::Vector4 colors[5] = {Dali::Color::AQUA_MARINE, Dali::Color::DARK_SEA_GREEN, Dali::Color::BLUE_VIOLET, Dali::Color::MISTY_ROSE, Dali::Color::ORCHID};
 
-    int numberOfRows = 10;
-    int oY           = -(1 + numberOfRows) * (BRICK_HEIGHT + BRICK_GAP);
-    for(int i = 0; i < numberOfRows; ++i)
+    uint32_t created = 0u;
+    for(int i = 0; i < ROWS && created < maxBricks; ++i)
     {
-      int   w  = (i + 1) * BRICK_WIDTH + i * BRICK_GAP;
-      float oX = w * -0.5f;
-      for(int j = 0; j < i + 1; ++j)
+      for(int j = 0; j < i + 1 && created < maxBricks; ++j, ++created)
       {
-        auto brick        = CubeRenderer::CreateActor(Vector3(BRICK_WIDTH, BRICK_HEIGHT, BRICK_DEPTH), colors[(i + j) % 5]);
-        auto physicsActor = CreateBrick(scopedAccessor, brick, BRICK_MASS, BRICK_ELASTICITY, BRICK_FRICTION, Vector3(BRICK_WIDTH, BRICK_HEIGHT, BRICK_DEPTH));
+        float x, height;
+        GetBrickOffset(i, j, x, height);
+
+        auto brick        = CubeRenderer::CreateActor(brickSize, colors[(i + j) % 5]);
+        auto physicsActor = CreateBrick(scopedAccessor, brick, BRICK_MASS, BRICK_ELASTICITY, BRICK_FRICTION, brickSize);
 
-        physicsActor.AsyncSetPhysicsPosition(Vector3(oX + j * (BRICK_WIDTH + BRICK_GAP), oY + i * (BRICK_HEIGHT + BRICK_GAP), -300.0f));
+        physicsActor.AsyncSetPhysicsPosition(offset + Vector3(x, bottomY - height, -300.0f));
         // Create slight rotation offset to trigger automatic collapse
         auto axis = Vector3(Random::Range(-0.2f, 0.2f), // Roughly the z axis
                             Random::Range(-0.2f, 0.2f),
@@ -255,6 +388,14 @@ public:
 
   void OnTerminate(Application application)
   {
+    if(mStatisticsTimer)
+    {
+      mStatisticsTimer.Stop();
+      auto scopedAccessor = mPhysicsAdaptor.GetPhysicsAccessor();
+      auto bulletWorld    = scopedAccessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+      bulletWorld->setInternalTickCallback(nullptr, nullptr, true);
+      bulletWorld->setInternalTickCallback(nullptr, nullptr, false);
+    }
     UnparentAndReset(mPhysicsRoot);
   }
 
@@ -634,6 +775,10 @@ public:
 private:
   Application& mApplication;
   Window       mWindow;
+  Config       mConfig;
+
+  SimulationStatistics mStatistics;
+  Timer                mStatisticsTimer;
 
   Matrix         mPhysicsTransform;
   PhysicsAdaptor mPhysicsAdaptor;
@@ -656,8 +801,38 @@ private:
 
 int main(int argc, char** argv)
 {
+  PhysicsDemoController::Config config;
+  WorldBenchmarkOptions         benchmarkOptions;
+  bool                          benchmark = false;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strncmp(argv[i], "--bricks=", 9) == 0)
+    {
+      config.brickCount = std::min(static_cast<uint32_t>(std::max(atoi(argv[i] + 9), 1)), MAX_BRICKS);
+    }
+    else if(strcmp(argv[i], "--benchmark") == 0)
+    {
+      benchmark = true;
+    }
+    else if(strncmp(argv[i], "--threads=", 10) == 0)
+    {
+      benchmarkOptions.threads = static_cast<uint32_t>(std::max(atoi(argv[i] + 10), 1));
+    }
+  }
+
+  if(benchmark)
+  {
+    // Headless, the physics adaptor owns its world, so the multithreaded world is stepped directly
+    if(config.brickCount > 0u)
+    {
+      benchmarkOptions.bricks = config.brickCount;
+    }
+    RunWorldBenchmark(benchmarkOptions);
+    return 0;
+  }
+
   Application           application = Application::New(&argc, &argv);
-  PhysicsDemoController controller(application);
+  PhysicsDemoController controller(application, config);
   application.MainLoop();
   return 0;
 }
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "world-benchmark.h"
+#include "brick-pyramid.h"
+
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <LinearMath/btThreads.h>
+#include <btBulletDynamicsCommon.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+namespace
+{
+const btScalar TIME_STEP(1.0f / 60.0f);
+const btScalar GRAVITY(-200.0f); ///< Same as the demo, the world is in pixel units
+
+const btScalar GROUND_MARGIN(800.0f); ///< Room for the collapsing pyramids around the grid
+
+// Bullet's default thresholds are meant for meters, the bricks would never sleep in pixel units
+const btScalar LINEAR_SLEEPING_THRESHOLD(8.0f);
+const btScalar ANGULAR_SLEEPING_THRESHOLD(1.0f);
+
+/**
+ * Transforms copied out of the world every frame, as they would be written to the actors
+ */
+struct ActorTransforms
+{
+  std::vector<float> positionX;
+  std::vector<float> positionY;
+  std::vector<float> positionZ;
+  std::vector<float> orientation; ///< x, y, z, w for every body
+
+  void Resize(size_t count)
+  {
+    positionX.resize(count);
+    positionY.resize(count);
+    positionZ.resize(count);
+    orientation.resize(count * 4u);
+  }
+};
+
+/**
+ * Averages of a single thread count
+ */
+struct FrameTimes
+{
+  double   stepMs{0.0};
+  double   maxStepMs{0.0};
+  double   fullSyncMs{0.0};
+  double   activeSyncMs{0.0};
+  uint64_t activeBodies{0u};
+};
+
+/**
+ * The multithreaded world and everything it references, the world doesn't own any of it
+ */
+struct World
+{
+  btDefaultCollisionConfiguration* collisionConfiguration{nullptr};
+  btCollisionDispatcherMt*         dispatcher{nullptr};
+  btBroadphaseInterface*           broadphase{nullptr};
+  btConstraintSolverPoolMt*        solverPool{nullptr};
+  btDiscreteDynamicsWorldMt*       world{nullptr};
+  std::vector<btCollisionShape*>   shapes;
+  std::vector<btRigidBody*>        bricks;
+
+  World(uint32_t brickCount, int solverCount)
+  {
+    collisionConfiguration = new btDefaultCollisionConfiguration();
+    dispatcher             = new btCollisionDispatcherMt(collisionConfiguration);
+    broadphase             = new btDbvtBroadphase();
+    solverPool             = new btConstraintSolverPoolMt(solverCount);
+    world                  = new btDiscreteDynamicsWorldMt(dispatcher, broadphase, solverPool, nullptr, collisionConfiguration);
+    world->setGravity(btVector3(0.0f, GRAVITY, 0.0f));
+
+    using namespace BrickPyramid;
+    const Grid grid = GetGrid(brickCount);
+
+    btVector3         groundHalfExtents(grid.columns * SPACING_X * 0.5f + GROUND_MARGIN, 10.0f, grid.rows * SPACING_Z * 0.5f + GROUND_MARGIN);
+    btCollisionShape* groundShape = new btBoxShape(groundHalfExtents);
+    shapes.push_back(groundShape);
+    AddBody(0.0f, groundShape, btVector3(0.0f, -10.0f, 0.0f), btQuaternion::getIdentity());
+
+    btCollisionShape* brickShape = new btBoxShape(btVector3(BRICK_WIDTH * 0.5f, BRICK_HEIGHT * 0.5f, BRICK_DEPTH * 0.5f));
+    shapes.push_back(brickShape);
+
+    // Pyramids are laid out on a grid centered on the origin, the last one may be incomplete
+    for(uint32_t pyramid = 0; pyramid < grid.pyramids; ++pyramid)
+    {
+      float centerX, centerZ;
+      GetPyramidCenter(grid, pyramid, centerX, centerZ);
+      for(int i = 0; i < ROWS && bricks.size() < brickCount; ++i)
+      {
+        for(int j = 0; j < i + 1 && bricks.size() < brickCount; ++j)
+        {
+          float x, height;
+          GetBrickOffset(i, j, x, height);
+
+          // Slight rotation offset, as in the demo, to trigger the collapse
+          btVector3 axis(Random(-0.2f, 0.2f), Random(-0.2f, 0.2f), Random(0.8f, 1.2f));
+          bricks.push_back(AddBody(BRICK_MASS, brickShape, btVector3(centerX + x, BRICK_HEIGHT * 0.5f + height, centerZ), btQuaternion(axis.normalized(), Random(-0.3f, 0.3f))));
+        }
+      }
+    }
+  }
+
+  ~World()
+  {
+    for(int i = world->getNumCollisionObjects() - 1; i >= 0; --i)
+    {
+      btRigidBody* body = btRigidBody::upcast(world->getCollisionObjectArray()[i]);
+      world->removeRigidBody(body);
+      delete body->getMotionState();
+      delete body;
+    }
+    for(btCollisionShape* shape : shapes)
+    {
+      delete shape;
+    }
+    delete world;
+    delete solverPool;
+    delete broadphase;
+    delete dispatcher;
+    delete collisionConfiguration;
+  }
+
+  btRigidBody* AddBody(btScalar mass, btCollisionShape* shape, const btVector3& position, const btQuaternion& rotation)
+  {
+    btVector3 localInertia(0.0f, 0.0f, 0.0f);
+    if(mass != 0.0f)
+    {
+      shape->calculateLocalInertia(mass, localInertia);
+    }
+
+    auto*        motionState = new btDefaultMotionState(btTransform(rotation, position));
+    btRigidBody* body        = new btRigidBody(btRigidBody::btRigidBodyConstructionInfo(mass, motionState, shape, localInertia));
+    body->setSleepingThresholds(LINEAR_SLEEPING_THRESHOLD, ANGULAR_SLEEPING_THRESHOLD);
+    world->addRigidBody(body);
+    return body;
+  }
+
+  static btScalar Random(btScalar minimum, btScalar maximum)
+  {
+    return minimum + (maximum - minimum) * static_cast<btScalar>(rand()) / static_cast<btScalar>(RAND_MAX);
+  }
+};
+
+/**
+ * Copies the brick transforms, skipping the sleeping bricks unless all are requested
+ * @return The number of bricks copied
+ */
+uint32_t SyncTransforms(const std::vector<btRigidBody*>& bricks, ActorTransforms& transforms, bool all)
+{
+  uint32_t synced = 0u;
+  for(size_t i = 0; i < bricks.size(); ++i)
+  {
+    const btRigidBody* body = bricks[i];
+    if(!all && !body->isActive())
+    {
+      continue;
+    }
+
+    const btTransform& transform = body->getWorldTransform();
+    const btVector3&   origin    = transform.getOrigin();
+    const btQuaternion rotation  = transform.getRotation();
+
+    transforms.positionX[i]            = origin.x();
+    transforms.positionY[i]            = origin.y();
+    transforms.positionZ[i]            = origin.z();
+    transforms.orientation[i * 4u]     = rotation.x();
+    transforms.orientation[i * 4u + 1] = rotation.y();
+    transforms.orientation[i * 4u + 2] = rotation.z();
+    transforms.orientation[i * 4u + 3] = rotation.w();
+    ++synced;
+  }
+  return synced;
+}
+
+double ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Builds the world, steps it for the given number of frames and prints the per frame report lines
+ */
+FrameTimes MeasureWorld(const WorldBenchmarkOptions& options, int threads, int solverCount)
+{
+  srand(0); // Same collapse for every thread count
+  World           world(options.bricks, solverCount);
+  ActorTransforms transforms;
+  transforms.Resize(world.bricks.size());
+
+  FrameTimes times;
+  for(uint32_t frame = 0; frame < options.frames; ++frame)
+  {
+    auto start = std::chrono::steady_clock::now();
+    world.world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+    const double stepMs = ElapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    SyncTransforms(world.bricks, transforms, true);
+    const double fullSyncMs = ElapsedMs(start);
+
+    start                       = std::chrono::steady_clock::now();
+    const uint32_t activeBodies = SyncTransforms(world.bricks, transforms, false);
+    const double   activeSyncMs = ElapsedMs(start);
+
+    times.stepMs += stepMs;
+    times.maxStepMs = std::max(times.maxStepMs, stepMs);
+    times.fullSyncMs += fullSyncMs;
+    times.activeSyncMs += activeSyncMs;
+    times.activeBodies += activeBodies;
+
+    if(options.reportEvery && frame % options.reportEvery == 0u)
+    {
+      printf("%8d %8u %10.3f %12.3f %12.3f %8u\n", threads, frame, stepMs, fullSyncMs, activeSyncMs, activeBodies);
+      fflush(stdout);
+    }
+  }
+
+  times.stepMs /= options.frames;
+  times.fullSyncMs /= options.frames;
+  times.activeSyncMs /= options.frames;
+  times.activeBodies /= options.frames;
+  return times;
+}
+} // namespace
+
+void RunWorldBenchmark(const WorldBenchmarkOptions& options)
+{
+  // Without BT_THREADSAFE Bullet provides no threaded scheduler, the Mt world then runs sequentially
+  btITaskScheduler* scheduler = btCreateDefaultTaskScheduler();
+  if(!scheduler)
+  {
+    scheduler = btGetSequentialTaskScheduler();
+  }
+  btSetTaskScheduler(scheduler);
+
+  const int maxThreads = scheduler->getMaxNumThreads();
+  printf("%u bricks, %u frames, task scheduler: %s, max threads: %d\n", options.bricks, options.frames, scheduler->getName(), maxThreads);
+  printf("%8s %8s %10s %12s %12s %8s\n", "threads", "frame", "step (ms)", "sync (ms)", "active (ms)", "active");
+
+  std::vector<std::pair<int, FrameTimes>> results;
+  int                                     previousThreads = 0;
+  for(int threads = options.threads ? static_cast<int>(options.threads) : 1; threads <= maxThreads; threads *= 2)
+  {
+    // The scheduler clamps the thread count, the sweep stops once it no longer increases
+    scheduler->setNumThreads(threads);
+    const int actualThreads = scheduler->getNumThreads();
+    if(actualThreads == previousThreads)
+    {
+      break;
+    }
+    previousThreads = actualThreads;
+
+    results.emplace_back(actualThreads, MeasureWorld(options, actualThreads, maxThreads));
+    if(options.threads)
+    {
+      break;
+    }
+  }
+
+  printf("\n%8s %10s %10s %12s %12s %8s\n", "threads", "avg (ms)", "max (ms)", "sync (ms)", "active (ms)", "active");
+  for(const auto& result : results)
+  {
+    const FrameTimes& times = result.second;
+    printf("%8d %10.3f %10.3f %12.3f %12.3f %8u\n", result.first, times.stepMs, times.maxStepMs, times.fullSyncMs, times.activeSyncMs, static_cast<uint32_t>(times.activeBodies));
+  }
+  fflush(stdout);
+
+  btSetTaskScheduler(btGetSequentialTaskScheduler());
+  if(scheduler != btGetSequentialTaskScheduler())
+  {
+    delete scheduler;
+  }
+}
@@ -0,0 +1,43 @@
+#ifndef BULLET_WORLD_BENCHMARK_H
+#define BULLET_WORLD_BENCHMARK_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+
+/**
+ * Options of the headless multithreaded world benchmark
+ */
+struct WorldBenchmarkOptions
+{
+  uint32_t bricks{4000u};    ///< Number of bricks, split into pyramids of 55 bricks
+  uint32_t threads{0u};      ///< Task scheduler threads, 0 measures 1, 2, 4... up to the scheduler maximum
+  uint32_t frames{600u};     ///< Number of frames stepped for every thread count
+  uint32_t reportEvery{60u}; ///< Frames between the per frame report lines
+};
+
+/**
+ * Steps a btDiscreteDynamicsWorldMt full of brick pyramids without rendering. Every frame
+ * the body transforms are copied out as they would be for the actors, once for all bodies
+ * and once skipping the sleeping ones. The step time, both sync times and the active body
+ * count are printed while the pyramids collapse and settle, followed by the averages for
+ * every thread count.
+ * @param[in] options The benchmark options
+ */
+void RunWorldBenchmark(const WorldBenchmarkOptions& options);
+
+#endif // BULLET_WORLD_BENCHMARK_H
@@ -26,12 +26,17 @@
 #include <dali/integration-api/string-utils.h>
 
 #include <chipmunk/chipmunk.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <string>
 #include "letter-a.h"
 #include "letter-d.h"
 #include "letter-i.h"
 #include "letter-l.h"
+#include "space-benchmark.h"
 #include "split-letter-d.h"
 
 using Dali::Integration::ToDaliString;
@@ -45,6 +50,10 @@ Debug::Filter* gPhysicsDemo = Debug::Filter::New(Debug::Concise, false, "LOG_PHY
 
 const bool DEBUG_STATE{false};
 
+const float    DEFAULT_BALL_RADIUS{13.0f};
+const float    MIN_BALL_RADIUS{4.0f};
+const uint32_t MAX_BALLS{10000u};
+
 namespace KeyModifier
 {
 enum Key
@@ -131,8 +140,15 @@ static cpFloat SpringForce(cpConstraint* spring, cpFloat distance)
 class PhysicsDemoController : public ConnectionTracker
 {
 public:
-  PhysicsDemoController(Application& app)
-  : mApplication(app)
+  struct Config
+  {
+    uint32_t ballCount{0u};      ///< Number of balls, 0 sizes the count to the window area
+    bool     spatialHash{false}; ///< Whether the space uses a spatial hash tuned to the ball radius
+  };
+
+  PhysicsDemoController(Application& app, const Config& config)
+  : mApplication(app),
+    mConfig(config)
   {
     app.InitSignal().Connect(this, &PhysicsDemoController::OnInit);
     app.TerminateSignal().Connect(this, &PhysicsDemoController::OnTerminate);
@@ -175,7 +191,21 @@ public:
 
     // Ball area = 2*PI*26^2 ~= 6.28*26*26 ~= 5400
     // Fill top quarter of the screen...
-    uint32_t numBalls = 10u + static_cast<uint32_t>(windowSize.width) * static_cast<uint32_t>(windowSize.height) / 20000;
+    float    windowArea = static_cast<float>(windowSize.width) * static_cast<float>(windowSize.height);
+    uint32_t numBalls   = 10u + static_cast<uint32_t>(windowSize.width) * static_cast<uint32_t>(windowSize.height) / 20000;
+    if(mConfig.ballCount > 0u)
+    {
+      // Shrink the balls, so that large counts still fit into the quarter of the screen
+      numBalls    = mConfig.ballCount;
+      mBallRadius = std::clamp(std::sqrt(windowArea * 0.25f / (numBalls * Math::PI)), MIN_BALL_RADIUS, DEFAULT_BALL_RADIUS);
+    }
+
+    if(mConfig.spatialHash)
+    {
+      UseBallSpatialHash(space, mBallRadius, numBalls);
+    }
+    DALI_LOG_RELEASE_INFO("Physics demo: %u balls, radius: %.1f, spatial index: %s\n", numBalls, mBallRadius, mConfig.spatialHash ? "spatial hash" : "bounding box tree");
+
     for(uint32_t i = 0; i < numBalls; ++i)
     {
       mBalls.push_back(CreateBall(space));
@@ -200,13 +230,13 @@ public:
   PhysicsActor CreateBall(cpSpace* space)
   {
     const float BALL_MASS       = 10.0f;
-    const float BALL_RADIUS     = 13.0f;
+    const float BALL_RADIUS     = mBallRadius;
     const float BALL_ELASTICITY = 0.5f;
     const float BALL_FRICTION   = 0.5f;
 
     auto ball                   = Toolkit::ImageView::New(ToDaliString(BALL_IMAGES[rand() % 4]));
     ball[Actor::Property::NAME] = "Ball";
-    ball[Actor::Property::SIZE] = Vector2(26, 26); // Halve the image size
+    ball[Actor::Property::SIZE] = Vector2(BALL_RADIUS * 2.0f, BALL_RADIUS * 2.0f); // Halve the image size by default
     cpBody* body                = cpSpaceAddBody(space, cpBodyNew(BALL_MASS, cpMomentForCircle(BALL_MASS, 0.0f, BALL_RADIUS, cpvzero)));
 
     cpShape* shape = cpSpaceAddShape(space, cpCircleShapeNew(body, BALL_RADIUS, cpvzero));
@@ -683,6 +713,8 @@ public:
 private:
   Application& mApplication;
   Window       mWindow;
+  Config       mConfig;
+  float        mBallRadius{DEFAULT_BALL_RADIUS};
 
   PhysicsAdaptor            mPhysicsAdaptor;
   PhysicsActor              mSelectedActor;
@@ -708,8 +740,39 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  PhysicsDemoController::Config config;
+  SpaceBenchmarkOptions         benchmarkOptions;
+  bool                          benchmark = false;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strncmp(argv[i], "--balls=", 8) == 0)
+    {
+      config.ballCount = std::min(static_cast<uint32_t>(std::max(atoi(argv[i] + 8), 1)), MAX_BALLS);
+    }
+    else if(strcmp(argv[i], "--spatial-hash") == 0)
+    {
+      config.spatialHash = true;
+    }
+    else if(strcmp(argv[i], "--benchmark") == 0)
+    {
+      benchmark = true;
+    }
+    else if(strncmp(argv[i], "--threads=", 10) == 0)
+    {
+      benchmarkOptions.threads = static_cast<uint32_t>(std::max(atoi(argv[i] + 10), 1));
+    }
+  }
+
+  if(benchmark)
+  {
+    // Headless, the physics adaptor owns its space, so the threaded space is stepped directly
+    benchmarkOptions.maxBodies = config.ballCount ? std::max(config.ballCount, 1000u) : MAX_BALLS;
+    RunSpaceBenchmark(benchmarkOptions);
+    return 0;
+  }
+
   Application           application = Application::New(&argc, &argv);
-  PhysicsDemoController controller(application);
+  PhysicsDemoController controller(application, config);
   application.MainLoop();
   return 0;
 }
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "space-benchmark.h"
+
+#include <chipmunk/cpHastySpace.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace
+{
+const uint32_t MIN_BODIES(1000u);
+const cpFloat  BALL_RADIUS(6.0);
+const cpFloat  BALL_MASS(10.0);
+const cpFloat  FILL_RATIO(0.4); ///< Part of the world area covered by the balls
+const cpFloat  TIME_STEP(1.0 / 60.0);
+const uint32_t WARM_UP_STEPS(60u);   ///< Steps before measuring, lets the balls settle into contact
+const uint32_t MEASURED_STEPS(240u); ///< Steps measured for every configuration
+
+/**
+ * Result of a single benchmark configuration
+ */
+struct StepTimes
+{
+  double averageMs;
+  double maximumMs;
+};
+
+/**
+ * Creates a hasty space with a square box filled with balls, steps it and measures the step times
+ */
+StepTimes MeasureSpace(uint32_t bodyCount, uint32_t threads, bool spatialHash, uint32_t& actualThreads)
+{
+  cpSpace* space = cpHastySpaceNew();
+  cpHastySpaceSetThreads(space, threads);
+  actualThreads = static_cast<uint32_t>(cpHastySpaceGetThreads(space));
+
+  cpSpaceSetGravity(space, cpv(0.0, -100.0));
+  if(spatialHash)
+  {
+    UseBallSpatialHash(space, BALL_RADIUS, bodyCount);
+  }
+
+  std::vector<cpShape*> shapes;
+  std::vector<cpBody*>  bodies;
+
+  const cpFloat worldSize  = std::sqrt(bodyCount * CP_PI * BALL_RADIUS * BALL_RADIUS / FILL_RATIO);
+  const cpVect  corners[4] = {cpv(0.0, 0.0), cpv(worldSize, 0.0), cpv(worldSize, worldSize), cpv(0.0, worldSize)};
+  cpBody*       staticBody = cpSpaceGetStaticBody(space);
+  for(int i = 0; i < 4; ++i)
+  {
+    cpShape* wall = cpSpaceAddShape(space, cpSegmentShapeNew(staticBody, corners[i], corners[(i + 1) % 4], 0.0));
+    cpShapeSetElasticity(wall, 1.0);
+    cpShapeSetFriction(wall, 1.0);
+    shapes.push_back(wall);
+  }
+
+  // Jittered grid, so the balls don't start overlapping
+  const uint32_t columns = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(bodyCount))));
+  const cpFloat  spacing = worldSize / columns;
+  const cpFloat  jitter  = std::max(0.0, spacing * 0.5 - BALL_RADIUS);
+  for(uint32_t i = 0; i < bodyCount; ++i)
+  {
+    cpBody* body = cpSpaceAddBody(space, cpBodyNew(BALL_MASS, cpMomentForCircle(BALL_MASS, 0.0, BALL_RADIUS, cpvzero)));
+    cpVect  cell = cpv(((i % columns) + 0.5) * spacing, ((i / columns) + 0.5) * spacing);
+    cpBodySetPosition(body, cpvadd(cell, cpv(jitter * (2.0 * rand() / RAND_MAX - 1.0), jitter * (2.0 * rand() / RAND_MAX - 1.0))));
+
+    cpShape* shape = cpSpaceAddShape(space, cpCircleShapeNew(body, BALL_RADIUS, cpvzero));
+    cpShapeSetElasticity(shape, 0.5);
+    cpShapeSetFriction(shape, 0.5);
+
+    bodies.push_back(body);
+    shapes.push_back(shape);
+  }
+
+  for(uint32_t i = 0; i < WARM_UP_STEPS; ++i)
+  {
+    cpHastySpaceStep(space, TIME_STEP);
+  }
+
+  StepTimes times{0.0, 0.0};
+  for(uint32_t i = 0; i < MEASURED_STEPS; ++i)
+  {
+    auto start = std::chrono::steady_clock::now();
+    cpHastySpaceStep(space, TIME_STEP);
+    double stepMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    times.averageMs += stepMs;
+    times.maximumMs = std::max(times.maximumMs, stepMs);
+  }
+  times.averageMs /= MEASURED_STEPS;
+
+  // The space doesn't own its bodies and shapes
+  cpHastySpaceFree(space);
+  for(cpShape* shape : shapes)
+  {
+    cpShapeFree(shape);
+  }
+  for(cpBody* body : bodies)
+  {
+    cpBodyFree(body);
+  }
+  return times;
+}
+} // namespace
+
+void UseBallSpatialHash(cpSpace* space, cpFloat radius, uint32_t bodyCount)
+{
+  // Chipmunk recommends cells matching the shape size and about 10 times more cells than shapes
+  cpSpaceUseSpatialHash(space, 2.0 * radius, static_cast<int>(bodyCount * 10u));
+}
+
+void RunSpaceBenchmark(const SpaceBenchmarkOptions& options)
+{
+  std::vector<uint32_t> bodyCounts;
+  for(uint32_t count = MIN_BODIES; count < options.maxBodies; count *= 2u)
+  {
+    bodyCounts.push_back(count);
+  }
+  bodyCounts.push_back(options.maxBodies);
+
+  // cpHastySpace clamps the thread count, the sweep stops once it no longer increases
+  const uint32_t maxThreads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+
+  printf("%8s %8s %12s %10s %10s %12s\n", "bodies", "threads", "index", "avg (ms)", "max (ms)", "bodies/ms");
+  for(uint32_t bodyCount : bodyCounts)
+  {
+    for(int hash = 0; hash < (options.spatialHash ? 2 : 1); ++hash)
+    {
+      uint32_t previousThreads = 0u;
+      for(uint32_t threads = options.threads ? options.threads : 1u; threads <= maxThreads; threads *= 2u)
+      {
+        uint32_t  actualThreads = 0u;
+        StepTimes times         = MeasureSpace(bodyCount, threads, hash != 0, actualThreads);
+        if(actualThreads == previousThreads)
+        {
+          break;
+        }
+        previousThreads = actualThreads;
+
+        printf("%8u %8u %12s %10.3f %10.3f %12.1f\n", bodyCount, actualThreads, hash ? "spatial-hash" : "bb-tree", times.averageMs, times.maximumMs, bodyCount / times.averageMs);
+        fflush(stdout);
+      }
+    }
+  }
+}
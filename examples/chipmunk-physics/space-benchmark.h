@@ -0,0 +1,48 @@
+#ifndef CHIPMUNK_SPACE_BENCHMARK_H
+#define CHIPMUNK_SPACE_BENCHMARK_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chipmunk/chipmunk.h>
+#include <cstdint>
+
+/**
+ * Options of the headless solver benchmark
+ */
+struct SpaceBenchmarkOptions
+{
+  uint32_t maxBodies{10000u}; ///< The body count is doubled from 1000 up to this value
+  uint32_t threads{0u};       ///< Solver threads, 0 measures every thread count supported by cpHastySpace
+  bool     spatialHash{true}; ///< Whether to measure the spatial hash in addition to the default bounding box tree
+};
+
+/**
+ * Switches the space to a spatial hash tuned for balls of the given radius.
+ * @param[in] space The space
+ * @param[in] radius The radius of the balls
+ * @param[in] bodyCount The expected number of bodies
+ */
+void UseBallSpatialHash(cpSpace* space, cpFloat radius, uint32_t bodyCount);
+
+/**
+ * Steps a threaded cpHastySpace full of balls without rendering and prints the average
+ * and the maximum step time for every body count, thread count and spatial index.
+ * @param[in] options The benchmark options
+ */
+void RunSpaceBenchmark(const SpaceBenchmarkOptions& options);
+
+#endif // CHIPMUNK_SPACE_BENCHMARK_H
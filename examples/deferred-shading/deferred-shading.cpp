@@ -16,18 +16,25 @@
  */
 
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <memory>
 #include <random>
+#include <sstream>
+#include <string>
 #include "dali/dali.h"
 #include "dali/public-api/actors/actor.h"
 #include "dali/public-api/rendering/renderer.h"
 
+#include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
 #include "generated/deferred-shading-mainpass-frag.h"
 #include "generated/deferred-shading-mainpass-vert.h"
 #include "generated/deferred-shading-prepass-frag.h"
 #include "generated/deferred-shading-prepass-vert.h"
+#include "light-tile-culler.h"
 using Dali::Integration::GetStdString;
 using Dali::Integration::ToDaliString;
 using Dali::Integration::ToDaliStringView;
@@ -43,6 +50,14 @@ namespace
 // position, and normal), a Phong lighting model and 32 point lights.
 //
 // Invoked with the --show-lights it will render a mesh at each light position.
+//
+// Invoked with --tiled or --lights=N (up to 2048 lights) the lights are culled
+// per screen tile on the CPU every frame; the light data and the tile light
+// lists are passed to the lighting shader in float textures, so every pixel
+// only evaluates the lights overlapping its tile.
+//
+// Invoked with --benchmark it sweeps the number of tiled lights, logs the
+// CPU culling cost and the number of lights evaluated per pixel, then quits.
 //=============================================================================
 
 #define QUOTE(x) DALI_COMPOSE_SHADER(x)
@@ -51,6 +66,23 @@ namespace
 
 #define DEFINE_MAX_LIGHTS "const int kMaxLights = " QUOTE(MAX_LIGHTS) ";"
 
+// Width of the light data texture, the maximum texture size guaranteed by GLES 3.0.
+#define MAX_TILED_LIGHTS 2048
+
+constexpr uint32_t TILE_SIZE(32u);                   // size of a screen tile in pixels
+constexpr uint32_t MAX_TILE_LIGHTS(64u);             // maximum number of lights evaluated per tile
+constexpr uint32_t LIGHT_INDEX_TEXTURE_WIDTH(1024u); // width of the texture holding the tile light lists
+constexpr float    ATTENUATION_CUTOFF(1.f / 64.f);   // attenuation at which the tiled lights are cut off
+
+// Must match the attenuation constants of the lighting shader.
+constexpr float ATTENUATION_CONST(.05f);
+constexpr float ATTENUATION_LINEAR(.1f);
+constexpr float ATTENUATION_QUADRATIC(.15f);
+
+constexpr uint32_t BENCHMARK_LIGHT_COUNTS[] = {32u, 64u, 128u, 256u, 512u, 1024u, 2048u};
+constexpr uint32_t BENCHMARK_UPDATES_PER_STEP(120u); // light updates measured for every light count
+constexpr uint32_t UPDATE_INTERVAL_MS(16u);          // interval of the tiled light updates
+
 //=============================================================================
 // PRNG for floats.
 struct FloatRand
@@ -143,6 +175,48 @@ Vector3 FromHueSaturationLightness(Vector3 hsl)
   return rgb;
 }
 
+//=============================================================================
+// Lights are placed on eight rings around the Y axis, alternating above and below.
+void CreateLightPositions(uint32_t count, float unit, std::vector<Vector3>& positions, std::vector<Vector3>& colors)
+{
+  positions.resize(count);
+  colors.resize(count);
+
+  Vector3 lightPos{unit * 12.f, 0.f, 0.f};
+  float   theta    = M_PI * 2.f / count;
+  float   cosTheta = std::cos(theta);
+  float   sinTheta = std::sin(theta);
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    colors[i]    = FromHueSaturationLightness(Vector3((360.f * i) / count, .5f, 1.f));
+    positions[i] = lightPos * (1 + (i % 8)) / 8.f;
+
+    float z  = (((i & 1) << 1) - 1) * unit * 8.f;
+    lightPos = Vector3(cosTheta * lightPos.x - sinTheta * lightPos.y, sinTheta * lightPos.x + cosTheta * lightPos.y, z);
+  }
+}
+
+//=============================================================================
+// Distance at which the attenuation of a light drops to ATTENUATION_CUTOFF.
+float CalculateLightRange(float radius)
+{
+  // radius / (c + l * d + q * d^2) = cutoff
+  float c            = ATTENUATION_CONST - radius / ATTENUATION_CUTOFF;
+  float discriminant = ATTENUATION_LINEAR * ATTENUATION_LINEAR - 4.f * ATTENUATION_QUADRATIC * c;
+  return std::max(0.f, (std::sqrt(discriminant) - ATTENUATION_LINEAR) / (2.f * ATTENUATION_QUADRATIC));
+}
+
+//=============================================================================
+void UploadFloatTexture(Texture texture, const float* data, uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height)
+{
+  uint32_t size   = width * height * 3u * sizeof(float);
+  uint8_t* buffer = new uint8_t[size];
+  memcpy(buffer, data, size);
+
+  PixelData pixelData = PixelData::New(buffer, size, width, height, Pixel::RGB32F, PixelData::DELETE_ARRAY);
+  texture.Upload(pixelData, 0u, 0u, xOffset, yOffset, width, height);
+}
+
 //=============================================================================
 Geometry CreateTexturedQuadGeometry(bool flipV)
 {
@@ -328,12 +402,15 @@ public:
     {
       NONE        = 0x0,
       SHOW_LIGHTS = 0x1,
+      TILED       = 0x2,
+      BENCHMARK   = 0x4,
     };
   };
 
-  DeferredShadingExample(Application& app, uint32_t options = Options::NONE)
+  DeferredShadingExample(Application& app, uint32_t options = Options::NONE, uint32_t lightCount = MAX_LIGHTS)
   : mApp(app),
-    mOptions(options)
+    mOptions(options),
+    mLightCount(lightCount)
   {
     app.InitSignal().Connect(this, &DeferredShadingExample::Create);
     app.TerminateSignal().Connect(this, &DeferredShadingExample::Destroy);
@@ -469,7 +546,18 @@ private:
     finalImageTextures.SetSampler(1, sampler);
     finalImageTextures.SetSampler(2, sampler);
 
-    Shader   shdMain            = Shader::New(ToDaliStringView(SHADER_DEFERRED_SHADING_MAINPASS_VERT), ToDaliStringView(SHADER_DEFERRED_SHADING_MAINPASS_FRAG));
+    const bool  tiled = mOptions & Options::TILED;
+    std::string mainFragment(SHADER_DEFERRED_SHADING_MAINPASS_FRAG);
+    if(tiled)
+    {
+      std::ostringstream defines;
+      defines << "#define TILED_LIGHTING\n"
+              << "#define MAX_TILE_LIGHTS " << MAX_TILE_LIGHTS << "\n"
+              << "#define ATTENUATION_CUTOFF " << std::showpoint << ATTENUATION_CUTOFF << "\n";
+      mainFragment = defines.str() + mainFragment;
+    }
+
+    Shader   shdMain            = Shader::New(ToDaliStringView(SHADER_DEFERRED_SHADING_MAINPASS_VERT), ToDaliStringView(mainFragment));
     Geometry finalImageGeom     = CreateTexturedQuadGeometry(true);
     Renderer finalImageRenderer = CreateRenderer(finalImageTextures, finalImageGeom, shdMain);
     RegisterDepthProperties(depth, zNear, finalImageRenderer);
@@ -496,34 +584,43 @@ private:
 
     // Create Lights
     const bool showLights = mOptions & Options::SHOW_LIGHTS;
-    Renderer   lightRenderer;
     if(showLights)
     {
       Geometry lightMesh = CreateOctahedron(true);
-      lightRenderer      = CreateRenderer(noTexturesThanks, lightMesh, preShader, OPTION_DEPTH_TEST | OPTION_DEPTH_WRITE);
-      lightRenderer.SetProperty(Renderer::Property::FACE_CULLING_MODE, FaceCullingMode::FRONT);
+      mLightRenderer     = CreateRenderer(noTexturesThanks, lightMesh, preShader, OPTION_DEPTH_TEST | OPTION_DEPTH_WRITE);
+      mLightRenderer.SetProperty(Renderer::Property::FACE_CULLING_MODE, FaceCullingMode::FRONT);
     }
 
-    Vector3 lightPos{unit * 12.f, 0.f, 0.f};
-    float   theta    = M_PI * 2.f / MAX_LIGHTS;
-    float   cosTheta = std::cos(theta);
-    float   sinTheta = std::sin(theta);
-    for(int i = 0; i < MAX_LIGHTS; ++i)
+    mUnit = unit;
+    if(tiled)
     {
-      Vector3 color = FromHueSaturationLightness(Vector3((360.f * i) / MAX_LIGHTS, .5f, 1.f));
-
-      Actor light = CreateLight(lightPos * (1 + (i % 8)) / 8.f, unit * 16.f, color, camera, finalImageRenderer);
-
-      float z  = (((i & 1) << 1) - 1) * unit * 8.f;
-      lightPos = Vector3(cosTheta * lightPos.x - sinTheta * lightPos.y, sinTheta * lightPos.x + cosTheta * lightPos.y, z);
-
-      if(showLights)
+      mCamera             = camera;
+      mLights             = lights;
+      mFinalImageRenderer = finalImageRenderer;
+      mFinalImageTextures = finalImageTextures;
+      CreateTiledLighting(width, height, sampler);
+      CreateTiledLights(mOptions & Options::BENCHMARK ? BENCHMARK_LIGHT_COUNTS[0] : mLightCount);
+
+      mUpdateTimer = Timer::New(UPDATE_INTERVAL_MS);
+      mUpdateTimer.TickSignal().Connect(this, &DeferredShadingExample::OnUpdateTimer);
+      mUpdateTimer.Start();
+    }
+    else
+    {
+      std::vector<Vector3> positions;
+      std::vector<Vector3> colors;
+      CreateLightPositions(MAX_LIGHTS, unit, positions, colors);
+      for(int i = 0; i < MAX_LIGHTS; ++i)
       {
-        light.SetProperty(Actor::Property::SIZE, Vector3::ONE * unit / 8.f);
-        light.AddRenderer(lightRenderer);
+        Actor light = CreateLight(positions[i], unit * 16.f, colors[i], camera, finalImageRenderer);
+        if(showLights)
+        {
+          light.SetProperty(Actor::Property::SIZE, Vector3::ONE * unit / 8.f);
+          light.AddRenderer(mLightRenderer);
+        }
+
+        lights.Add(light);
       }
-
-      lights.Add(light);
     }
 
     // Take them for a spin.
@@ -542,6 +639,11 @@ private:
 
   void Destroy(Application app)
   {
+    if(mUpdateTimer)
+    {
+      mUpdateTimer.Stop();
+    }
+
     app.GetWindow().GetRenderTaskList().RemoveTask(mSceneRender);
     mSceneRender.Reset();
 
@@ -598,6 +700,176 @@ private:
     return light;
   }
 
+  void CreateTiledLighting(uint32_t width, uint32_t height, Sampler sampler)
+  {
+    uint32_t tileCountX = (width + TILE_SIZE - 1u) / TILE_SIZE;
+    uint32_t tileCountY = (height + TILE_SIZE - 1u) / TILE_SIZE;
+    mCuller.reset(new LightTileCuller(tileCountX, tileCountY, MAX_TILE_LIGHTS));
+
+    // The textures follow the G-buffer in the order the samplers are declared in the shader.
+    uint32_t indexRows = (mCuller->GetIndexCapacity() + LIGHT_INDEX_TEXTURE_WIDTH - 1u) / LIGHT_INDEX_TEXTURE_WIDTH;
+    mTileDataTexture   = Texture::New(TextureType::TEXTURE_2D, Pixel::RGB32F, tileCountX, tileCountY);
+    mLightIndexTexture = Texture::New(TextureType::TEXTURE_2D, Pixel::RGB32F, LIGHT_INDEX_TEXTURE_WIDTH, indexRows);
+    mFinalImageTextures.SetTexture(3, mTileDataTexture);
+    mFinalImageTextures.SetTexture(4, mLightIndexTexture);
+    for(uint32_t i = 3; i < 6; ++i)
+    {
+      mFinalImageTextures.SetSampler(i, sampler);
+    }
+
+    mFinalImageRenderer.RegisterProperty("uLightIndexTextureSize", Vector2(LIGHT_INDEX_TEXTURE_WIDTH, indexRows));
+    mLightRadiusIndex = mFinalImageRenderer.RegisterProperty("uLightRadius", 0.f);
+
+    mTileData.resize(tileCountX * tileCountY * 3u);
+    mLightIndexData.resize(indexRows * LIGHT_INDEX_TEXTURE_WIDTH * 3u);
+  }
+
+  void CreateTiledLights(uint32_t count)
+  {
+    mLightCount = count;
+
+    std::vector<Vector3> colors;
+    CreateLightPositions(count, mUnit, mLightPositions, colors);
+    mLightX.resize(count);
+    mLightY.resize(count);
+    mLightZ.resize(count);
+    mLightData.resize(count * 3u);
+
+    // Keep the total light energy of the 32 light scene.
+    mLightRadius = mUnit * 16.f * MAX_LIGHTS / count;
+    mLightRange  = CalculateLightRange(mLightRadius);
+    mFinalImageRenderer.SetProperty(mLightRadiusIndex, mLightRadius);
+
+    // View space positions are written to the first row every update, colors to the second row.
+    mLightDataTexture = Texture::New(TextureType::TEXTURE_2D, Pixel::RGB32F, count, 2u);
+    UploadFloatTexture(mLightDataTexture, colors[0].AsFloat(), 0u, 1u, count, 1u);
+    mFinalImageTextures.SetTexture(5, mLightDataTexture);
+
+    while(mLights.GetChildCount() > 0u)
+    {
+      mLights.Remove(mLights.GetChildAt(0u));
+    }
+
+    if(mOptions & Options::SHOW_LIGHTS)
+    {
+      for(auto& position : mLightPositions)
+      {
+        Actor light = Actor::New();
+        CenterActor(light);
+        light.SetProperty(Actor::Property::POSITION, position);
+        light.SetProperty(Actor::Property::SIZE, Vector3::ONE * mUnit / 8.f);
+        light.AddRenderer(mLightRenderer);
+        mLights.Add(light);
+      }
+    }
+  }
+
+  bool OnUpdateTimer()
+  {
+    UpdateTiledLights();
+    if(mOptions & Options::BENCHMARK)
+    {
+      UpdateBenchmark();
+    }
+    return true;
+  }
+
+  void UpdateTiledLights()
+  {
+    auto startTime = std::chrono::steady_clock::now();
+
+    // The lights only move with their parent, so their view space positions are derived
+    // from the parent matrix rather than read from every light actor.
+    Matrix lightsMatrix = mLights.GetCurrentProperty<Matrix>(Actor::Property::WORLD_MATRIX);
+    Matrix viewMatrix   = mCamera.GetCurrentProperty<Matrix>(CameraActor::Property::VIEW_MATRIX);
+    Matrix projection   = mCamera.GetCurrentProperty<Matrix>(CameraActor::Property::PROJECTION_MATRIX);
+    Matrix modelView;
+    Matrix::Multiply(modelView, lightsMatrix, viewMatrix);
+
+    const float* m = modelView.AsFloat();
+    for(uint32_t i = 0; i < mLightCount; ++i)
+    {
+      const Vector3& p = mLightPositions[i];
+      mLightX[i]       = m[0] * p.x + m[4] * p.y + m[8] * p.z + m[12];
+      mLightY[i]       = m[1] * p.x + m[5] * p.y + m[9] * p.z + m[13];
+      mLightZ[i]       = m[2] * p.x + m[6] * p.y + m[10] * p.z + m[14];
+    }
+
+    mCuller->Cull(projection.AsFloat(), mLightX.data(), mLightY.data(), mLightZ.data(), mLightCount, mLightRange);
+
+    auto cullTime = std::chrono::steady_clock::now();
+
+    // Pack the light positions and the tile lists into the textures.
+    for(uint32_t i = 0; i < mLightCount; ++i)
+    {
+      mLightData[i * 3u]      = mLightX[i];
+      mLightData[i * 3u + 1u] = mLightY[i];
+      mLightData[i * 3u + 2u] = mLightZ[i];
+    }
+    UploadFloatTexture(mLightDataTexture, mLightData.data(), 0u, 0u, mLightCount, 1u);
+
+    const std::vector<uint32_t>& offsets = mCuller->GetTileOffsets();
+    const std::vector<uint32_t>& counts  = mCuller->GetTileCounts();
+    for(uint32_t i = 0; i < offsets.size(); ++i)
+    {
+      mTileData[i * 3u]      = offsets[i];
+      mTileData[i * 3u + 1u] = counts[i];
+      mTileData[i * 3u + 2u] = 0.f;
+    }
+    UploadFloatTexture(mTileDataTexture, mTileData.data(), 0u, 0u, mTileDataTexture.GetWidth(), mTileDataTexture.GetHeight());
+
+    // Store the texture coordinate of each light, so the shader doesn't need to convert indices.
+    const std::vector<uint32_t>& indices    = mCuller->GetLightIndices();
+    uint32_t                     indexCount = mCuller->GetStatistics().indexCount;
+    if(indexCount > 0u)
+    {
+      uint32_t rows     = (indexCount + LIGHT_INDEX_TEXTURE_WIDTH - 1u) / LIGHT_INDEX_TEXTURE_WIDTH;
+      float    invCount = 1.f / mLightCount;
+      for(uint32_t i = 0; i < rows * LIGHT_INDEX_TEXTURE_WIDTH; ++i)
+      {
+        mLightIndexData[i * 3u] = i < indexCount ? (indices[i] + .5f) * invCount : 0.f;
+      }
+      UploadFloatTexture(mLightIndexTexture, mLightIndexData.data(), 0u, 0u, LIGHT_INDEX_TEXTURE_WIDTH, rows);
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    mCullingTime += std::chrono::duration<float, std::micro>(cullTime - startTime).count();
+    mUploadTime += std::chrono::duration<float, std::micro>(endTime - cullTime).count();
+    mLightsPerPixel += mCuller->GetStatistics().lightsPerPixel;
+    mDroppedIndices += mCuller->GetStatistics().droppedIndices;
+  }
+
+  void UpdateBenchmark()
+  {
+    if(++mBenchmarkUpdates < BENCHMARK_UPDATES_PER_STEP)
+    {
+      return;
+    }
+
+    float updates = static_cast<float>(mBenchmarkUpdates);
+    DALI_LOG_RELEASE_INFO("Tiled lighting, lights: %u, culling: %.1f us, upload: %.1f us, lights per pixel: %.2f, dropped per update: %.1f\n",
+                          mLightCount,
+                          mCullingTime / updates,
+                          mUploadTime / updates,
+                          mLightsPerPixel / updates,
+                          mDroppedIndices / updates);
+
+    mBenchmarkUpdates = 0u;
+    mCullingTime      = 0.f;
+    mUploadTime       = 0.f;
+    mLightsPerPixel   = 0.f;
+    mDroppedIndices   = 0.f;
+
+    if(++mBenchmarkStep < std::extent<decltype(BENCHMARK_LIGHT_COUNTS)>::value)
+    {
+      CreateTiledLights(BENCHMARK_LIGHT_COUNTS[mBenchmarkStep]);
+    }
+    else
+    {
+      mApp.Quit();
+    }
+  }
+
   void OnPan(Actor, PanGesture gesture)
   {
     Quaternion     q            = mAxis.GetProperty(Actor::Property::ORIENTATION).Get<Quaternion>();
@@ -629,22 +901,68 @@ private:
 
   int mNumLights = 0;
 
+  // Tiled lighting
+  uint32_t                         mLightCount;
+  float                            mUnit        = 0.f;
+  float                            mLightRadius = 0.f;
+  float                            mLightRange  = 0.f;
+  Property::Index                  mLightRadiusIndex{Property::INVALID_INDEX};
+  CameraActor                      mCamera;
+  Actor                            mLights;
+  Renderer                         mLightRenderer;
+  Renderer                         mFinalImageRenderer;
+  TextureSet                       mFinalImageTextures;
+  Texture                          mTileDataTexture;
+  Texture                          mLightIndexTexture;
+  Texture                          mLightDataTexture;
+  std::unique_ptr<LightTileCuller> mCuller;
+  std::vector<Vector3>             mLightPositions; // relative to mLights
+  std::vector<float>               mLightX;         // view space positions
+  std::vector<float>               mLightY;
+  std::vector<float>               mLightZ;
+  std::vector<float>               mLightData;
+  std::vector<float>               mTileData;
+  std::vector<float>               mLightIndexData;
+  Timer                            mUpdateTimer;
+
+  // Benchmark
+  uint32_t mBenchmarkStep    = 0u;
+  uint32_t mBenchmarkUpdates = 0u;
+  float    mCullingTime      = 0.f;
+  float    mUploadTime       = 0.f;
+  float    mLightsPerPixel   = 0.f;
+  float    mDroppedIndices   = 0.f;
+
   PanGestureDetector mPanDetector;
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
-  const bool showLights = [argc, argv]()
+  uint32_t options    = DeferredShadingExample::Options::NONE;
+  uint32_t lightCount = MAX_LIGHTS;
+  for(int i = 1; i < argc; ++i)
   {
-    auto endArgs = argv + argc;
-    return std::find_if(argv, endArgs, [](const char* arg)
+    if(strcmp(argv[i], "--show-lights") == 0)
     {
-      return strcmp(arg, "--show-lights") == 0;
-    }) != endArgs;
-  }();
+      options |= DeferredShadingExample::Options::SHOW_LIGHTS;
+    }
+    else if(strcmp(argv[i], "--tiled") == 0)
+    {
+      options |= DeferredShadingExample::Options::TILED;
+    }
+    else if(strcmp(argv[i], "--benchmark") == 0)
+    {
+      options |= DeferredShadingExample::Options::TILED | DeferredShadingExample::Options::BENCHMARK;
+    }
+    else if(strncmp(argv[i], "--lights=", 9) == 0)
+    {
+      options |= DeferredShadingExample::Options::TILED;
+      lightCount = std::min(std::max(atoi(argv[i] + 9), 1), MAX_TILED_LIGHTS);
+    }
+  }
 
   Application            app = Application::New(&argc, &argv);
-  DeferredShadingExample example(app, (showLights ? DeferredShadingExample::Options::SHOW_LIGHTS : 0));
+  DeferredShadingExample example(app, options, lightCount);
   app.MainLoop();
   return 0;
 }
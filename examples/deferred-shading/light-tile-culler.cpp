@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "light-tile-culler.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace
+{
+// Corners with smaller clip space w are treated as crossing the camera plane
+const float MIN_CLIP_W(1e-3f);
+
+/**
+ * Converts the light rectangle to an inclusive range of tiles
+ * @return false if the rectangle doesn't overlap any tile
+ */
+bool GetTileRange(float minX, float minY, float maxX, float maxY, uint32_t tileCountX, uint32_t tileCountY, uint32_t& x0, uint32_t& y0, uint32_t& x1, uint32_t& y1)
+{
+  // clamp before converting, so offscreen lights can't overflow the integers
+  const float left   = std::floor(std::max(minX, 0.0f));
+  const float bottom = std::floor(std::max(minY, 0.0f));
+  const float right  = std::floor(std::min(maxX, static_cast<float>(tileCountX - 1u)));
+  const float top    = std::floor(std::min(maxY, static_cast<float>(tileCountY - 1u)));
+  if(left > right || bottom > top)
+  {
+    return false;
+  }
+
+  x0 = static_cast<uint32_t>(left);
+  y0 = static_cast<uint32_t>(bottom);
+  x1 = static_cast<uint32_t>(right);
+  y1 = static_cast<uint32_t>(top);
+  return true;
+}
+} // namespace
+
+LightTileCuller::LightTileCuller(uint32_t tileCountX, uint32_t tileCountY, uint32_t maxTileLights)
+: mTileOffsets(tileCountX * tileCountY, 0u),
+  mTileCounts(tileCountX * tileCountY, 0u),
+  mLightIndices(tileCountX * tileCountY * maxTileLights, 0u),
+  mStatistics(),
+  mTileCountX(tileCountX),
+  mTileCountY(tileCountY),
+  mMaxTileLights(maxTileLights)
+{
+}
+
+LightTileCuller::~LightTileCuller()
+{
+}
+
+void LightTileCuller::Cull(const float* projection, const float* x, const float* y, const float* z, uint32_t count, float range)
+{
+  ProjectLights(projection, x, y, z, count, range);
+
+  mStatistics = Statistics();
+  std::fill(mTileCounts.begin(), mTileCounts.end(), 0u);
+
+  // count lights overlapping every tile
+  uint32_t x0, y0, x1, y1;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    if(!GetTileRange(mMinX[i], mMinY[i], mMaxX[i], mMaxY[i], mTileCountX, mTileCountY, x0, y0, x1, y1))
+    {
+      continue;
+    }
+
+    ++mStatistics.visibleLights;
+    for(uint32_t tileY = y0; tileY <= y1; ++tileY)
+    {
+      uint32_t* tileCounts = &mTileCounts[tileY * mTileCountX];
+      for(uint32_t tileX = x0; tileX <= x1; ++tileX)
+      {
+        ++tileCounts[tileX];
+      }
+    }
+  }
+
+  // reserve space for the clamped lists, the counts are then reused as fill cursors
+  uint32_t offset = 0u;
+  for(uint32_t tile = 0; tile < mTileCounts.size(); ++tile)
+  {
+    const uint32_t tileLights = mTileCounts[tile];
+    const uint32_t clamped    = std::min(tileLights, mMaxTileLights);
+
+    mStatistics.maxTileLights = std::max(mStatistics.maxTileLights, tileLights);
+    mStatistics.droppedIndices += tileLights - clamped;
+
+    mTileOffsets[tile] = offset;
+    mTileCounts[tile]  = 0u;
+    offset += clamped;
+  }
+  mStatistics.indexCount = offset;
+
+  // lights are added in order, so the first lights win when a tile is full
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    if(!GetTileRange(mMinX[i], mMinY[i], mMaxX[i], mMaxY[i], mTileCountX, mTileCountY, x0, y0, x1, y1))
+    {
+      continue;
+    }
+
+    for(uint32_t tileY = y0; tileY <= y1; ++tileY)
+    {
+      for(uint32_t tileX = x0; tileX <= x1; ++tileX)
+      {
+        const uint32_t tile = tileY * mTileCountX + tileX;
+        if(mTileCounts[tile] < mMaxTileLights)
+        {
+          mLightIndices[mTileOffsets[tile] + mTileCounts[tile]++] = i;
+        }
+      }
+    }
+  }
+
+  // all tiles cover the same area, so the average list length is the average per pixel cost
+  mStatistics.lightsPerPixel = static_cast<float>(mStatistics.indexCount) / static_cast<float>(mTileCounts.size());
+}
+
+void LightTileCuller::ProjectLights(const float* projection, const float* x, const float* y, const float* z, uint32_t count, float range)
+{
+  mMinX.resize(count);
+  mMinY.resize(count);
+  mMaxX.resize(count);
+  mMaxY.resize(count);
+
+  // clip space offsets of the bounding box corners along each view space axis
+  const float* p = projection;
+  const float  axisX[4] = {p[0] * range, p[1] * range, p[2] * range, p[3] * range};
+  const float  axisY[4] = {p[4] * range, p[5] * range, p[6] * range, p[7] * range};
+  const float  axisZ[4] = {p[8] * range, p[9] * range, p[10] * range, p[11] * range};
+
+  const float halfTilesX = static_cast<float>(mTileCountX) * 0.5f;
+  const float halfTilesY = static_cast<float>(mTileCountY) * 0.5f;
+
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    const float centerX = p[0] * x[i] + p[4] * y[i] + p[8] * z[i] + p[12];
+    const float centerY = p[1] * x[i] + p[5] * y[i] + p[9] * z[i] + p[13];
+    const float centerZ = p[2] * x[i] + p[6] * y[i] + p[10] * z[i] + p[14];
+    const float centerW = p[3] * x[i] + p[7] * y[i] + p[11] * z[i] + p[15];
+
+    float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+    float minW = FLT_MAX, maxW = -FLT_MAX;
+    int   nearCorners = 0, farCorners = 0;
+    for(int corner = 0; corner < 8; ++corner)
+    {
+      const float sx = (corner & 1) ? 1.0f : -1.0f;
+      const float sy = (corner & 2) ? 1.0f : -1.0f;
+      const float sz = (corner & 4) ? 1.0f : -1.0f;
+
+      const float clipX = centerX + sx * axisX[0] + sy * axisY[0] + sz * axisZ[0];
+      const float clipY = centerY + sx * axisX[1] + sy * axisY[1] + sz * axisZ[1];
+      const float clipZ = centerZ + sx * axisX[2] + sy * axisY[2] + sz * axisZ[2];
+      const float clipW = centerW + sx * axisX[3] + sy * axisY[3] + sz * axisZ[3];
+
+      const float invW = 1.0f / std::max(clipW, MIN_CLIP_W);
+      minX             = std::min(minX, clipX * invW);
+      minY             = std::min(minY, clipY * invW);
+      maxX             = std::max(maxX, clipX * invW);
+      maxY             = std::max(maxY, clipY * invW);
+      minW             = std::min(minW, clipW);
+      maxW             = std::max(maxW, clipW);
+      nearCorners += clipZ < -clipW;
+      farCorners += clipZ > clipW;
+    }
+
+    // a box crossing the camera plane may cover any part of the screen
+    const bool crossing = minW < MIN_CLIP_W;
+    minX                = crossing ? -1.0f : minX;
+    minY                = crossing ? -1.0f : minY;
+    maxX                = crossing ? 1.0f : maxX;
+    maxY                = crossing ? 1.0f : maxY;
+
+    // empty rectangle for boxes behind the camera or outside of the depth range
+    const bool culled = maxW < MIN_CLIP_W || nearCorners == 8 || farCorners == 8;
+    mMinX[i]          = culled ? 1.0f : (minX + 1.0f) * halfTilesX;
+    mMinY[i]          = culled ? 1.0f : (minY + 1.0f) * halfTilesY;
+    mMaxX[i]          = culled ? -1.0f : (maxX + 1.0f) * halfTilesX;
+    mMaxY[i]          = culled ? -1.0f : (maxY + 1.0f) * halfTilesY;
+  }
+}
+
+const std::vector<uint32_t>& LightTileCuller::GetTileOffsets() const
+{
+  return mTileOffsets;
+}
+
+const std::vector<uint32_t>& LightTileCuller::GetTileCounts() const
+{
+  return mTileCounts;
+}
+
+const std::vector<uint32_t>& LightTileCuller::GetLightIndices() const
+{
+  return mLightIndices;
+}
+
+const LightTileCuller::Statistics& LightTileCuller::GetStatistics() const
+{
+  return mStatistics;
+}
+
+uint32_t LightTileCuller::GetIndexCapacity() const
+{
+  return static_cast<uint32_t>(mLightIndices.size());
+}
@@ -0,0 +1,122 @@
+#ifndef LIGHT_TILE_CULLER_H
+#define LIGHT_TILE_CULLER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <inttypes.h>
+#include <vector>
+
+/**
+ * @brief The LightTileCuller class
+ * Builds per screen tile light lists for the tiled lighting mode of the deferred shading example.
+ *
+ * The screen is split into a grid of tiles, the bounding box of every light sphere is projected
+ * to the screen and the light is added to the list of every tile overlapped by the projection.
+ * Light positions and the screen rectangles are kept as separate arrays ( structure of arrays ),
+ * so the projection loop has no branches and can be vectorized by the compiler.
+ *
+ * The lists of all tiles are stored back to back in a single index array, every tile
+ * references its part of the array by an offset and a count.
+ */
+class LightTileCuller
+{
+public:
+  /**
+   * Culling statistics of the last Cull() call
+   */
+  struct Statistics
+  {
+    uint32_t visibleLights;  /// Number of lights overlapping at least one tile
+    uint32_t indexCount;     /// Total number of entries in all tile lists
+    uint32_t maxTileLights;  /// Length of the longest tile list before clamping
+    uint32_t droppedIndices; /// Number of entries dropped because a tile list was full
+    float    lightsPerPixel; /// Average number of lights evaluated for a pixel
+  };
+
+  /**
+   * Creates an instance of LightTileCuller
+   * @param[in] tileCountX Number of tile columns
+   * @param[in] tileCountY Number of tile rows
+   * @param[in] maxTileLights Maximum number of lights in a single tile list
+   */
+  LightTileCuller(uint32_t tileCountX, uint32_t tileCountY, uint32_t maxTileLights);
+
+  /**
+   * Destroys an instance of LightTileCuller
+   */
+  ~LightTileCuller();
+
+  /**
+   * Builds the tile light lists
+   * @param[in] projection Column major projection matrix
+   * @param[in] x View space x coordinates of the lights
+   * @param[in] y View space y coordinates of the lights
+   * @param[in] z View space z coordinates of the lights
+   * @param[in] count Number of lights
+   * @param[in] range Distance at which the contribution of a light drops to zero
+   */
+  void Cull(const float* projection, const float* x, const float* y, const float* z, uint32_t count, float range);
+
+  /**
+   * Returns the offsets of the tile lists within the light index array, tiles are stored row by row
+   */
+  const std::vector<uint32_t>& GetTileOffsets() const;
+
+  /**
+   * Returns the number of lights in every tile list
+   */
+  const std::vector<uint32_t>& GetTileCounts() const;
+
+  /**
+   * Returns the light index array, only the first Statistics::indexCount entries are valid
+   */
+  const std::vector<uint32_t>& GetLightIndices() const;
+
+  /**
+   * Returns statistics of the last Cull() call
+   */
+  const Statistics& GetStatistics() const;
+
+  /**
+   * Returns the maximum size of the light index array
+   */
+  uint32_t GetIndexCapacity() const;
+
+private:
+  /**
+   * Projects bounding boxes of the light spheres to the tile grid
+   */
+  void ProjectLights(const float* projection, const float* x, const float* y, const float* z, uint32_t count, float range);
+
+private:
+  std::vector<float> mMinX; /// Left edges of the light rectangles in tile units
+  std::vector<float> mMinY; /// Bottom edges of the light rectangles in tile units
+  std::vector<float> mMaxX; /// Right edges of the light rectangles in tile units
+  std::vector<float> mMaxY; /// Top edges of the light rectangles in tile units
+
+  std::vector<uint32_t> mTileOffsets;  /// Offsets of the tile lists within mLightIndices
+  std::vector<uint32_t> mTileCounts;   /// Number of lights in every tile list
+  std::vector<uint32_t> mLightIndices; /// Lists of all tiles stored back to back
+
+  Statistics mStatistics;    /// Statistics of the last Cull() call
+  uint32_t   mTileCountX;    /// Number of tile columns
+  uint32_t   mTileCountY;    /// Number of tile rows
+  uint32_t   mMaxTileLights; /// Maximum number of lights in a single tile list
+};
+
+#endif
@@ -1,6 +1,12 @@
 //@version 100
 
+// TILED_LIGHTING, MAX_TILE_LIGHTS and ATTENUATION_CUTOFF are defined by the application
+// when the lights are culled per screen tile.
+#ifdef TILED_LIGHTING
+precision highp float;
+#else
 precision mediump float;
+#endif
 
 const int kMaxLights = 32;
 
@@ -17,12 +23,22 @@ UNIFORM_BLOCK FragBuffer
 {
   UNIFORM mat4 uInvProjection;
   UNIFORM vec3 uDepth_InvDepth_Near;
+#ifdef TILED_LIGHTING
+  UNIFORM vec2 uLightIndexTextureSize;
+  UNIFORM float uLightRadius;
+#endif
 };
 
 #define DEPTH uDepth_InvDepth_Near.x
 #define INV_DEPTH uDepth_InvDepth_Near.y
 #define NEAR uDepth_InvDepth_Near.z
 
+#ifdef TILED_LIGHTING
+// Tile light lists
+UNIFORM sampler2D uTileData;      // offset and count of the tile list, per tile
+UNIFORM sampler2D uLightIndices;  // texture coordinate of the light within uLightData
+UNIFORM sampler2D uLightData;     // view space positions in the first row, colors in the second
+#else
 // Light source uniforms
 struct Light
 {
@@ -35,6 +51,7 @@ UNIFORM_BLOCK LightsBuffer
 {
 UNIFORM Light uLights[kMaxLights];
 };
+#endif
 
 INPUT vec2 vUv;
 
@@ -45,26 +62,53 @@ vec4 Unmap(vec4 m)  // texture -> projection
   return m;
 }
 
+vec3 CalculateLight(vec3 pos, vec3 normal, vec3 viewDirRefl, vec3 lightPosition, float lightRadius, vec3 lightColor)
+{
+  vec3 rel = pos - lightPosition;
+  float distance = length(rel);
+  rel /= distance;
+
+  float a = lightRadius / (kAttenuationConst + kAttenuationLinear * distance +
+    kAttenuationQuadratic * distance * distance);     // attenuation
+#ifdef TILED_LIGHTING
+  a = max(0.f, a - ATTENUATION_CUTOFF);   // no contribution beyond the culling range
+#endif
+
+  float l = max(0.f, dot(normal, rel));   // lambertian
+  float s = pow(max(0.f, dot(viewDirRefl, rel)), 256.f);  // specular
+
+  return (lightColor * (l + s)) * a;
+}
+
 vec3 CalculateLighting(vec3 pos, vec3 normal)
 {
   vec3 viewDir = normalize(pos);
   vec3 viewDirRefl = -reflect(viewDir, normal);
 
   vec3 light = vec3(0.04f); // fake ambient term
+#ifdef TILED_LIGHTING
+  vec2 tile = TEXTURE(uTileData, vUv).xy;
+  for (int i = 0; i < MAX_TILE_LIGHTS; ++i)
+  {
+    if (float(i) >= tile.y)
+    {
+      break;
+    }
+
+    float index = tile.x + float(i);
+    vec2 indexUv = vec2(mod(index, uLightIndexTextureSize.x) + .5f, floor(index / uLightIndexTextureSize.x) + .5f) / uLightIndexTextureSize;
+    float lightU = TEXTURE(uLightIndices, indexUv).r;
+
+    vec3 lightPosition = TEXTURE(uLightData, vec2(lightU, .25f)).xyz;
+    vec3 lightColor = TEXTURE(uLightData, vec2(lightU, .75f)).rgb;
+    light += CalculateLight(pos, normal, viewDirRefl, lightPosition, uLightRadius, lightColor);
+  }
+#else
   for (int i = 0; i < kMaxLights; ++i)
   {
-    vec3 rel = pos - uLights[i].position;
-    float distance = length(rel);
-    rel /= distance;
-
-    float a = uLights[i].radius / (kAttenuationConst + kAttenuationLinear * distance +
-      kAttenuationQuadratic * distance * distance);     // attenuation
-
-    float l = max(0.f, dot(normal, rel));   // lambertian
-    float s = pow(max(0.f, dot(viewDirRefl, rel)), 256.f);  // specular
-
-    light += (uLights[i].color * (l + s)) * a;
+    light += CalculateLight(pos, normal, viewDirRefl, uLights[i].position, uLights[i].radius, uLights[i].color);
   }
+#endif
 
   return light;
 }
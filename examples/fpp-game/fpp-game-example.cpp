@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -42,13 +42,23 @@ const char* SCENE_URL =
    GameEntity - the renderable object that has also a transformation. It wraps DALi actors.
 
    GameModel  - loads models ( '.mod' file format ) and wraps DALi Geometry object. 'mod' format
-                is binary in order
+                is binary in order to be memory mapped and uploaded without parsing ( see
+                game-model-format.h, tools/mod-converter converts the old files )
 
    GameTexture - manages textures. Loads them, creates samplers and wraps DALi TextureSet
 
    GameRenderer - binds texture and model. It's created per entity. While renderer is always unique
                   for entity, the texture and model may be reused
 
+   GameSpatialIndex - BVH built over window space bounding boxes of entities when the scene
+                is loaded. Every camera tick the GameScene queries it with the camera GameFrustum
+                and hides entities which are outside of the view. Culling statistics are shown by
+                GameStatsOverlay, press 'C' to toggle culling and compare the frame times.
+
+   GameInstanceBatch - draws all entities sharing a model with a single instanced renderer,
+                their lightmaps are packed into an atlas. Press 'I' to toggle instancing
+                and compare the draw call count with one renderer per entity.
+
    GameCamera - Wraps the CameraActor. It provides not only that but also handles user input and
                 implements first-person-perspective camera behavior.
                 GameCamera uses Dali::Timer to provide per-frame ( or rather every 16ms ) update tick.
@@ -117,6 +127,14 @@ public:
       {
         mApplication.Quit();
       }
+      else if(event.GetKeyName() == "c" || event.GetKeyName() == "C")
+      {
+        mScene.SetCullingEnabled(!mScene.IsCullingEnabled());
+      }
+      else if(event.GetKeyName() == "i" || event.GetKeyName() == "I")
+      {
+        mScene.SetInstancingEnabled(!mScene.IsInstancingEnabled());
+      }
     }
   }
 
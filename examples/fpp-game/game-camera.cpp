@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
  */
 
 #include "game-camera.h"
+#include "game-frustum.h"
 
 #include <dali/integration-api/string-utils.h>
 #include <dali/public-api/events/touch-event.h>
@@ -139,6 +140,7 @@ bool GameCamera::OnTick()
     rotation = (rotY * rotX);
   }
   mCameraActor.SetProperty(Actor::Property::ORIENTATION, rotation);
+  mCameraOrientation = rotation;
 
   // ---------------------------------------------------------------------
   // update position
@@ -177,9 +179,22 @@ bool GameCamera::OnTick()
 
   mCameraPosition = position;
 
+  mUpdatedSignal.Emit(*this);
+
   return true;
 }
 
+void GameCamera::GetFrustum(GameFrustum& frustum) const
+{
+  const float aspectRatio = mCameraActor.GetProperty<float>(CameraActor::Property::ASPECT_RATIO);
+  frustum.Set(mCameraPosition, mCameraOrientation, mFovY, aspectRatio, mNear, mFar);
+}
+
+GameCamera::UpdatedSignalType& GameCamera::UpdatedSignal()
+{
+  return mUpdatedSignal;
+}
+
 void GameCamera::InitialiseDefaultCamera()
 {
   mCameraActor.SetProperty(Dali::Actor::Property::NAME, "GameCamera");
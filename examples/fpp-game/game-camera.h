@@ -2,7 +2,7 @@
 #define GAME_CAMERA_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,7 +20,11 @@
 
 #include <dali/public-api/actors/camera-actor.h>
 #include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/math/quaternion.h>
 #include <dali/public-api/math/vector2.h>
+#include <dali/public-api/signals/dali-signal.h>
+
+class GameFrustum;
 
 /**
  * @brief The GameCamera class
@@ -41,6 +45,8 @@
 class GameCamera : public Dali::ConnectionTracker
 {
 public:
+  typedef Dali::Signal<void(GameCamera&)> UpdatedSignalType;
+
   /**
    * Creates an instance of GameCamera
    */
@@ -61,6 +67,18 @@ public:
    */
   void Initialise(Dali::CameraActor defaultCamera, float fov, float near, float far, const Dali::Vector2& sceneSize);
 
+  /**
+   * Computes the view frustum of the camera in the window space
+   * @param[out] frustum Frustum to fill
+   */
+  void GetFrustum(GameFrustum& frustum) const;
+
+  /**
+   * Signal emitted every tick after the camera position and orientation have been updated
+   * @return The signal to connect to
+   */
+  UpdatedSignalType& UpdatedSignal();
+
 private:
   /**
    * Sets up a perspective camera using Dali default camera
@@ -107,9 +125,12 @@ private:
   int mWalkingTouchId; /// Touch device id bound to the walking action
   int mLookingTouchId; /// Touch device id bound to the looking action
 
-  Dali::Vector3 mCameraPosition; /// Current camera position ( shadowing the actor position )
+  Dali::Vector3    mCameraPosition;    /// Current camera position ( shadowing the actor position )
+  Dali::Quaternion mCameraOrientation; /// Current camera orientation ( shadowing the actor orientation )
   Dali::Vector2 mSceneSize;      /// The size of the scene we are looking at
 
+  UpdatedSignalType mUpdatedSignal; /// Signal emitted after each tick
+
   bool mPortraitMode; /// flag if window is in portrait mode ( physically window width < height )
 };
 
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "game-frustum.h"
+
+#include <dali/public-api/math/degree.h>
+#include <dali/public-api/math/radian.h>
+
+#include <cmath>
+
+using namespace Dali;
+
+namespace
+{
+/**
+ * Creates plane passing through the point with given inward facing normal
+ */
+Vector4 MakePlane(const Vector3& normal, const Vector3& point)
+{
+  return Vector4(normal.x, normal.y, normal.z, -normal.Dot(point));
+}
+} // namespace
+
+GameFrustum::GameFrustum()
+{
+}
+
+GameFrustum::~GameFrustum()
+{
+}
+
+void GameFrustum::Set(const Vector3& position, const Quaternion& orientation, float fovY, float aspectRatio, float near, float far)
+{
+  const Vector3 forward = orientation.Rotate(Vector3::ZAXIS);
+  const Vector3 right   = orientation.Rotate(Vector3::XAXIS);
+  const Vector3 up      = orientation.Rotate(Vector3::YAXIS);
+
+  const float halfFovY = Radian(Degree(fovY)).radian * 0.5f;
+  const float halfFovX = atanf(tanf(halfFovY) * aspectRatio);
+
+  // side planes pass through the camera position
+  const float sinX = sinf(halfFovX);
+  const float cosX = cosf(halfFovX);
+  const float sinY = sinf(halfFovY);
+  const float cosY = cosf(halfFovY);
+
+  mPlanes[0] = MakePlane(forward, position + forward * near);
+  mPlanes[1] = MakePlane(-forward, position + forward * far);
+  mPlanes[2] = MakePlane(forward * sinX + right * cosX, position);
+  mPlanes[3] = MakePlane(forward * sinX - right * cosX, position);
+  mPlanes[4] = MakePlane(forward * sinY + up * cosY, position);
+  mPlanes[5] = MakePlane(forward * sinY - up * cosY, position);
+}
+
+GameFrustum::Intersection GameFrustum::Test(const Vector3& center, const Vector3& halfExtents) const
+{
+  Intersection result(INSIDE);
+  for(const Vector4& plane : mPlanes)
+  {
+    // projected radius of the box onto the plane normal
+    const float radius   = fabsf(plane.x) * halfExtents.x + fabsf(plane.y) * halfExtents.y + fabsf(plane.z) * halfExtents.z;
+    const float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+    if(distance < -radius)
+    {
+      return OUTSIDE;
+    }
+    if(distance < radius)
+    {
+      result = INTERSECT;
+    }
+  }
+  return result;
+}
@@ -0,0 +1,79 @@
+#ifndef GAME_FRUSTUM_H
+#define GAME_FRUSTUM_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/math/quaternion.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+
+/**
+ * @brief The GameFrustum class
+ * Six planes of the camera view volume expressed in the window space. Planes
+ * are stored as ( normal, distance ) pairs with normals pointing into the volume.
+ *
+ * The DALi camera looks down its local positive Z axis, the vertical field
+ * of view is measured along the local Y axis.
+ */
+class GameFrustum
+{
+public:
+  /**
+   * Result of the bounding box test
+   */
+  enum Intersection
+  {
+    OUTSIDE,   /// Box is completely outside of the frustum
+    INTERSECT, /// Box crosses at least one of the planes
+    INSIDE     /// Box is completely inside of the frustum
+  };
+
+  /**
+   * Creates an instance of GameFrustum
+   */
+  GameFrustum();
+
+  /**
+   * Destroys an instance of GameFrustum
+   */
+  ~GameFrustum();
+
+  /**
+   * Computes frustum planes from the camera parameters
+   * @param[in] position Camera position
+   * @param[in] orientation Camera orientation
+   * @param[in] fovY Vertical field of view in degrees
+   * @param[in] aspectRatio Width divided by height of the view
+   * @param[in] near Near plane distance
+   * @param[in] far Far plane distance
+   */
+  void Set(const Dali::Vector3& position, const Dali::Quaternion& orientation, float fovY, float aspectRatio, float near, float far);
+
+  /**
+   * Tests axis aligned bounding box against the frustum
+   * @param[in] center Center of the bounding box
+   * @param[in] halfExtents Half of the bounding box size
+   * @return Position of the box relative to the frustum
+   */
+  Intersection Test(const Dali::Vector3& center, const Dali::Vector3& halfExtents) const;
+
+private:
+  Dali::Vector4 mPlanes[6]; /// Planes as ( nx, ny, nz, d )
+};
+
+#endif
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "game-instance-batch.h"
+#include "game-model.h"
+#include "game-texture.h"
+
+#include "generated/game-instanced-renderer-vert.h"
+#include "generated/game-renderer-frag.h"
+
+#include <dali-toolkit/public-api/image-loader/sync-image-loader.h>
+#include <dali/dali.h>
+#include <dali/devel-api/rendering/renderer-devel.h>
+#include <dali/integration-api/debug.h>
+#include <dali/integration-api/string-utils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+using Dali::Integration::ToDaliString;
+using Dali::Integration::ToDaliStringView;
+
+using namespace Dali;
+
+namespace
+{
+// Size of the uniform arrays holding instance data, must fit in the uniform block limits
+const uint32_t MAX_INSTANCES_PER_BATCH(64u);
+
+// Maximum width and height of the texture atlas
+const uint32_t MAX_ATLAS_SIZE(4096u);
+} // namespace
+
+GameInstanceBatch::GameInstanceBatch(GameModel* model)
+: mModel(model)
+{
+}
+
+GameInstanceBatch::~GameInstanceBatch()
+{
+}
+
+bool GameInstanceBatch::CanAdd(GameModel* model, GameTexture* texture) const
+{
+  if(model != mModel || mInstances.size() >= MAX_INSTANCES_PER_BATCH)
+  {
+    return false;
+  }
+
+  if(mInstances.empty())
+  {
+    return true;
+  }
+
+  // textures already in the batch don't need more atlas space
+  std::vector<GameTexture*> textures;
+  for(const Instance& instance : mInstances)
+  {
+    if(instance.texture == texture)
+    {
+      return true;
+    }
+    if(std::find(textures.begin(), textures.end(), instance.texture) == textures.end())
+    {
+      textures.push_back(instance.texture);
+    }
+  }
+
+  // all atlas cells have the size of the first texture
+  const Texture& first  = mInstances[0].texture->GetTexture();
+  const Texture& second = texture->GetTexture();
+  if(first.GetWidth() != second.GetWidth() || first.GetHeight() != second.GetHeight())
+  {
+    return false;
+  }
+
+  const uint32_t maxCells = (MAX_ATLAS_SIZE / first.GetWidth()) * (MAX_ATLAS_SIZE / first.GetHeight());
+  return textures.size() < maxCells;
+}
+
+void GameInstanceBatch::Add(uint32_t entityIndex, const Matrix& localMatrix, GameTexture* texture)
+{
+  Instance instance;
+  instance.entityIndex = entityIndex;
+  instance.matrix      = localMatrix;
+  instance.texture     = texture;
+  instance.uvRect      = Vector4(0.0f, 0.0f, 1.0f, 1.0f);
+  mInstances.push_back(instance);
+}
+
+void GameInstanceBatch::Build()
+{
+  TextureSet textureSet = CreateAtlas();
+
+  std::ostringstream oss;
+  oss << "\n#define MAX_INSTANCES " << MAX_INSTANCES_PER_BATCH << "\n\n";
+
+  // instances are moved by the vertex shader, so the actor bounds can't be used for culling
+  Shader shader = Shader::New(ToDaliStringView(oss.str() + std::string(SHADER_GAME_INSTANCED_RENDERER_VERT)),
+                              ToDaliStringView(SHADER_GAME_RENDERER_FRAG),
+                              Shader::Hint::MODIFIES_GEOMETRY);
+
+  mRenderer = Renderer::New(mModel->GetGeometry(), shader);
+  mRenderer.SetTextures(textureSet);
+  mRenderer.SetProperty(Renderer::Property::DEPTH_WRITE_MODE, DepthWriteMode::ON);
+  mRenderer.SetProperty(Renderer::Property::DEPTH_FUNCTION, DepthFunction::LESS_EQUAL);
+  mRenderer.SetProperty(Renderer::Property::DEPTH_TEST_MODE, DepthTestMode::ON);
+
+  char buffer[32];
+  for(uint32_t i = 0; i < mInstances.size(); ++i)
+  {
+    snprintf(buffer, sizeof(buffer), "uInstanceMatrix[%u]", i);
+    mMatrixIndices.push_back(mRenderer.RegisterProperty(buffer, Matrix::IDENTITY));
+    snprintf(buffer, sizeof(buffer), "uInstanceUvRect[%u]", i);
+    mUvRectIndices.push_back(mRenderer.RegisterProperty(buffer, Vector4::ZERO));
+  }
+
+  mActor = Actor::New();
+  mActor.SetProperty(Actor::Property::NAME, "GameInstanceBatch");
+  mActor.SetProperty(Actor::Property::PIVOT, Pivot::CENTER);
+  mActor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  mActor.SetProperty(Actor::Property::VISIBLE, false);
+  mActor.AddRenderer(mRenderer);
+}
+
+TextureSet GameInstanceBatch::CreateAtlas()
+{
+  std::vector<GameTexture*> textures;
+  for(const Instance& instance : mInstances)
+  {
+    if(std::find(textures.begin(), textures.end(), instance.texture) == textures.end())
+    {
+      textures.push_back(instance.texture);
+    }
+  }
+
+  // all instances share the texture, nothing to pack
+  if(textures.size() == 1)
+  {
+    return textures[0]->GetTextureSet();
+  }
+
+  const uint32_t cellWidth  = textures[0]->GetTexture().GetWidth();
+  const uint32_t cellHeight = textures[0]->GetTexture().GetHeight();
+  const uint32_t columns    = static_cast<uint32_t>(ceilf(sqrtf(static_cast<float>(textures.size()))));
+  const uint32_t rows       = (static_cast<uint32_t>(textures.size()) + columns - 1) / columns;
+  const uint32_t width      = columns * cellWidth;
+  const uint32_t height     = rows * cellHeight;
+
+  Texture       atlas;
+  Pixel::Format atlasFormat(Pixel::RGB888);
+  for(uint32_t i = 0; i < textures.size(); ++i)
+  {
+    // pixel data is not kept by GameTexture once uploaded, so the image is decoded again
+    PixelData pixelData = Toolkit::SyncImageLoader::Load(ToDaliString(textures[i]->GetFilename()));
+    if(!pixelData)
+    {
+      continue;
+    }
+
+    if(!atlas)
+    {
+      atlasFormat = pixelData.GetPixelFormat();
+      atlas       = Texture::New(TextureType::TEXTURE_2D, atlasFormat, width, height);
+    }
+
+    const uint32_t column = i % columns;
+    const uint32_t row    = i / columns;
+    if(pixelData.GetPixelFormat() != atlasFormat)
+    {
+      DALI_LOG_ERROR("Texture %s can't be added to the atlas, pixel format differs\n", textures[i]->GetFilename().c_str());
+      continue;
+    }
+    atlas.Upload(pixelData, 0, 0, column * cellWidth, row * cellHeight, cellWidth, cellHeight);
+
+    const Vector4 uvRect(static_cast<float>(column * cellWidth) / width,
+                         static_cast<float>(row * cellHeight) / height,
+                         static_cast<float>(cellWidth) / width,
+                         static_cast<float>(cellHeight) / height);
+    for(Instance& instance : mInstances)
+    {
+      if(instance.texture == textures[i])
+      {
+        instance.uvRect = uvRect;
+      }
+    }
+  }
+
+  TextureSet textureSet = TextureSet::New();
+  if(atlas)
+  {
+    // lower mip levels mix neighbouring cells, acceptable for the blurry lightmaps
+    atlas.GenerateMipmaps();
+    textureSet.SetTexture(0, atlas);
+
+    Sampler sampler = Sampler::New();
+    sampler.SetWrapMode(WrapMode::CLAMP_TO_EDGE, WrapMode::CLAMP_TO_EDGE, WrapMode::CLAMP_TO_EDGE);
+    sampler.SetFilterMode(FilterMode::LINEAR_MIPMAP_LINEAR, FilterMode::LINEAR);
+    textureSet.SetSampler(0, sampler);
+  }
+  return textureSet;
+}
+
+void GameInstanceBatch::Update(const std::vector<bool>& entityVisible)
+{
+  std::vector<uint32_t> visible;
+  visible.reserve(mInstances.size());
+  for(uint32_t i = 0; i < mInstances.size(); ++i)
+  {
+    if(entityVisible[mInstances[i].entityIndex])
+    {
+      visible.push_back(i);
+    }
+  }
+
+  if(visible == mVisible)
+  {
+    return;
+  }
+
+  // visible instances are packed at the front of the arrays, only changed slots are written
+  for(uint32_t slot = 0; slot < visible.size(); ++slot)
+  {
+    if(slot < mVisible.size() && mVisible[slot] == visible[slot])
+    {
+      continue;
+    }
+    const Instance& instance = mInstances[visible[slot]];
+    mRenderer.SetProperty(mMatrixIndices[slot], instance.matrix);
+    mRenderer.SetProperty(mUvRectIndices[slot], instance.uvRect);
+  }
+  mVisible.swap(visible);
+
+  if(!mVisible.empty())
+  {
+    mRenderer[DevelRenderer::Property::INSTANCE_COUNT] = static_cast<int32_t>(mVisible.size());
+  }
+  mActor.SetProperty(Actor::Property::VISIBLE, !mVisible.empty());
+}
+
+Actor& GameInstanceBatch::GetActor()
+{
+  return mActor;
+}
+
+uint32_t GameInstanceBatch::GetInstanceCount() const
+{
+  return static_cast<uint32_t>(mInstances.size());
+}
+
+uint32_t GameInstanceBatch::GetVisibleInstanceCount() const
+{
+  return static_cast<uint32_t>(mVisible.size());
+}
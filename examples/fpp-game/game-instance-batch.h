@@ -0,0 +1,130 @@
+#ifndef GAME_INSTANCE_BATCH_H
+#define GAME_INSTANCE_BATCH_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/object/property.h>
+#include <dali/public-api/rendering/renderer.h>
+
+#include <inttypes.h>
+#include <vector>
+
+class GameModel;
+class GameTexture;
+
+/**
+ * @brief The GameInstanceBatch class
+ * Draws all entities sharing the same GameModel with a single instanced Dali::Renderer.
+ *
+ * Per-instance transforms and texture coordinate rectangles are passed as uniform arrays
+ * indexed by INSTANCE_INDEX in the vertex shader. When the instances use different
+ * textures ( every entity of the corridor scene has its own lightmap ), the textures are
+ * copied into a grid atlas, so the whole batch can be drawn with a single TextureSet.
+ *
+ * The number of instances is limited by the uniform array size and the atlas size,
+ * larger groups are split into several batches by the GameScene ( see CanAdd() ).
+ */
+class GameInstanceBatch
+{
+public:
+  /**
+   * Creates an instance of GameInstanceBatch drawing the given model
+   * @param[in] model The model shared by all instances
+   */
+  GameInstanceBatch(GameModel* model);
+
+  /**
+   * Destroys an instance of GameInstanceBatch
+   */
+  ~GameInstanceBatch();
+
+  /**
+   * Checks whether the entity using the texture can join this batch
+   * @param[in] model Model of the entity
+   * @param[in] texture Main texture of the entity
+   * @return true if the entity can be added
+   */
+  bool CanAdd(GameModel* model, GameTexture* texture) const;
+
+  /**
+   * Adds an instance to the batch, must be called before Build()
+   * @param[in] entityIndex Index of the entity within the scene
+   * @param[in] localMatrix Transform of the entity relative to the scene root
+   * @param[in] texture Main texture of the entity
+   */
+  void Add(uint32_t entityIndex, const Dali::Matrix& localMatrix, GameTexture* texture);
+
+  /**
+   * Creates the texture atlas ( if needed ), the instanced renderer and its actor
+   */
+  void Build();
+
+  /**
+   * Uploads instance data for the visible entities and updates the instance count
+   * @param[in] entityVisible Visibility of every scene entity, indexed by the entity index
+   */
+  void Update(const std::vector<bool>& entityVisible);
+
+  /**
+   * Returns the actor holding the instanced renderer
+   */
+  Dali::Actor& GetActor();
+
+  /**
+   * Returns number of instances in the batch
+   */
+  uint32_t GetInstanceCount() const;
+
+  /**
+   * Returns number of instances drawn after the last Update()
+   */
+  uint32_t GetVisibleInstanceCount() const;
+
+private:
+  /**
+   * Copies textures of all instances into a single grid atlas
+   * @return The texture set containing the atlas
+   */
+  Dali::TextureSet CreateAtlas();
+
+private:
+  /**
+   * Per-instance source data
+   */
+  struct Instance
+  {
+    uint32_t      entityIndex; /// Index of the entity within the scene
+    Dali::Matrix  matrix;      /// Transform relative to the scene root
+    GameTexture*  texture;     /// Main texture of the entity
+    Dali::Vector4 uvRect;      /// Offset and scale of the texture within the atlas
+  };
+
+  std::vector<Instance>              mInstances;     /// All instances of the batch
+  std::vector<uint32_t>              mVisible;       /// Instances currently written to the uniform arrays
+  std::vector<Dali::Property::Index> mMatrixIndices; /// Renderer property indices of uInstanceMatrix[]
+  std::vector<Dali::Property::Index> mUvRectIndices; /// Renderer property indices of uInstanceUvRect[]
+
+  GameModel*     mModel;    /// The model shared by all instances
+  Dali::Renderer mRenderer; /// The instanced renderer
+  Dali::Actor    mActor;    /// The actor holding the renderer
+};
+
+#endif
@@ -0,0 +1,266 @@
+#ifndef GAME_MODEL_FORMAT_H
+#define GAME_MODEL_FORMAT_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <inttypes.h>
+#include <string.h>
+
+/**
+ * Layout of the '.mod' model files. This header has no DALi dependencies, it is shared
+ * by the GameModel loader and the mod-converter tool ( tools/mod-converter ).
+ *
+ * Version 1 files store the whole file twice: a big-endian copy followed by
+ * a little-endian copy, the loader picks the one matching the tag.
+ *
+ * Version 2 files are stored once, always little-endian:
+ *
+ *   ModelHeaderV2 | vertex data ( vertexCount * vertexStride ) | index data ( optional )
+ *
+ * Vertices always contain position, normal and texture coordinate ( in this order ),
+ * normals and texture coordinates may be quantized to cut file size.
+ */
+namespace GameModelFormat
+{
+// 'MODV' tag
+const uint32_t MODV_TAG(0x4D4F4456);
+
+// Supported file versions
+const uint32_t VERSION_1(1u);
+const uint32_t VERSION_2(2u);
+
+// Number of attributes stored in every vertex
+const uint32_t ATTRIBUTE_COUNT(3u);
+
+/**
+ * Index of the attribute within the vertex
+ */
+enum Attribute
+{
+  POSITION = 0,
+  NORMAL,
+  TEXCOORD
+};
+
+/**
+ * Storage format of a single component of the attribute
+ */
+enum ComponentFormat
+{
+  FLOAT32 = 0, /// 32-bit IEEE float
+  FLOAT16,     /// 16-bit IEEE half float
+  SNORM16      /// signed 16-bit integer normalized to [-1, 1]
+};
+
+/**
+ * @brief The ModelAttributeV2 struct
+ * Description of a vertex attribute
+ */
+struct ModelAttributeV2
+{
+  uint32_t format;     /// ComponentFormat of the components
+  uint32_t components; /// Number of components ( 1-4 )
+  uint32_t offset;     /// Offset of the attribute within the vertex
+};
+
+/**
+ * @brief The ModelHeaderV2 struct
+ * Version 2 file header, all fields are little-endian
+ */
+struct ModelHeaderV2
+{
+  uint32_t         tag;                         /// 'MODV' tag
+  uint32_t         version;                     /// File version, VERSION_2
+  uint32_t         vertexCount;                 /// Number of vertices
+  uint32_t         vertexStride;                /// Size of a single vertex in bytes
+  ModelAttributeV2 attributes[ATTRIBUTE_COUNT]; /// Vertex attributes
+  uint32_t         indexCount;                  /// Number of indices, 0 if the model is not indexed
+  uint32_t         indexSize;                   /// Size of a single index in bytes ( 2 or 4 )
+  uint32_t         vertexDataOffset;            /// Offset of the vertex data from the beginning of the file
+  uint32_t         indexDataOffset;             /// Offset of the index data from the beginning of the file
+  float            boundsMin[3];                /// Minimum corner of the model bounding box
+  float            boundsMax[3];                /// Maximum corner of the model bounding box
+};
+
+/**
+ * Returns size in bytes of a single component stored in given format
+ */
+inline uint32_t GetComponentSize(uint32_t format)
+{
+  return format == FLOAT32 ? 4u : 2u;
+}
+
+/**
+ * Checks whether the host is little-endian
+ */
+inline bool IsLittleEndianHost()
+{
+  const uint32_t value(1u);
+  uint8_t        firstByte;
+  memcpy(&firstByte, &value, 1);
+  return firstByte == 1u;
+}
+
+/**
+ * Reads 16-bit little-endian value
+ */
+inline uint16_t ReadU16(const uint8_t* data)
+{
+  return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+/**
+ * Reads 32-bit little-endian value
+ */
+inline uint32_t ReadU32(const uint8_t* data)
+{
+  return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) | (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+/**
+ * Reads 32-bit little-endian float
+ */
+inline float ReadF32(const uint8_t* data)
+{
+  const uint32_t bits = ReadU32(data);
+  float          value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/**
+ * Converts half float bits to float
+ */
+inline float HalfToFloat(uint16_t half)
+{
+  const uint32_t sign     = static_cast<uint32_t>(half & 0x8000u) << 16;
+  uint32_t       exponent = (half >> 10) & 0x1Fu;
+  uint32_t       mantissa = half & 0x3FFu;
+  uint32_t       bits;
+
+  if(exponent == 0x1Fu)
+  {
+    // infinity or NaN
+    bits = sign | 0x7F800000u | (mantissa << 13);
+  }
+  else if(exponent == 0u)
+  {
+    if(mantissa == 0u)
+    {
+      bits = sign;
+    }
+    else
+    {
+      // denormal, normalize it
+      exponent = 127 - 15 + 1;
+      while(!(mantissa & 0x400u))
+      {
+        mantissa <<= 1;
+        --exponent;
+      }
+      mantissa &= 0x3FFu;
+      bits = sign | (exponent << 23) | (mantissa << 13);
+    }
+  }
+  else
+  {
+    bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+  }
+
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/**
+ * Converts signed normalized 16-bit value to float
+ */
+inline float Snorm16ToFloat(uint16_t value)
+{
+  const float result = static_cast<float>(static_cast<int16_t>(value)) / 32767.0f;
+  return result < -1.0f ? -1.0f : result;
+}
+
+/**
+ * Reads single little-endian component stored in given format
+ */
+inline float ReadComponent(const uint8_t* data, uint32_t format)
+{
+  switch(format)
+  {
+    case FLOAT16:
+    {
+      return HalfToFloat(ReadU16(data));
+    }
+    case SNORM16:
+    {
+      return Snorm16ToFloat(ReadU16(data));
+    }
+    case FLOAT32:
+    default:
+    {
+      return ReadF32(data);
+    }
+  }
+}
+
+/**
+ * Reads and validates version 2 header from the beginning of the file
+ * @param[in] data File data
+ * @param[in] size Size of the file data
+ * @param[out] header Header in the host byte order
+ * @return true if the header is valid and all data ranges are within the file
+ */
+inline bool ReadHeaderV2(const uint8_t* data, size_t size, ModelHeaderV2& header)
+{
+  if(size < sizeof(ModelHeaderV2))
+  {
+    return false;
+  }
+
+  // header consists of 32-bit fields only
+  for(size_t i = 0; i < sizeof(ModelHeaderV2) / sizeof(uint32_t); ++i)
+  {
+    const uint32_t word = ReadU32(data + i * sizeof(uint32_t));
+    memcpy(reinterpret_cast<uint8_t*>(&header) + i * sizeof(uint32_t), &word, sizeof(uint32_t));
+  }
+
+  if(header.tag != MODV_TAG || header.version != VERSION_2)
+  {
+    return false;
+  }
+
+  for(uint32_t i = 0; i < ATTRIBUTE_COUNT; ++i)
+  {
+    const ModelAttributeV2& attribute = header.attributes[i];
+    if(attribute.format > SNORM16 || attribute.components < 1u || attribute.components > 4u ||
+       attribute.offset + attribute.components * GetComponentSize(attribute.format) > header.vertexStride)
+    {
+      return false;
+    }
+  }
+
+  const uint64_t vertexEnd = static_cast<uint64_t>(header.vertexDataOffset) + static_cast<uint64_t>(header.vertexCount) * header.vertexStride;
+  const uint64_t indexEnd  = static_cast<uint64_t>(header.indexDataOffset) + static_cast<uint64_t>(header.indexCount) * header.indexSize;
+  return vertexEnd <= size &&
+         (header.indexCount == 0u || ((header.indexSize == 2u || header.indexSize == 4u) && indexEnd <= size));
+}
+
+} // namespace GameModelFormat
+
+#endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,48 +16,180 @@
  */
 
 #include "game-model.h"
+#include "game-model-format.h"
 #include "game-utils.h"
+#include "shared/mapped-file.h"
+
+#include <dali/integration-api/debug.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 using namespace GameUtils;
+using namespace GameModelFormat;
 
 namespace
 {
-// 'MODV' tag stored in the big-endian (network) order
-const uint32_t MODV_TAG(0x4D4F4456);
+// Layout of the vertex expected by the renderer: aPosition, aNormal, aTexCoord
+const uint32_t VERTEX_COMPONENTS[ATTRIBUTE_COUNT] = {3u, 3u, 2u};
+const uint32_t VERTEX_OFFSETS[ATTRIBUTE_COUNT]    = {0u, 12u, 24u};
+const uint32_t VERTEX_STRIDE(32u);
 } // namespace
 
 GameModel::GameModel(const char* filename)
 : mUniqueId(false),
   mIsReady(false)
 {
-  ByteArray bytes;
-  if(!LoadFile(filename, bytes))
+  // the mapping is released once the data is uploaded
+  DemoHelper::MappedFile file;
+  if(!file.Open(filename))
   {
     return;
   }
 
-  mHeader = *(reinterpret_cast<ModelHeader*>(bytes.data()));
-
-  // expect big-endian
-  if(MODV_TAG != mHeader.tag)
-  {
-    // jump to little-endian variant
-    mHeader = *(reinterpret_cast<ModelHeader*>(bytes.data() + bytes.size() / 2));
-  }
+  const uint8_t* data = file.GetData();
+  const size_t   size = file.GetSize();
 
   mVertexBuffer = Dali::VertexBuffer::New(Dali::Property::Map().Add("aPosition", Dali::Property::VECTOR3).Add("aNormal", Dali::Property::VECTOR3).Add("aTexCoord", Dali::Property::VECTOR2));
 
-  mVertexBuffer.SetData(bytes.data() + mHeader.dataBeginOffset, mHeader.vertexBufferSize / mHeader.vertexStride);
-
   mGeometry = Dali::Geometry::New();
   mGeometry.AddVertexBuffer(mVertexBuffer);
   mGeometry.SetType(Dali::Geometry::TRIANGLES);
 
+  // version 2 files are little-endian, version 1 starts with the big-endian copy
+  const bool isVersion2 = size >= 2 * sizeof(uint32_t) && ReadU32(data) == MODV_TAG && ReadU32(data + sizeof(uint32_t)) == VERSION_2;
+  if(!(isVersion2 ? LoadVersion2(data, size) : LoadVersion1(data, size)))
+  {
+    DALI_LOG_ERROR("Invalid model file: %s\n", filename);
+    return;
+  }
+
   mUniqueId = HashString(filename);
 
   mIsReady = true;
 }
 
+bool GameModel::LoadVersion1(const uint8_t* data, size_t size)
+{
+  if(size < sizeof(ModelHeader))
+  {
+    return false;
+  }
+
+  ModelHeader header;
+  memcpy(&header, data, sizeof(header));
+
+  // expect big-endian
+  if(MODV_TAG != header.tag)
+  {
+    // jump to little-endian variant
+    if(size / 2 < sizeof(ModelHeader))
+    {
+      return false;
+    }
+    memcpy(&header, data + size / 2, sizeof(header));
+    if(MODV_TAG != header.tag)
+    {
+      return false;
+    }
+  }
+
+  if(header.vertexStride != VERTEX_STRIDE || static_cast<uint64_t>(header.dataBeginOffset) + header.vertexBufferSize > size)
+  {
+    return false;
+  }
+
+  // data is already in the host byte order
+  const uint8_t* vertexData  = data + header.dataBeginOffset;
+  const uint32_t vertexCount = header.vertexBufferSize / header.vertexStride;
+  mVertexBuffer.SetData(vertexData, vertexCount);
+
+  ComputeBoundingBox(vertexData, vertexCount, header.vertexStride, header.attributeOffset[POSITION]);
+  return true;
+}
+
+bool GameModel::LoadVersion2(const uint8_t* data, size_t size)
+{
+  ModelHeaderV2 header;
+  if(!ReadHeaderV2(data, size, header))
+  {
+    return false;
+  }
+
+  // every index has to address a vertex of the file, otherwise the GPU reads past the vertex buffer
+  if(header.indexCount)
+  {
+    const uint8_t* indexData = data + header.indexDataOffset;
+    if(header.indexSize == sizeof(uint16_t))
+    {
+      std::vector<uint16_t> indices(header.indexCount);
+      for(uint32_t i = 0; i < header.indexCount; ++i)
+      {
+        indices[i] = ReadU16(indexData + i * sizeof(uint16_t));
+        if(indices[i] >= header.vertexCount)
+        {
+          return false;
+        }
+      }
+      mGeometry.SetIndexBuffer(indices.data(), indices.size());
+    }
+    else
+    {
+      std::vector<uint32_t> indices(header.indexCount);
+      for(uint32_t i = 0; i < header.indexCount; ++i)
+      {
+        indices[i] = ReadU32(indexData + i * sizeof(uint32_t));
+        if(indices[i] >= header.vertexCount)
+        {
+          return false;
+        }
+      }
+      mGeometry.SetIndexBuffer(indices.data(), indices.size());
+    }
+  }
+
+  const uint8_t* vertexData = data + header.vertexDataOffset;
+
+  bool matchesLayout = IsLittleEndianHost() && header.vertexStride == VERTEX_STRIDE;
+  for(uint32_t i = 0; i < ATTRIBUTE_COUNT && matchesLayout; ++i)
+  {
+    const ModelAttributeV2& attribute = header.attributes[i];
+    matchesLayout = attribute.format == FLOAT32 && attribute.components == VERTEX_COMPONENTS[i] && attribute.offset == VERTEX_OFFSETS[i];
+  }
+
+  if(matchesLayout)
+  {
+    // zero-copy path, the mapped data goes straight to the vertex buffer
+    mVertexBuffer.SetData(vertexData, header.vertexCount);
+  }
+  else
+  {
+    // quantized or foreign byte order data, expand to floats
+    std::vector<float> vertices(static_cast<size_t>(header.vertexCount) * (VERTEX_STRIDE / sizeof(float)));
+    float*             out = vertices.data();
+    for(uint32_t vertex = 0; vertex < header.vertexCount; ++vertex)
+    {
+      const uint8_t* in = vertexData + static_cast<size_t>(vertex) * header.vertexStride;
+      for(uint32_t i = 0; i < ATTRIBUTE_COUNT; ++i)
+      {
+        const ModelAttributeV2& attribute     = header.attributes[i];
+        const uint32_t          componentSize = GetComponentSize(attribute.format);
+        for(uint32_t component = 0; component < VERTEX_COMPONENTS[i]; ++component)
+        {
+          *out++ = component < attribute.components ? ReadComponent(in + attribute.offset + component * componentSize, attribute.format) : 0.0f;
+        }
+      }
+    }
+    mVertexBuffer.SetData(vertices.data(), header.vertexCount);
+  }
+
+  // bounds are precomputed by the converter
+  mBoundingBoxMin = Dali::Vector3(header.boundsMin);
+  mBoundingBoxMax = Dali::Vector3(header.boundsMax);
+  return true;
+}
+
 GameModel::~GameModel()
 {
 }
@@ -76,3 +208,37 @@ uint32_t GameModel::GetUniqueId()
 {
   return mUniqueId;
 }
+
+void GameModel::GetBoundingBox(Dali::Vector3& minimum, Dali::Vector3& maximum) const
+{
+  minimum = mBoundingBoxMin;
+  maximum = mBoundingBoxMax;
+}
+
+void GameModel::ComputeBoundingBox(const uint8_t* vertexData, uint32_t vertexCount, uint32_t vertexStride, uint32_t positionOffset)
+{
+  mBoundingBoxMin = Dali::Vector3::ZERO;
+  mBoundingBoxMax = Dali::Vector3::ZERO;
+
+  if(!vertexCount)
+  {
+    return;
+  }
+
+  // position is stored as 3 floats
+  const uint8_t* position = vertexData + positionOffset;
+  float          xyz[3];
+  memcpy(xyz, position, sizeof(xyz));
+  mBoundingBoxMin = mBoundingBoxMax = Dali::Vector3(xyz);
+
+  for(uint32_t i = 1; i < vertexCount; ++i)
+  {
+    position += vertexStride;
+    memcpy(xyz, position, sizeof(xyz));
+    for(uint32_t axis = 0; axis < 3; ++axis)
+    {
+      mBoundingBoxMin.AsFloat()[axis] = std::min(mBoundingBoxMin.AsFloat()[axis], xyz[axis]);
+      mBoundingBoxMax.AsFloat()[axis] = std::max(mBoundingBoxMax.AsFloat()[axis], xyz[axis]);
+    }
+  }
+}
@@ -2,7 +2,7 @@
 #define GAME_MODEL_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,14 +18,16 @@
  *
  */
 
+#include <dali/public-api/math/vector3.h>
 #include <dali/public-api/rendering/geometry.h>
 #include <dali/public-api/rendering/vertex-buffer.h>
 
 #include <inttypes.h>
+#include <stddef.h>
 
 /**
  * @brief The ModelHeader struct
- * Model file header structure
+ * Version 1 model file header structure
  */
 struct ModelHeader
 {
@@ -44,10 +46,15 @@ struct ModelHeader
 /**
  * @brief The GameModel class
  * GameModel represents model geometry. It loads model data from external model file ( .mod file ).
- * Such data is ready to be used as GL buffer so it can be copied directly into the VertexBuffer
- * object.
+ * The file is memory mapped and when the vertex data is stored as plain floats in the host
+ * byte order, it's passed directly to the VertexBuffer object without intermediate copies.
  *
- * Model file is multi-architecture so can be loaded on little and big endian architectures
+ * Two versions of the file are supported ( see game-model-format.h ):
+ * - version 1 stores big and little endian copies of the data,
+ * - version 2 is little-endian only, may contain an index buffer and quantized normals and
+ *   texture coordinates. Quantized attributes are expanded to floats while loading.
+ *
+ * Version 1 files can be converted with the mod-converter tool ( tools/mod-converter ).
  */
 class GameModel
 {
@@ -81,11 +88,45 @@ public:
    */
   uint32_t GetUniqueId();
 
+  /**
+   * Returns the axis aligned bounding box of the model in model space
+   * @param[out] minimum The minimum corner of the bounding box
+   * @param[out] maximum The maximum corner of the bounding box
+   */
+  void GetBoundingBox(Dali::Vector3& minimum, Dali::Vector3& maximum) const;
+
+private:
+  /**
+   * Loads version 1 file storing big and little endian copies of the data
+   * @param[in] data File data
+   * @param[in] size Size of the file data
+   * @return true on success
+   */
+  bool LoadVersion1(const uint8_t* data, size_t size);
+
+  /**
+   * Loads version 2 little-endian file
+   * @param[in] data File data
+   * @param[in] size Size of the file data
+   * @return true on success
+   */
+  bool LoadVersion2(const uint8_t* data, size_t size);
+
+  /**
+   * Computes the bounding box from the position attribute of the vertex data
+   * @param[in] vertexData Pointer to the first vertex
+   * @param[in] vertexCount Number of vertices
+   * @param[in] vertexStride Size of a single vertex in bytes
+   * @param[in] positionOffset Offset of the position within the vertex
+   */
+  void ComputeBoundingBox(const uint8_t* vertexData, uint32_t vertexCount, uint32_t vertexStride, uint32_t positionOffset);
+
 private:
   Dali::Geometry     mGeometry;
   Dali::VertexBuffer mVertexBuffer;
 
-  ModelHeader mHeader;
+  Dali::Vector3 mBoundingBoxMin; /// Minimum corner of the model space bounding box
+  Dali::Vector3 mBoundingBoxMax; /// Maximum corner of the model space bounding box
 
   uint32_t mUniqueId;
   bool     mIsReady;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,9 +17,11 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <sstream>
 
 #include "game-camera.h"
 #include "game-entity.h"
+#include "game-instance-batch.h"
 #include "game-model.h"
 #include "game-renderer.h"
 #include "game-scene.h"
@@ -27,7 +29,11 @@
 
 #include "third-party/pico-json.h"
 
+#include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
+#include <dali/integration-api/debug.h>
+
+#include <algorithm>
 
 using namespace Dali;
 using namespace picojson;
@@ -36,8 +42,27 @@ using std::vector;
 
 using namespace GameUtils;
 
+namespace
+{
+// Number of camera ticks between the statistics overlay updates
+const uint32_t STATS_UPDATE_TICKS(30u);
+
+// Weight of the newest sample in the averaged timings
+const float STATS_SMOOTHING(0.05f);
+
+// Weight of the newest frame time sample, taken once per overlay update
+const float FRAME_TIME_SMOOTHING(0.25f);
+} // namespace
+
 GameScene::GameScene()
+: mCullingTime(0.0f),
+  mEntitiesTested(0u),
+  mDrawCalls(0u),
+  mTickCount(0u),
+  mCullingEnabled(true),
+  mInstancingEnabled(true)
 {
+  mFrameTime[0][0] = mFrameTime[0][1] = mFrameTime[1][0] = mFrameTime[1][1] = 0.0f;
 }
 
 GameScene::~GameScene()
@@ -60,6 +85,9 @@ bool GameScene::Load(Window window, const char* filename)
 
   bool failed(false);
 
+  std::vector<GameModel*>   models;
+  std::vector<GameTexture*> textures;
+
   if(root.is<object>())
   {
     object rootObject = root.get<object>();
@@ -136,6 +164,8 @@ bool GameScene::Load(Window window, const char* filename)
         break;
       }
 
+      models.push_back(model);
+      textures.push_back(texture);
       entity->GetGameRenderer().SetModel(model);
       entity->GetGameRenderer().SetMainTexture(texture);
     }
@@ -166,10 +196,257 @@ bool GameScene::Load(Window window, const char* filename)
   // update camera
   mCamera.Initialise(window.GetRenderTaskList().GetTask(0).GetCameraActor(), 60.0f, 0.1f, 100.0f, Vector2(window.GetPositionSize().width, window.GetPositionSize().height));
 
+  std::vector<Matrix> localMatrices;
+  for(size_t i = 0; i < mEntities.Size(); ++i)
+  {
+    Actor& actor(mEntities[i]->GetActor());
+
+    Matrix localMatrix(false);
+    localMatrix.SetTransformComponents(actor.GetProperty<Vector3>(Actor::Property::SCALE),
+                                       actor.GetProperty<Quaternion>(Actor::Property::ORIENTATION),
+                                       actor.GetProperty<Vector3>(Actor::Property::POSITION));
+    localMatrices.push_back(localMatrix);
+  }
+
+  // index entities and cull them on every camera tick
+  BuildSpatialIndex(models, localMatrices);
+  BuildInstanceBatches(models, textures, localMatrices);
+  UpdateVisibility();
+  mStatsOverlay.Initialise(window);
+  Dali::UiContext::Get().AddFrameCallback(mFrameTimer, window.GetRootLayer());
+  mCamera.UpdatedSignal().Connect(this, &GameScene::OnCameraUpdated);
+
   return true;
 }
 
+void GameScene::BuildSpatialIndex(const std::vector<GameModel*>& models, const std::vector<Matrix>& localMatrices)
+{
+  Matrix rootMatrix(false);
+  rootMatrix.SetTransformComponents(mRootActor.GetProperty<Vector3>(Actor::Property::SCALE),
+                                    mRootActor.GetProperty<Quaternion>(Actor::Property::ORIENTATION),
+                                    mRootActor.GetProperty<Vector3>(Actor::Property::POSITION));
+
+  std::vector<GameBoundingBox> boxes(mEntities.Size());
+  for(size_t i = 0; i < mEntities.Size(); ++i)
+  {
+    Matrix worldMatrix(false);
+    Matrix::Multiply(worldMatrix, localMatrices[i], rootMatrix);
+
+    // the game shader does not scale geometry by the actor size
+    Vector3 modelMin, modelMax;
+    models[i]->GetBoundingBox(modelMin, modelMax);
+
+    // transform all corners of the model box and take their bounds
+    for(uint32_t corner = 0; corner < 8; ++corner)
+    {
+      const Vector4 point(worldMatrix * Vector4((corner & 1) ? modelMax.x : modelMin.x,
+                                                (corner & 2) ? modelMax.y : modelMin.y,
+                                                (corner & 4) ? modelMax.z : modelMin.z,
+                                                1.0f));
+      const Vector3 position(point.x, point.y, point.z);
+      if(!corner)
+      {
+        boxes[i].min = boxes[i].max = position;
+      }
+      else
+      {
+        boxes[i].Merge(GameBoundingBox{position, position});
+      }
+    }
+  }
+
+  mSpatialIndex.Build(boxes);
+  mEntityInView.assign(mEntities.Size(), true);
+  mEntityVisible.assign(mEntities.Size(), true);
+}
+
+void GameScene::BuildInstanceBatches(const std::vector<GameModel*>& models, const std::vector<GameTexture*>& textures, const std::vector<Matrix>& localMatrices)
+{
+  mEntityBatched.assign(mEntities.Size(), false);
+
+  // count users of each model, a model used once gains nothing from instancing
+  std::vector<uint32_t> modelUsers(models.size(), 0u);
+  for(size_t i = 0; i < models.size(); ++i)
+  {
+    modelUsers[i] = static_cast<uint32_t>(std::count(models.begin(), models.end(), models[i]));
+  }
+
+  for(size_t i = 0; i < mEntities.Size(); ++i)
+  {
+    if(modelUsers[i] < 2)
+    {
+      continue;
+    }
+
+    GameInstanceBatch* batch(NULL);
+    for(InstanceBatchArray::Iterator iter = mInstanceBatches.Begin(); iter != mInstanceBatches.End(); ++iter)
+    {
+      if((*iter)->CanAdd(models[i], textures[i]))
+      {
+        batch = *iter;
+        break;
+      }
+    }
+    if(!batch)
+    {
+      batch = new GameInstanceBatch(models[i]);
+      mInstanceBatches.PushBack(batch);
+    }
+
+    batch->Add(static_cast<uint32_t>(i), localMatrices[i], textures[i]);
+    mEntityBatched[i] = true;
+  }
+
+  for(InstanceBatchArray::Iterator iter = mInstanceBatches.Begin(); iter != mInstanceBatches.End(); ++iter)
+  {
+    (*iter)->Build();
+    mRootActor.Add((*iter)->GetActor());
+  }
+
+  DALI_LOG_RELEASE_INFO("GameScene: %u entities, draw calls per entity: %u, with instancing: %u\n",
+                        static_cast<uint32_t>(mEntities.Size()),
+                        static_cast<uint32_t>(mEntities.Size()),
+                        static_cast<uint32_t>(mEntities.Size() - std::count(mEntityBatched.begin(), mEntityBatched.end(), true) + mInstanceBatches.Size()));
+}
+
+void GameScene::UpdateVisibility()
+{
+  mDrawCalls = 0u;
+  for(uint32_t i = 0; i < mEntityInView.size(); ++i)
+  {
+    const bool visible = mEntityInView[i] && !(mInstancingEnabled && mEntityBatched[i]);
+    SetEntityVisible(i, visible);
+    mDrawCalls += visible ? 1u : 0u;
+  }
+
+  // batches draw only entities in view, nothing at all when instancing is disabled
+  const std::vector<bool> noneInView(mEntityInView.size(), false);
+  for(InstanceBatchArray::Iterator iter = mInstanceBatches.Begin(); iter != mInstanceBatches.End(); ++iter)
+  {
+    (*iter)->Update(mInstancingEnabled ? mEntityInView : noneInView);
+    mDrawCalls += (*iter)->GetVisibleInstanceCount() ? 1u : 0u;
+  }
+}
+
+void GameScene::OnCameraUpdated(GameCamera& camera)
+{
+  const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+  if(mCullingEnabled)
+  {
+    camera.GetFrustum(mFrustum);
+    mEntitiesTested = mSpatialIndex.Query(mFrustum, mVisibleEntities);
+
+    // hide everything which has not been reported visible
+    mEntityInView.assign(mEntities.Size(), false);
+    for(uint32_t index : mVisibleEntities)
+    {
+      mEntityInView[index] = true;
+    }
+    UpdateVisibility();
+
+    const float cullingTime = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - now).count();
+    mCullingTime += (cullingTime - mCullingTime) * STATS_SMOOTHING;
+  }
+
+  if(++mTickCount >= STATS_UPDATE_TICKS)
+  {
+    mTickCount = 0;
+
+    // average the frames rendered since the last overlay update
+    if(mFrameTimer.GetFrameCount())
+    {
+      const float frameTime        = mFrameTimer.GetAverageMilliseconds();
+      float&      averageFrameTime = mFrameTime[mCullingEnabled ? 1 : 0][mInstancingEnabled ? 1 : 0];
+      averageFrameTime             = (averageFrameTime > 0.0f) ? averageFrameTime + (frameTime - averageFrameTime) * FRAME_TIME_SMOOTHING : frameTime;
+      mFrameTimer.Reset();
+    }
+    UpdateStatsOverlay();
+  }
+}
+
+void GameScene::SetEntityVisible(uint32_t index, bool visible)
+{
+  if(mEntityVisible[index] != visible)
+  {
+    mEntityVisible[index] = visible;
+    mEntities[index]->GetActor().SetProperty(Actor::Property::VISIBLE, visible);
+  }
+}
+
+void GameScene::UpdateStatsOverlay()
+{
+  std::ostringstream stream;
+  stream.setf(std::ios::fixed);
+  stream.precision(2);
+
+  stream << "Culling: " << (mCullingEnabled ? "ON" : "OFF") << " (press C to toggle)\n";
+  if(mCullingEnabled)
+  {
+    stream << "Entities: " << mSpatialIndex.GetItemCount() << " tested: " << mEntitiesTested << " visible: " << mVisibleEntities.size() << "\n";
+    stream << "Culling time: " << mCullingTime << " us\n";
+  }
+  else
+  {
+    stream << "Entities: " << mSpatialIndex.GetItemCount() << " visible: " << mSpatialIndex.GetItemCount() << "\n";
+  }
+  stream << "Instancing: " << (mInstancingEnabled ? "ON" : "OFF") << " (press I to toggle)\n";
+  stream << "Draw calls: " << mDrawCalls << " (" << mInstanceBatches.Size() << " instanced batches)\n";
+
+  // compare with the other state of each option, once it has been measured
+  const uint32_t culling    = mCullingEnabled ? 1 : 0;
+  const uint32_t instancing = mInstancingEnabled ? 1 : 0;
+  const float    current    = mFrameTime[culling][instancing];
+  stream << "Frame time: " << current << " ms";
+  if(current > 0.0f && mFrameTime[1 - culling][instancing] > 0.0f)
+  {
+    stream << "\n  delta vs culling " << (culling ? "OFF" : "ON") << ": " << (current - mFrameTime[1 - culling][instancing]) << " ms";
+  }
+  if(current > 0.0f && mFrameTime[culling][1 - instancing] > 0.0f)
+  {
+    stream << "\n  delta vs instancing " << (instancing ? "OFF" : "ON") << ": " << (current - mFrameTime[culling][1 - instancing]) << " ms";
+  }
+
+  mStatsOverlay.SetText(stream.str());
+}
+
+void GameScene::SetCullingEnabled(bool enabled)
+{
+  mCullingEnabled = enabled;
+  if(!enabled)
+  {
+    mEntityInView.assign(mEntities.Size(), true);
+    UpdateVisibility();
+  }
+
+  // measure the frame time of the new state from now on
+  mFrameTimer.Reset();
+  mTickCount = 0;
+  UpdateStatsOverlay();
+}
+
+bool GameScene::IsCullingEnabled() const
+{
+  return mCullingEnabled;
+}
+
 Dali::Actor& GameScene::GetRootActor()
 {
   return mRootActor;
 }
+
+void GameScene::SetInstancingEnabled(bool enabled)
+{
+  mInstancingEnabled = enabled;
+  UpdateVisibility();
+
+  // measure the frame time of the new state from now on
+  mFrameTimer.Reset();
+  mTickCount = 0;
+  UpdateStatsOverlay();
+}
+
+bool GameScene::IsInstancingEnabled() const
+{
+  return mInstancingEnabled;
+}
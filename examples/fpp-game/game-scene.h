@@ -2,7 +2,7 @@
 #define GAME_SCENE_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,11 +20,17 @@
 
 #include <inttypes.h>
 #include <stdint.h>
+#include <chrono>
 #include <vector>
 
 #include "game-camera.h"
 #include "game-container.h"
+#include "game-frustum.h"
+#include "game-instance-batch.h"
+#include "game-spatial-index.h"
+#include "game-stats-overlay.h"
 #include "game-utils.h"
+#include "shared/frame-time-callback.h"
 
 #include <dali/public-api/actors/actor.h>
 #include <dali/public-api/adaptor-framework/window.h>
@@ -37,11 +43,21 @@ class GameModel;
 /**
  * Container based types owning heap allocated data of specifed types
  */
-typedef GameContainer<GameEntity*>  EntityArray;
-typedef GameContainer<GameTexture*> TextureArray;
-typedef GameContainer<GameModel*>   ModelArray;
+typedef GameContainer<GameEntity*>        EntityArray;
+typedef GameContainer<GameTexture*>       TextureArray;
+typedef GameContainer<GameModel*>         ModelArray;
+typedef GameContainer<GameInstanceBatch*> InstanceBatchArray;
 
-class GameScene
+/**
+ * @brief The GameScene class
+ * Owns entities and resources of the loaded scene. After loading, entity bounds are
+ * indexed by a GameSpatialIndex and every camera tick the entities outside of the
+ * camera frustum are hidden, so they are not submitted for rendering.
+ *
+ * Entities sharing a model are additionally grouped into GameInstanceBatch objects, each
+ * drawing all of its entities with one instanced renderer instead of one draw call per entity.
+ */
+class GameScene : public Dali::ConnectionTracker
 {
 public:
   /**
@@ -78,10 +94,92 @@ public:
    */
   Dali::Actor& GetRootActor();
 
+  /**
+   * Enables or disables frustum culling, all entities become visible when disabled
+   * @param[in] enabled Whether culling should be performed
+   */
+  void SetCullingEnabled(bool enabled);
+
+  /**
+   * Returns whether frustum culling is enabled
+   * @return true if culling is enabled
+   */
+  bool IsCullingEnabled() const;
+
+  /**
+   * Enables or disables instanced rendering of entities sharing a model
+   * @param[in] enabled Whether instance batches should be drawn instead of entity actors
+   */
+  void SetInstancingEnabled(bool enabled);
+
+  /**
+   * Returns whether instanced rendering is enabled
+   * @return true if instancing is enabled
+   */
+  bool IsInstancingEnabled() const;
+
+private:
+  /**
+   * Computes window space bounding boxes of all entities and builds the spatial index
+   * @param[in] models Model of each entity, in the same order as mEntities
+   * @param[in] localMatrices Transform of each entity relative to the root actor
+   */
+  void BuildSpatialIndex(const std::vector<GameModel*>& models, const std::vector<Dali::Matrix>& localMatrices);
+
+  /**
+   * Groups entities sharing a model into instance batches, entities with a unique model stay unbatched
+   * @param[in] models Model of each entity, in the same order as mEntities
+   * @param[in] textures Main texture of each entity, in the same order as mEntities
+   * @param[in] localMatrices Transform of each entity relative to the root actor
+   */
+  void BuildInstanceBatches(const std::vector<GameModel*>& models, const std::vector<GameTexture*>& textures, const std::vector<Dali::Matrix>& localMatrices);
+
+  /**
+   * Shows entity actors and instance batches according to the culling result and the instancing state
+   */
+  void UpdateVisibility();
+
+  /**
+   * Handles camera tick, updates entity visibility and statistics
+   * @param[in] camera The camera which has been updated
+   */
+  void OnCameraUpdated(GameCamera& camera);
+
+  /**
+   * Sets visibility of entity actor if it differs from the current state
+   * @param[in] index Index of the entity
+   * @param[in] visible New visibility
+   */
+  void SetEntityVisible(uint32_t index, bool visible);
+
+  /**
+   * Refreshes the statistics overlay text
+   */
+  void UpdateStatsOverlay();
+
 private:
   EntityArray mEntities;
   GameCamera  mCamera;
 
+  GameSpatialIndex      mSpatialIndex;    /// BVH over the window space entity bounds
+  GameFrustum           mFrustum;         /// Frustum of the camera from the last tick
+  std::vector<uint32_t> mVisibleEntities; /// Indices of entities found visible in the last tick
+  std::vector<bool>     mEntityInView;    /// Whether each entity has passed the culling
+  std::vector<bool>     mEntityVisible;   /// Current visibility of each entity actor
+  std::vector<bool>     mEntityBatched;   /// Whether each entity is drawn by an instance batch
+  InstanceBatchArray    mInstanceBatches; /// Batches of entities sharing a model
+  GameStatsOverlay      mStatsOverlay;    /// Overlay displaying culling statistics
+
+  DemoHelper::FrameTimeCallback mFrameTimer; /// Measures the rendered frame times on the update thread
+
+  float    mFrameTime[2][2];    /// Averaged frame time in milliseconds, indexed by the culling and the instancing state
+  float    mCullingTime;        /// Averaged time spent culling in microseconds
+  uint32_t mEntitiesTested;     /// Entity bounding boxes tested in the last tick
+  uint32_t mDrawCalls;          /// Draw calls issued by the scene after the last visibility update
+  uint32_t mTickCount;          /// Number of ticks since the overlay was refreshed
+  bool     mCullingEnabled;     /// Whether frustum culling is performed
+  bool     mInstancingEnabled;  /// Whether instance batches are drawn instead of entity actors
+
   // internal scene cache
   ModelArray   mModelCache;
   TextureArray mTextureCache;
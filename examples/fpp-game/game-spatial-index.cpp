@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "game-spatial-index.h"
+#include "game-frustum.h"
+
+#include <algorithm>
+
+using namespace Dali;
+
+namespace
+{
+// Maximum number of items stored in a single leaf
+const uint32_t MAX_LEAF_ITEMS(4u);
+
+// Maximum depth of the traversal stack, enough for any median split tree
+const uint32_t MAX_STACK_DEPTH(64u);
+} // namespace
+
+void GameBoundingBox::Merge(const GameBoundingBox& other)
+{
+  min.x = std::min(min.x, other.min.x);
+  min.y = std::min(min.y, other.min.y);
+  min.z = std::min(min.z, other.min.z);
+  max.x = std::max(max.x, other.max.x);
+  max.y = std::max(max.y, other.max.y);
+  max.z = std::max(max.z, other.max.z);
+}
+
+Vector3 GameBoundingBox::GetCenter() const
+{
+  return (min + max) * 0.5f;
+}
+
+Vector3 GameBoundingBox::GetHalfExtents() const
+{
+  return (max - min) * 0.5f;
+}
+
+GameSpatialIndex::GameSpatialIndex()
+{
+}
+
+GameSpatialIndex::~GameSpatialIndex()
+{
+}
+
+void GameSpatialIndex::Build(const std::vector<GameBoundingBox>& boxes)
+{
+  mBoxes = boxes;
+  mNodes.clear();
+  mItems.resize(boxes.size());
+  for(uint32_t i = 0; i < mItems.size(); ++i)
+  {
+    mItems[i] = i;
+  }
+
+  if(mItems.empty())
+  {
+    return;
+  }
+
+  // a binary tree with N leaves has at most 2N - 1 nodes
+  mNodes.reserve(mItems.size() * 2);
+  mNodes.push_back(Node());
+  BuildNode(0, 0, static_cast<uint32_t>(mItems.size()));
+}
+
+void GameSpatialIndex::BuildNode(uint32_t nodeIndex, uint32_t first, uint32_t count)
+{
+  GameBoundingBox bounds(mBoxes[mItems[first]]);
+  for(uint32_t i = first + 1; i < first + count; ++i)
+  {
+    bounds.Merge(mBoxes[mItems[i]]);
+  }
+  mNodes[nodeIndex].bounds = bounds;
+
+  if(count <= MAX_LEAF_ITEMS)
+  {
+    mNodes[nodeIndex].first = first;
+    mNodes[nodeIndex].count = count;
+    return;
+  }
+
+  // split at the median of box centers along the longest axis
+  const Vector3 size = bounds.max - bounds.min;
+  uint32_t      axis = 0;
+  if(size.y > size.x)
+  {
+    axis = 1;
+  }
+  if(size.z > size.AsFloat()[axis])
+  {
+    axis = 2;
+  }
+
+  const uint32_t half = count / 2;
+  std::nth_element(mItems.begin() + first, mItems.begin() + first + half, mItems.begin() + first + count, [this, axis](uint32_t lhs, uint32_t rhs) {
+    return mBoxes[lhs].GetCenter().AsFloat()[axis] < mBoxes[rhs].GetCenter().AsFloat()[axis];
+  });
+
+  const uint32_t firstChild = static_cast<uint32_t>(mNodes.size());
+  mNodes[nodeIndex].first   = firstChild;
+  mNodes[nodeIndex].count   = 0;
+  mNodes.push_back(Node());
+  mNodes.push_back(Node());
+
+  BuildNode(firstChild, first, half);
+  BuildNode(firstChild + 1, first + half, count - half);
+}
+
+uint32_t GameSpatialIndex::Query(const GameFrustum& frustum, std::vector<uint32_t>& visible) const
+{
+  visible.clear();
+  if(mNodes.empty())
+  {
+    return 0;
+  }
+
+  uint32_t tested(0);
+  uint32_t stack[MAX_STACK_DEPTH];
+  uint32_t stackSize(0);
+  stack[stackSize++] = 0;
+
+  while(stackSize)
+  {
+    const uint32_t nodeIndex = stack[--stackSize];
+    const Node&    node      = mNodes[nodeIndex];
+
+    const GameFrustum::Intersection intersection = frustum.Test(node.bounds.GetCenter(), node.bounds.GetHalfExtents());
+    if(intersection == GameFrustum::OUTSIDE)
+    {
+      continue;
+    }
+
+    // whole subtree is visible, no need to test any further
+    if(intersection == GameFrustum::INSIDE)
+    {
+      CollectAll(nodeIndex, visible);
+      continue;
+    }
+
+    if(node.count)
+    {
+      for(uint32_t i = node.first; i < node.first + node.count; ++i)
+      {
+        const GameBoundingBox& box = mBoxes[mItems[i]];
+        ++tested;
+        if(frustum.Test(box.GetCenter(), box.GetHalfExtents()) != GameFrustum::OUTSIDE)
+        {
+          visible.push_back(mItems[i]);
+        }
+      }
+    }
+    else
+    {
+      stack[stackSize++] = node.first;
+      stack[stackSize++] = node.first + 1;
+    }
+  }
+
+  return tested;
+}
+
+void GameSpatialIndex::CollectAll(uint32_t nodeIndex, std::vector<uint32_t>& visible) const
+{
+  const Node& node = mNodes[nodeIndex];
+  if(node.count)
+  {
+    visible.insert(visible.end(), mItems.begin() + node.first, mItems.begin() + node.first + node.count);
+  }
+  else
+  {
+    CollectAll(node.first, visible);
+    CollectAll(node.first + 1, visible);
+  }
+}
+
+uint32_t GameSpatialIndex::GetItemCount() const
+{
+  return static_cast<uint32_t>(mBoxes.size());
+}
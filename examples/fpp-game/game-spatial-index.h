@@ -0,0 +1,124 @@
+#ifndef GAME_SPATIAL_INDEX_H
+#define GAME_SPATIAL_INDEX_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/math/vector3.h>
+
+#include <inttypes.h>
+#include <vector>
+
+class GameFrustum;
+
+/**
+ * @brief The GameBoundingBox struct
+ * Axis aligned bounding box stored as minimum and maximum corners
+ */
+struct GameBoundingBox
+{
+  Dali::Vector3 min; /// Minimum corner
+  Dali::Vector3 max; /// Maximum corner
+
+  /**
+   * Grows the box so it contains the other box
+   * @param[in] other Box to include
+   */
+  void Merge(const GameBoundingBox& other);
+
+  /**
+   * Returns center of the box
+   */
+  Dali::Vector3 GetCenter() const;
+
+  /**
+   * Returns half of the size of the box
+   */
+  Dali::Vector3 GetHalfExtents() const;
+};
+
+/**
+ * @brief The GameSpatialIndex class
+ * Bounding volume hierarchy built over static bounding boxes. Each box is
+ * identified by its index in the array passed to Build(). The hierarchy is
+ * built once ( median split along the longest axis ) and may be queried
+ * every frame with the camera frustum.
+ */
+class GameSpatialIndex
+{
+public:
+  /**
+   * Creates an instance of GameSpatialIndex
+   */
+  GameSpatialIndex();
+
+  /**
+   * Destroys an instance of GameSpatialIndex
+   */
+  ~GameSpatialIndex();
+
+  /**
+   * Builds the hierarchy, replaces any previously built data
+   * @param[in] boxes Bounding boxes of all items
+   */
+  void Build(const std::vector<GameBoundingBox>& boxes);
+
+  /**
+   * Collects items that are at least partially inside the frustum
+   * @param[in] frustum The frustum to test against
+   * @param[out] visible Indices of visible items, cleared before use
+   * @return Number of item bounding boxes tested against the frustum
+   */
+  uint32_t Query(const GameFrustum& frustum, std::vector<uint32_t>& visible) const;
+
+  /**
+   * Returns number of items stored in the index
+   */
+  uint32_t GetItemCount() const;
+
+private:
+  /**
+   * Node of the hierarchy. Leaf nodes reference a range of mItems,
+   * inner nodes always have two children stored at mNodes[ firstChild ] and mNodes[ firstChild + 1 ]
+   */
+  struct Node
+  {
+    GameBoundingBox bounds; /// Bounds of the whole subtree
+    uint32_t        first;  /// First item ( leaf ) or first child node ( inner node )
+    uint32_t        count;  /// Number of items in the leaf, 0 for inner nodes
+  };
+
+  /**
+   * Recursively builds subtree for the given range of items
+   * @param[in] nodeIndex Index of the node to fill
+   * @param[in] first First item of the range
+   * @param[in] count Number of items in the range
+   */
+  void BuildNode(uint32_t nodeIndex, uint32_t first, uint32_t count);
+
+  /**
+   * Appends all items of the subtree without testing
+   */
+  void CollectAll(uint32_t nodeIndex, std::vector<uint32_t>& visible) const;
+
+private:
+  std::vector<Node>            mNodes; /// Flattened hierarchy, node 0 is the root
+  std::vector<uint32_t>        mItems; /// Item indices ordered by leaf
+  std::vector<GameBoundingBox> mBoxes; /// Copy of the item bounding boxes
+};
+
+#endif
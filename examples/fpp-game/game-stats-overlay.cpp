@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "game-stats-overlay.h"
+
+#include <dali-toolkit/public-api/visuals/color-visual-properties.h>
+#include <dali-toolkit/public-api/visuals/visual-properties.h>
+#include <dali/devel-api/actors/actor-devel.h>
+#include <dali/integration-api/string-utils.h>
+#include <dali/public-api/actors/camera-actor.h>
+#include <dali/public-api/object/property-map.h>
+#include <dali/public-api/render-tasks/render-task-list.h>
+
+using Dali::Integration::ToDaliString;
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace
+{
+// Point size of the statistics text
+const float STATS_POINT_SIZE(8.0f);
+
+// Background color of the statistics label
+const Vector4 STATS_BACKGROUND_COLOR(0.0f, 0.0f, 0.0f, 0.5f);
+} // namespace
+
+GameStatsOverlay::GameStatsOverlay()
+{
+}
+
+GameStatsOverlay::~GameStatsOverlay()
+{
+}
+
+void GameStatsOverlay::Initialise(Window window)
+{
+  mWindow = window;
+
+  auto    positionSize = mWindow.GetPositionSize();
+  Vector2 windowSize(positionSize.width, positionSize.height);
+  bool    isLandscape(windowSize.x > windowSize.y);
+  if(!isLandscape)
+  {
+    std::swap(windowSize.x, windowSize.y);
+  }
+
+  mUiRoot = Actor::New();
+  mUiRoot.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  mUiRoot.SetProperty(Actor::Property::PIVOT, Pivot::CENTER);
+  mUiRoot.SetProperty(Actor::Property::SIZE, windowSize);
+  mWindow.Add(mUiRoot);
+
+  mLabel = TextLabel::New();
+  mLabel.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  mLabel.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+  DevelActor::SetResizePolicy(mLabel, ResizePolicy::USE_NATURAL_SIZE, Dimension::ALL_DIMENSIONS);
+  mLabel.SetProperty(TextLabel::Property::MULTI_LINE, true);
+  mLabel.SetProperty(TextLabel::Property::POINT_SIZE, STATS_POINT_SIZE);
+  mLabel.SetProperty(TextLabel::Property::TEXT_COLOR, Color::WHITE);
+  mLabel.SetProperty(Control::Property::BACKGROUND,
+                     Property::Map().Add(Visual::Property::TYPE, Visual::COLOR).Add(ColorVisual::Property::MIX_COLOR, STATS_BACKGROUND_COLOR));
+  mUiRoot.Add(mLabel);
+
+  // create camera dedicated to be used with the overlay
+  mUiCamera   = CameraActor::New();
+  mRenderTask = mWindow.GetRenderTaskList().CreateTask();
+  mRenderTask.SetCameraActor(mUiCamera);
+  mRenderTask.SetClearEnabled(false);
+  mRenderTask.SetSourceActor(mUiRoot);
+  mRenderTask.SetExclusive(true);
+
+  if(!isLandscape)
+  {
+    mUiCamera.RotateBy(Degree(90.0f), Vector3(0.0f, 0.0f, 1.0f));
+  }
+
+  mWindow.Add(mUiCamera);
+}
+
+void GameStatsOverlay::SetText(const std::string& text)
+{
+  if(mLabel)
+  {
+    mLabel.SetProperty(TextLabel::Property::TEXT, ToDaliString(text));
+  }
+}
@@ -0,0 +1,68 @@
+#ifndef GAME_STATS_OVERLAY_H
+#define GAME_STATS_OVERLAY_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit/public-api/controls/text-controls/text-label.h>
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/actors/camera-actor.h>
+#include <dali/public-api/adaptor-framework/window.h>
+#include <dali/public-api/render-tasks/render-task.h>
+
+#include <string>
+
+/**
+ * @brief The GameStatsOverlay class
+ * Displays a text overlay in the top left corner of the window. Like the tutorial
+ * UI it uses a dedicated exclusive RenderTask and camera, so it stays in place
+ * regardless of the game camera movement.
+ */
+class GameStatsOverlay
+{
+public:
+  /**
+   * Creates an instance of GameStatsOverlay
+   */
+  GameStatsOverlay();
+
+  /**
+   * Destroys an instance of GameStatsOverlay
+   */
+  ~GameStatsOverlay();
+
+  /**
+   * Creates overlay actors and the render task
+   * @param[in] window The window to display the overlay on
+   */
+  void Initialise(Dali::Window window);
+
+  /**
+   * Replaces the displayed text
+   * @param[in] text Text to display
+   */
+  void SetText(const std::string& text);
+
+private:
+  Dali::Window             mWindow;     /// The window displaying the overlay
+  Dali::RenderTask         mRenderTask; /// RenderTask dedicated to the overlay
+  Dali::Actor              mUiRoot;     /// The parent actor of the overlay UI
+  Dali::CameraActor        mUiCamera;   /// Camera dedicated to the overlay
+  Dali::Toolkit::TextLabel mLabel;      /// Text label displaying the statistics
+};
+
+#endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -65,6 +65,7 @@ bool GameTexture::Load(const char* filename)
   mSampler    = sampler;
   mTextureSet = textureSet;
 
+  mFilename = filename;
   mUniqueId = GameUtils::HashString(filename);
 
   mIsReady = true;
@@ -82,6 +83,16 @@ uint32_t GameTexture::GetUniqueId()
   return mUniqueId;
 }
 
+Dali::Texture& GameTexture::GetTexture()
+{
+  return mTexture;
+}
+
+const std::string& GameTexture::GetFilename() const
+{
+  return mFilename;
+}
+
 bool GameTexture::IsReady()
 {
   return mIsReady;
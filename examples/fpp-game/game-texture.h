@@ -2,7 +2,7 @@
 #define GAME_TEXTURE_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <dali/public-api/rendering/texture.h>
 
 #include <inttypes.h>
+#include <string>
 
 class GameTexture
 {
@@ -66,11 +67,25 @@ public:
    */
   uint32_t GetUniqueId();
 
+  /**
+   * @brief Returns DALi texture associated with the GameTexture
+   * @return Uploaded texture
+   */
+  Dali::Texture& GetTexture();
+
+  /**
+   * Returns path of the file the texture has been loaded from
+   * @return Path to the image file
+   */
+  const std::string& GetFilename() const;
+
 private:
   Dali::Texture    mTexture;
   Dali::Sampler    mSampler;
   Dali::TextureSet mTextureSet;
 
+  std::string mFilename;
+
   uint32_t mUniqueId;
 
   bool mIsReady;
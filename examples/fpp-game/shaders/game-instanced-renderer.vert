@@ -0,0 +1,24 @@
+//@version 100
+
+precision highp float;
+INPUT highp vec3 aPosition;
+INPUT highp vec3 aNormal;
+INPUT highp vec2 aTexCoord;
+
+UNIFORM_BLOCK VertBlock
+{
+  UNIFORM highp mat4 uMvpMatrix;
+  UNIFORM highp mat4 uInstanceMatrix[MAX_INSTANCES];
+  UNIFORM highp vec4 uInstanceUvRect[MAX_INSTANCES];
+};
+
+OUTPUT highp vec2 vTexCoord;
+
+void main()
+{
+  gl_Position = uMvpMatrix * uInstanceMatrix[INSTANCE_INDEX] * vec4(aPosition, 1.0);
+
+  // uv rect ( offset, scale ) selects the lightmap of the instance within the atlas
+  highp vec4 uvRect = uInstanceUvRect[INSTANCE_INDEX];
+  vTexCoord = uvRect.xy + clamp(vec2(aTexCoord.x, 1.0 - aTexCoord.y), 0.0, 1.0) * uvRect.zw;
+}
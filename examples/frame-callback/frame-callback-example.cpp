@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,9 @@
 
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali/integration-api/debug.h>
+#include <cstring>
+#include <memory>
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/string-utils.h>
@@ -41,6 +44,11 @@ Vector4     TEXT_COLOR_DISABLED(Color::RED);
 
 float ANIMATION_TIME(4.0f);
 float ANIMATION_PROGRESS_MULTIPLIER(0.02f);
+
+const uint32_t SCALING_TEST_ACTOR_COUNTS[] = {100u, 500u, 1000u, 5000u, 10000u, 50000u};
+const uint32_t SCALING_TEST_UPDATES(120u);      ///< Number of updates measured for every actor count and path.
+const uint32_t SCALING_TEST_POLL_INTERVAL(100u); ///< Interval in milliseconds at which the test checks the update count.
+const Vector3  SCALING_TEST_ACTOR_SIZE(32.0f, 32.0f, 0.0f);
 } // unnamed namespace
 
 /**
@@ -49,6 +57,12 @@ float ANIMATION_PROGRESS_MULTIPLIER(0.02f);
  * Creates a scene with several image-views which are animated from side-to-side.
  * With the frame-callback enabled, the image-views' sizes expand as they hits the sides and the opacity
  * changes to transparent as they go to the middle.
+ *
+ * Invoked with --batched the FrameCallback uses its batched path.
+ *
+ * Invoked with --scaling-test it measures the update thread time spent in the FrameCallback for
+ * 100 to 50,000 actors with both paths, logs the results and quits. The actors have no renderers,
+ * only the FrameCallback cost is of interest.
  */
 class FrameCallbackController : public ConnectionTracker
 {
@@ -57,12 +71,14 @@ public:
    * @brief Constructor.
    * @param[in]  application  The application.
    */
-  FrameCallbackController(Application& application)
+  FrameCallbackController(Application& application, bool batched, bool scalingTest)
   : mApplication(application),
     mFrameCallback(),
     mTextLabel(),
     mTapDetector(),
-    mFrameCallbackEnabled(false)
+    mFrameCallbackEnabled(false),
+    mBatched(batched),
+    mScalingTest(scalingTest)
   {
     // Connect to the Application's Init signal
     mApplication.InitSignal().Connect(this, &FrameCallbackController::Create);
@@ -84,10 +100,21 @@ private:
     window.SetBackgroundColor(Color::WHITE);
     window.KeyEventSignal().Connect(this, &FrameCallbackController::OnKeyEvent);
 
+    if(mScalingTest)
+    {
+      StartScalingTestStep();
+
+      mScalingTestTimer = Timer::New(SCALING_TEST_POLL_INTERVAL);
+      mScalingTestTimer.TickSignal().Connect(this, &FrameCallbackController::OnScalingTestTick);
+      mScalingTestTimer.Start();
+      return;
+    }
+
     // Notify mFrameCallback about the window width.
     // Can call methods in mFrameCallback directly as we have not set it on the window yet.
     Vector2 windowSize = Vector2(window.GetPositionSize().width, window.GetPositionSize().height);
     mFrameCallback.SetWindowWidth(windowSize.width);
+    mFrameCallback.SetBatched(mBatched);
 
     // Detect taps on the root layer.
     mTapDetector = TapGestureDetector::New();
@@ -160,6 +187,81 @@ private:
     mFrameCallbackEnabled = !mFrameCallbackEnabled;
   }
 
+  /**
+   * @brief Creates the actors for the current step of the scaling test and sets the FrameCallback on them.
+   */
+  void StartScalingTestStep()
+  {
+    Window   window     = mApplication.GetWindow();
+    Vector2  windowSize = Vector2(window.GetPositionSize().width, window.GetPositionSize().height);
+    uint32_t actorCount = SCALING_TEST_ACTOR_COUNTS[mScalingTestStep / 2u];
+    bool     batched    = mScalingTestStep % 2u;
+
+    // The callback of the previous step may still be used by the update thread until the removal is
+    // processed, so every step gets its own callback and the previous one is kept for one more step.
+    mRetiredScalingTestCallback = std::move(mScalingTestCallback);
+    mScalingTestCallback.reset(new FrameCallback());
+    mScalingTestCallback->SetWindowWidth(windowSize.width);
+    mScalingTestCallback->SetBatched(batched);
+    mScalingTestCallback->SetKeepRendering(true); // Nothing else is animating.
+
+    mScalingTestRoot = Actor::New();
+    mScalingTestRoot.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_CENTER);
+    mScalingTestRoot.SetProperty(Actor::Property::PIVOT, Pivot::TOP_CENTER);
+    for(uint32_t i = 0; i < actorCount; ++i)
+    {
+      Actor actor = Actor::New();
+      actor.SetProperty(Actor::Property::PIVOT, Pivot::TOP_CENTER);
+      actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_CENTER);
+      actor.SetProperty(Actor::Property::SIZE, SCALING_TEST_ACTOR_SIZE);
+      actor.SetProperty(Actor::Property::POSITION, Vector3(Random::Range(-windowSize.width, windowSize.width) * 0.5f, Random::Range(0.0f, windowSize.height), 0.0f));
+      mScalingTestCallback->AddId(actor.GetProperty<int>(Actor::Property::ID));
+      mScalingTestRoot.Add(actor);
+    }
+    window.Add(mScalingTestRoot);
+
+    UiContext::Get().AddFrameCallback(*mScalingTestCallback, mScalingTestRoot);
+    mScalingTestWarmUp = true;
+  }
+
+  /**
+   * @brief Called periodically during the scaling test.
+   *
+   * Discards the first updates of every step, which include the actor creation and the batched path's
+   * initial reads, then logs the average update time once enough updates were measured.
+   * @return Whether the timer should keep ticking.
+   */
+  bool OnScalingTestTick()
+  {
+    if(mScalingTestWarmUp)
+    {
+      mScalingTestCallback->ResetStatistics();
+      mScalingTestWarmUp = false;
+      return true;
+    }
+
+    if(mScalingTestCallback->GetUpdateCount() < SCALING_TEST_UPDATES)
+    {
+      return true;
+    }
+
+    UiContext::Get().RemoveFrameCallback(*mScalingTestCallback);
+    DALI_LOG_RELEASE_INFO("FrameCallback scaling test, actors: %u, path: %s, update time: %.1f us\n",
+                          SCALING_TEST_ACTOR_COUNTS[mScalingTestStep / 2u],
+                          (mScalingTestStep % 2u) ? "batched" : "per-actor",
+                          mScalingTestCallback->GetAverageUpdateTime());
+    UnparentAndReset(mScalingTestRoot);
+
+    if(++mScalingTestStep < std::extent<decltype(SCALING_TEST_ACTOR_COUNTS)>::value * 2u)
+    {
+      StartScalingTestStep();
+      return true;
+    }
+
+    mApplication.Quit();
+    return false;
+  }
+
   /**
    * @brief Called when any key event is received
    *
@@ -183,12 +285,35 @@ private:
   TextLabel          mTextLabel;            ///< Text label which shows whether the frame-callback is enabled/disabled.
   TapGestureDetector mTapDetector;          ///< Tap detector to enable/disable the FrameCallbackInterface.
   bool               mFrameCallbackEnabled; ///< Stores whether the FrameCallbackInterface is enabled/disabled.
+  bool               mBatched;              ///< Whether the FrameCallback uses its batched path.
+  bool               mScalingTest;          ///< Whether the scaling test is run instead of the example.
+
+  Timer                          mScalingTestTimer;           ///< Checks the progress of the scaling test.
+  Actor                          mScalingTestRoot;            ///< Parent of the actors of the current scaling test step.
+  std::unique_ptr<FrameCallback> mScalingTestCallback;        ///< FrameCallback of the current scaling test step.
+  std::unique_ptr<FrameCallback> mRetiredScalingTestCallback; ///< FrameCallback of the previous step, until the update thread no longer uses it.
+  uint32_t                       mScalingTestStep{0u};        ///< Current step, every actor count is measured with both paths.
+  bool                           mScalingTestWarmUp{false};   ///< Whether the statistics of the current step should be reset first.
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  bool batched     = false;
+  bool scalingTest = false;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i], "--batched") == 0)
+    {
+      batched = true;
+    }
+    else if(strcmp(argv[i], "--scaling-test") == 0)
+    {
+      scalingTest = true;
+    }
+  }
+
   Application             application = Application::New(&argc, &argv);
-  FrameCallbackController controller(application);
+  FrameCallbackController controller(application, batched, scalingTest);
   application.MainLoop();
   return 0;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,12 +18,21 @@
 // CLASS HEADER
 #include "frame-callback.h"
 
+// EXTERNAL INCLUDES
+#include <chrono>
+
 using namespace Dali;
 using namespace std;
 
 FrameCallback::FrameCallback()
 : mActorIdContainer(),
-  windowHalfWidth(0.0f)
+  windowHalfWidth(0.0f),
+  mUpdateCount(0u),
+  mUpdateTimeSum(0u),
+  mResetStatistics(false),
+  mResolved(false),
+  mBatched(false),
+  mKeepRendering(false)
 {
 }
 
@@ -35,9 +44,63 @@ void FrameCallback::SetWindowWidth(float windowWidth)
 void FrameCallback::AddId(uint32_t id)
 {
   mActorIdContainer.PushBack(id);
+  mResolved = false;
+}
+
+void FrameCallback::SetBatched(bool batched)
+{
+  mBatched  = batched;
+  mResolved = false;
+}
+
+void FrameCallback::SetKeepRendering(bool keepRendering)
+{
+  mKeepRendering = keepRendering;
+}
+
+void FrameCallback::ResetStatistics()
+{
+  mResetStatistics = true;
+}
+
+uint32_t FrameCallback::GetUpdateCount() const
+{
+  return mResetStatistics ? 0u : mUpdateCount.load();
+}
+
+float FrameCallback::GetAverageUpdateTime() const
+{
+  const uint32_t updateCount = GetUpdateCount();
+  return updateCount ? static_cast<float>(mUpdateTimeSum) / updateCount : 0.0f;
 }
 
 bool FrameCallback::Update(Dali::UpdateProxy& updateProxy, float /* elapsedSeconds */)
+{
+  if(mResetStatistics.exchange(false))
+  {
+    mUpdateCount   = 0u;
+    mUpdateTimeSum = 0u;
+  }
+
+  const auto startTime = chrono::steady_clock::now();
+
+  if(mBatched)
+  {
+    UpdateBatched(updateProxy);
+  }
+  else
+  {
+    UpdatePerActor(updateProxy);
+  }
+
+  mUpdateTimeSum += chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - startTime).count();
+  ++mUpdateCount;
+
+  // We don't need it to keep rendering unless nothing else is animating.
+  return mKeepRendering;
+}
+
+void FrameCallback::UpdatePerActor(Dali::UpdateProxy& updateProxy)
 {
   // Go through Actor ID container and check if we've hit the sides.
   for(auto&& i : mActorIdContainer)
@@ -67,7 +130,62 @@ bool FrameCallback::Update(Dali::UpdateProxy& updateProxy, float /* elapsedSecon
       }
     }
   }
+}
+
+void FrameCallback::UpdateBatched(Dali::UpdateProxy& updateProxy)
+{
+  // Until the actors have been laid out, fall back to reading their sizes every frame.
+  if(!mResolved && !(mResolved = ResolveActors(updateProxy)))
+  {
+    UpdatePerActor(updateProxy);
+    return;
+  }
+
+  // All the calls for an actor are consecutive, so only the first one searches for its node.
+  const size_t count = mResolvedIds.size();
+  for(size_t i = 0; i < count; ++i)
+  {
+    const uint32_t id = mResolvedIds[i];
+    Vector3        position;
+    updateProxy.GetPosition(id, position);
+
+    const float halfWidthPoint = windowHalfWidth - mBaseSizes[i].width * 0.5f;
+    const float xTranslation   = abs(position.x);
+    if(xTranslation > halfWidthPoint)
+    {
+      // Away from the edges the actor keeps its base size, which it reverts to every frame anyway.
+      const float adjustment = (xTranslation - halfWidthPoint) * SIZE_MULTIPLIER;
+      updateProxy.SetSize(id, Vector3(mBaseSizes[i].width + adjustment, mBaseSizes[i].height + adjustment, mBaseSizes[i].depth));
+    }
+
+    Vector4 color = mBaseColors[i];
+    color.a       = xTranslation / halfWidthPoint;
+    updateProxy.SetColor(id, color);
+  }
+}
+
+bool FrameCallback::ResolveActors(Dali::UpdateProxy& updateProxy)
+{
+  mResolvedIds.clear();
+  mBaseSizes.clear();
+  mBaseColors.clear();
+
+  bool complete = true;
+  for(auto&& i : mActorIdContainer)
+  {
+    Vector3 size;
+    Vector4 color;
+    if(updateProxy.GetSize(i, size) && updateProxy.GetColor(i, color) && size.width > 0.0f)
+    {
+      mResolvedIds.push_back(i);
+      mBaseSizes.push_back(size);
+      mBaseColors.push_back(color);
+    }
+    else
+    {
+      complete = false;
+    }
+  }
 
-  // We don't need it to keep rendering.
-  return false;
+  return complete;
 }
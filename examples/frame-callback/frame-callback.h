@@ -20,14 +20,25 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
 #include <dali/public-api/update/frame-callback-interface.h>
 #include <dali/public-api/update/update-proxy.h>
+#include <atomic>
+#include <vector>
 
 /**
  * @brief Implementation of the FrameCallbackInterface.
  *
  * When this is used, it will expand the size of the actors the closer they get to the horizontal edge
  * and make the actor transparent the closer it gets to the middle.
+ *
+ * Two paths are provided:
+ *  - Per-actor: the size and color are read back from the UpdateProxy for every actor, every frame.
+ *  - Batched: the base size and color of every actor are read once, after that only the position of
+ *    every actor is read and its new size and color are written straight away, so consecutive
+ *    UpdateProxy calls use the same actor ID and hit its cached node. The size is only written when it
+ *    differs from the base size.
  */
 class FrameCallback : public Dali::FrameCallbackInterface
 {
@@ -49,6 +60,36 @@ public:
    */
   void AddId(uint32_t id);
 
+  /**
+   * @brief Sets whether the batched path is used.
+   * @param[in]  batched  Whether to use the batched path.
+   * @note Must not be called while the FrameCallback is set.
+   */
+  void SetBatched(bool batched);
+
+  /**
+   * @brief Sets whether Update() should request further updates, needed when nothing else is animating.
+   * @param[in]  keepRendering  Whether to keep rendering.
+   */
+  void SetKeepRendering(bool keepRendering);
+
+  /**
+   * @brief Resets the update time statistics, can be called while the FrameCallback is set.
+   */
+  void ResetStatistics();
+
+  /**
+   * @brief Retrieves the number of Update() calls since the statistics were reset.
+   * @return The number of updates.
+   */
+  uint32_t GetUpdateCount() const;
+
+  /**
+   * @brief Retrieves the average time spent in Update() since the statistics were reset.
+   * @return The average update time in microseconds.
+   */
+  float GetAverageUpdateTime() const;
+
 private:
   /**
    * @brief Called when every frame is updated.
@@ -58,10 +99,40 @@ private:
    */
   virtual bool Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds);
 
+  /**
+   * @brief Reads and writes the properties of every actor separately.
+   * @param[in]  updateProxy  Used to set the world-matrix and sizes.
+   */
+  void UpdatePerActor(Dali::UpdateProxy& updateProxy);
+
+  /**
+   * @brief Reads the position and writes the size and color of every actor in a single pass.
+   * @param[in]  updateProxy  Used to set the world-matrix and sizes.
+   */
+  void UpdateBatched(Dali::UpdateProxy& updateProxy);
+
+  /**
+   * @brief Reads the base sizes and colors of the actors for the batched path.
+   * @param[in]  updateProxy  Used to read the sizes and colors.
+   * @return Whether all the actors were found and have their size set.
+   */
+  bool ResolveActors(Dali::UpdateProxy& updateProxy);
+
 private:
   Dali::Vector<uint32_t> mActorIdContainer; ///< Container of Actor IDs.
   float                  windowHalfWidth;   ///< Half the width of the window. Center is 0,0 in the world matrix.
 
+  std::vector<uint32_t>      mResolvedIds; ///< IDs of the actors found in the scene, same order as the arrays below.
+  std::vector<Dali::Vector3> mBaseSizes;   ///< Sizes of the actors before the FrameCallback changes them.
+  std::vector<Dali::Vector4> mBaseColors;  ///< Colors of the actors before the FrameCallback changes them.
+
+  std::atomic<uint32_t> mUpdateCount;     ///< Number of updates since the statistics were reset.
+  std::atomic<uint64_t> mUpdateTimeSum;   ///< Time spent in the updates since the statistics were reset, in microseconds.
+  std::atomic<bool>     mResetStatistics; ///< Set by the event thread, the statistics are reset on the next update.
+  bool                  mResolved;        ///< Whether the base sizes and colors have been read.
+  bool                  mBatched;         ///< Whether the batched path is used.
+  std::atomic<bool>     mKeepRendering;   ///< Whether Update() requests further updates.
+
   constexpr static float SIZE_MULTIPLIER = 2.0f; ///< Multiplier for the size to set as the actors hit the edge.
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,12 +18,21 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali/integration-api/string-utils.h>
+
+// INTERNAL INCLUDES
+#include "shared/frame-time-callback.h"
+#include "shared/process-memory.h"
+
 using Dali::Integration::GetStdString;
 using Dali::Integration::ToDaliString;
 using Dali::Integration::ToDaliStringView;
@@ -57,6 +66,14 @@ const bool     DEFAULT_OPT_USE_TABLEVIEW(true);
 const bool     DEFAULT_OPT_ICON_LABELS(true);
 const IconType DEFAULT_OPT_ICON_TYPE(IMAGEVIEW);
 const bool     DEFAULT_OPT_USE_TEXT_LABEL(false);
+const bool     DEFAULT_OPT_VIRTUALIZED(false);
+const bool     DEFAULT_OPT_ATLASING(false);
+
+// Number of pages materialised in the virtualized mode: the visible page and its neighbours
+const int VIRTUALIZED_PAGE_COUNT(3);
+
+// Scroll distance ( relative to the page width ) after which the materialised pages are updated
+const float VIRTUALIZED_UPDATE_STEP(0.25f);
 
 // The image/label area tries to make sure the positioning will be relative to previous sibling
 const float IMAGE_AREA(0.60f);
@@ -87,6 +104,12 @@ void PrintHelp(const char* const opt, const char* const optDescription)
 
 /**
  * @brief This example is a benchmark that mimics the paged applications list of the homescreen application.
+ *
+ * By default all pages are created up front. With --virtualize only the visible page and its
+ * neighbours exist, the page actors and their visuals are recycled as the pages scroll.
+ * Creation time, memory usage and frame times are logged when the script ends, so both modes
+ * can be compared for different page counts, ie. -p10, -p50 and -p200. With --atlas the icon
+ * images are loaded into the toolkit's texture atlas, which image visuals don't use by default.
  */
 class HomescreenBenchmark : public ConnectionTracker
 {
@@ -102,7 +125,9 @@ public:
       mTableViewEnabled(DEFAULT_OPT_USE_TABLEVIEW),
       mIconLabelsEnabled(DEFAULT_OPT_ICON_LABELS),
       mIconType(DEFAULT_OPT_ICON_TYPE),
-      mUseTextLabel(DEFAULT_OPT_USE_TEXT_LABEL)
+      mUseTextLabel(DEFAULT_OPT_USE_TEXT_LABEL),
+      mVirtualized(DEFAULT_OPT_VIRTUALIZED),
+      mAtlasing(DEFAULT_OPT_ATLASING)
     {
     }
 
@@ -113,6 +138,17 @@ public:
     bool     mIconLabelsEnabled;
     IconType mIconType;
     bool     mUseTextLabel;
+    bool     mVirtualized;
+    bool     mAtlasing;
+  };
+
+  // page actor and its content, recycled in the virtualized mode
+  struct Page
+  {
+    Actor              mActor;  ///< Root actor of the page
+    std::vector<Actor> mIcons;  ///< Icons ( ImageView or CheckBoxButton )
+    std::vector<Actor> mLabels; ///< Labels of the icons, empty if the labels are disabled
+    int                mIndex;  ///< Index of the page currently shown
   };
 
   // animation script data
@@ -134,7 +170,11 @@ public:
   : mApplication(application),
     mConfig(config),
     mScriptFrame(0),
-    mCurrentPage(0)
+    mCurrentPage(0),
+    mPageWidth(0.0f),
+    mLabelPointSize(0.0f),
+    mCreationTime(0.0f),
+    mCreationMemory(0u)
   {
     // Connect to the Application's Init signal.
     mApplication.InitSignal().Connect(this, &HomescreenBenchmark::Create);
@@ -169,6 +209,8 @@ public:
 
     window.Add(mScrollParent);
 
+    UiContext::Get().AddFrameCallback(mFrameTimeCallback, window.GetRootLayer());
+
     // Respond to a click anywhere on the window.
     window.TouchEventSignal().Connect(this, &HomescreenBenchmark::OnTouch);
 
@@ -205,18 +247,40 @@ public:
     return pageActor;
   }
 
-  Toolkit::ImageView CreateImageView(const unsigned int currentIconIndex)
+  int GetIconIndex(int pageIndex, int iconInPage) const
   {
-    // Create empty image to avoid early renderer creation
-    Toolkit::ImageView imageView = Toolkit::ImageView::New();
+    // We only have images and names for a certain number of icons.
+    // Wrap around if we have used them all.
+    return (pageIndex * mConfig.mRows * mConfig.mCols + iconInPage) % TOTAL_ICON_DEFINITIONS;
+  }
 
+  Property::Map CreateImageMap(const unsigned int currentIconIndex)
+  {
     // Auto-generate the Icons image URL.
     Property::Map     map;
     std::stringstream imagePath;
     imagePath << IMAGE_PATH_PREFIX << currentIconIndex << IMAGE_PATH_POSTFIX;
     map[Dali::Toolkit::ImageVisual::Property::URL] = ToDaliString(imagePath.str());
+    if(mConfig.mAtlasing)
+    {
+      map[Dali::Toolkit::ImageVisual::Property::ATLASING] = true;
+    }
+    return map;
+  }
 
-    imageView.SetProperty(Toolkit::ImageView::Property::IMAGE, map);
+  Property::Map CreateTextVisualMap(const unsigned int currentIconIndex)
+  {
+    Property::Map map;
+    map.Add(Toolkit::Visual::Property::TYPE, Toolkit::Visual::TEXT).Add(Toolkit::TextVisual::Property::TEXT, DEMO_APPS_NAMES[currentIconIndex]).Add(Toolkit::TextVisual::Property::TEXT_COLOR, Color::WHITE).Add(Toolkit::TextVisual::Property::POINT_SIZE, mLabelPointSize).Add(Toolkit::TextVisual::Property::HORIZONTAL_ALIGNMENT, "CENTER").Add(Toolkit::TextVisual::Property::VERTICAL_ALIGNMENT, "TOP");
+    return map;
+  }
+
+  Toolkit::ImageView CreateImageView(const unsigned int currentIconIndex)
+  {
+    // Create empty image to avoid early renderer creation
+    Toolkit::ImageView imageView = Toolkit::ImageView::New();
+
+    imageView.SetProperty(Toolkit::ImageView::Property::IMAGE, CreateImageMap(currentIconIndex));
     DevelActor::SetResizePolicy(imageView, ResizePolicy::SIZE_RELATIVE_TO_PARENT, Dimension::ALL_DIMENSIONS);
     imageView.SetProperty(DevelActor::Property::SIZE_SCALE_POLICY, SizeScalePolicy::FIT_WITH_ASPECT_RATIO);
     imageView.SetProperty(Actor::Property::PIVOT, Pivot::CENTER);
@@ -238,7 +302,7 @@ public:
     return button;
   }
 
-  void AddIconsToPage(Actor page, bool useTextLabel)
+  void AddIconsToPage(Page& page, bool useTextLabel)
   {
     Window window = mApplication.GetWindow();
 
@@ -251,12 +315,14 @@ public:
 
     Vector2 dpi = window.GetDpi();
 
-    static int currentIconIndex = 0;
+    mLabelPointSize = ((static_cast<float>(ROW_HEIGHT * LABEL_AREA) * 72.0f) / dpi.y) * 0.25f;
 
     for(int y = 0; y < mConfig.mRows; ++y)
     {
       for(int x = 0; x < mConfig.mCols; ++x)
       {
+        const int currentIconIndex = GetIconIndex(page.mIndex, y * mConfig.mCols + x);
+
         // Create parent icon view
         Toolkit::Control iconView = Toolkit::Control::New();
         iconView.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
@@ -301,37 +367,108 @@ public:
             textLabel.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
             DevelActor::SetResizePolicy(textLabel, ResizePolicy::USE_NATURAL_SIZE, Dimension::ALL_DIMENSIONS);
             textLabel.SetProperty(Toolkit::TextLabel::Property::TEXT_COLOR, Vector4(1.0f, 1.0f, 1.0f, 1.0f)); // White.
-            textLabel.SetProperty(Toolkit::TextLabel::Property::POINT_SIZE, ((static_cast<float>(ROW_HEIGHT * LABEL_AREA) * 72.0f) / dpi.y) * 0.25f);
+            textLabel.SetProperty(Toolkit::TextLabel::Property::POINT_SIZE, mLabelPointSize);
             textLabel.SetProperty(Toolkit::TextLabel::Property::HORIZONTAL_ALIGNMENT, "CENTER");
             textLabel.SetProperty(Toolkit::TextLabel::Property::VERTICAL_ALIGNMENT, "TOP");
             icon.Add(textLabel);
+            page.mLabels.push_back(textLabel);
           }
           else
           {
-            Property::Map map;
-            map.Add(Toolkit::Visual::Property::TYPE, Toolkit::Visual::TEXT).Add(Toolkit::TextVisual::Property::TEXT, DEMO_APPS_NAMES[currentIconIndex]).Add(Toolkit::TextVisual::Property::TEXT_COLOR, Color::WHITE).Add(Toolkit::TextVisual::Property::POINT_SIZE, ((static_cast<float>(ROW_HEIGHT * LABEL_AREA) * 72.0f) / dpi.y) * 0.25f).Add(Toolkit::TextVisual::Property::HORIZONTAL_ALIGNMENT, "CENTER").Add(Toolkit::TextVisual::Property::VERTICAL_ALIGNMENT, "TOP");
-
             Toolkit::Control control = Toolkit::Control::New();
-            control.SetProperty(Toolkit::Control::Property::BACKGROUND, map);
+            control.SetProperty(Toolkit::Control::Property::BACKGROUND, CreateTextVisualMap(currentIconIndex));
             control.SetProperty(Actor::Property::PIVOT, Pivot::TOP_CENTER);
             control.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
             icon.Add(control);
+            page.mLabels.push_back(control);
           }
         }
 
         iconView.Add(icon);
-        page.Add(iconView);
+        page.mActor.Add(iconView);
+        page.mIcons.push_back(icon);
+      }
+    }
+  }
+
+  /**
+   * Shows the content of another page on the existing page actor, reusing all its actors and visuals
+   */
+  void RecyclePage(Page& page, int pageIndex)
+  {
+    page.mIndex = pageIndex;
+    page.mActor.SetProperty(Actor::Property::POSITION, Vector3(mPageWidth * pageIndex, 0.0f, 0.0f));
+
+    for(size_t i = 0; i < page.mIcons.size(); ++i)
+    {
+      const int currentIconIndex = GetIconIndex(pageIndex, static_cast<int>(i));
 
-        // We only have images and names for a certain number of icons.
-        // Wrap around if we have used them all.
-        if(++currentIconIndex == TOTAL_ICON_DEFINITIONS)
+      switch(mConfig.mIconType)
+      {
+        case CHECKBOX:
+        {
+          page.mIcons[i].SetProperty(Toolkit::Button::Property::SELECTED, (currentIconIndex % 2 == 0));
+          break;
+        }
+        case IMAGEVIEW:
         {
-          currentIconIndex = 0;
+          page.mIcons[i].SetProperty(Toolkit::ImageView::Property::IMAGE, CreateImageMap(currentIconIndex));
+          break;
         }
       }
+
+      if(i < page.mLabels.size())
+      {
+        if(mConfig.mUseTextLabel)
+        {
+          page.mLabels[i].SetProperty(Toolkit::TextLabel::Property::TEXT, DEMO_APPS_NAMES[currentIconIndex]);
+        }
+        else
+        {
+          page.mLabels[i].SetProperty(Toolkit::Control::Property::BACKGROUND, CreateTextVisualMap(currentIconIndex));
+        }
+      }
+    }
+  }
+
+  /**
+   * Makes sure the page closest to the given one and its neighbours are materialised
+   */
+  void UpdateVirtualPages(int centerPage)
+  {
+    const int firstPage = std::max(0, centerPage - 1);
+    const int lastPage  = std::min(mConfig.mPageCount - 1, centerPage + 1);
+
+    std::vector<Page*> freePages;
+    std::vector<bool>  shownPages(lastPage - firstPage + 1, false);
+    for(Page& page : mPages)
+    {
+      if(page.mIndex >= firstPage && page.mIndex <= lastPage)
+      {
+        shownPages[page.mIndex - firstPage] = true;
+      }
+      else
+      {
+        freePages.push_back(&page);
+      }
+    }
+
+    for(int pageIndex = firstPage; pageIndex <= lastPage && !freePages.empty(); ++pageIndex)
+    {
+      if(!shownPages[pageIndex - firstPage])
+      {
+        RecyclePage(*freePages.back(), pageIndex);
+        freePages.pop_back();
+      }
     }
   }
 
+  void OnScrollPositionChanged(PropertyNotification& source)
+  {
+    const float scrollPosition = mScrollParent.GetCurrentProperty<float>(Actor::Property::POSITION_X);
+    UpdateVirtualPages(static_cast<int>(roundf(-scrollPosition / mPageWidth)));
+  }
+
   void CreateScript()
   {
     const int lastPage = mConfig.mPageCount - 1;
@@ -356,24 +493,43 @@ public:
 
   void PopulatePages()
   {
-    auto    positionSize = mApplication.GetWindow().GetPositionSize();
-    Vector3 windowSize(positionSize.width, positionSize.height, 0.0f);
+    const auto startTime = std::chrono::steady_clock::now();
+
+    auto positionSize = mApplication.GetWindow().GetPositionSize();
+    mPageWidth        = positionSize.width;
 
-    for(int i = 0; i < mConfig.mPageCount; ++i)
+    // In the virtualized mode only the visible page and its neighbours are created
+    const int pageCount = mConfig.mVirtualized ? std::min(mConfig.mPageCount, VIRTUALIZED_PAGE_COUNT) : mConfig.mPageCount;
+    mPages.reserve(pageCount);
+
+    for(int i = 0; i < pageCount; ++i)
     {
       // Create page.
-      Actor page = AddPage();
+      Page page;
+      page.mActor = AddPage();
+      page.mIndex = i;
 
       // Populate icons.
       AddIconsToPage(page, mConfig.mUseTextLabel);
 
       // Move page 'a little bit up'.
-      page.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-      page.SetProperty(Actor::Property::PIVOT, Pivot::CENTER);
-      page.SetProperty(Actor::Property::POSITION, Vector3(windowSize.x * i, 0.0f, 0.0f));
-      mScrollParent.Add(page);
+      page.mActor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+      page.mActor.SetProperty(Actor::Property::PIVOT, Pivot::CENTER);
+      page.mActor.SetProperty(Actor::Property::POSITION, Vector3(mPageWidth * i, 0.0f, 0.0f));
+      mScrollParent.Add(page.mActor);
+      mPages.push_back(page);
     }
 
+    if(mConfig.mVirtualized && mConfig.mPageCount > pageCount)
+    {
+      // Recycle pages as the scroll parent moves
+      mScrollNotification = mScrollParent.AddPropertyNotification(Actor::Property::POSITION_X, StepCondition(mPageWidth * VIRTUALIZED_UPDATE_STEP, 0.0f));
+      mScrollNotification.NotifySignal().Connect(this, &HomescreenBenchmark::OnScrollPositionChanged);
+    }
+
+    mCreationTime   = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    mCreationMemory = DemoHelper::GetProcessMemoryKb("VmRSS:");
+
     mScrollParent.SetProperty(Actor::Property::OPACITY, 1.0f);
     mScrollParent.SetProperty(Actor::Property::SCALE, Vector3::ONE);
 
@@ -413,8 +569,28 @@ public:
     mCurrentPage += pages;
   }
 
+  void PrintReport()
+  {
+    DALI_LOG_RELEASE_INFO("Homescreen benchmark ( %s, %s, %d pages ): creation %.2f ms, memory after creation %lu kB, peak memory %lu kB, frames %u, average frame %.2f ms, max frame %.2f ms\n",
+                          mConfig.mVirtualized ? "virtualized" : "all pages",
+                          mConfig.mAtlasing ? "atlased" : "not atlased",
+                          mConfig.mPageCount,
+                          mCreationTime,
+                          mCreationMemory,
+                          DemoHelper::GetProcessMemoryKb("VmHWM:"),
+                          mFrameTimeCallback.GetFrameCount(),
+                          mFrameTimeCallback.GetAverageMilliseconds(),
+                          mFrameTimeCallback.GetMaxMilliseconds());
+  }
+
   void OnAnimationEnd(Animation source)
   {
+    if(mScriptFrame == 0)
+    {
+      // Measure frame times of the scroll script only
+      mFrameTimeCallback.Reset();
+    }
+
     if(mScriptFrame < mScriptFrameData.size())
     {
       ScriptData& frame = mScriptFrameData[mScriptFrame];
@@ -423,6 +599,7 @@ public:
     }
     else
     {
+      PrintReport();
       mApplication.Quit();
     }
   }
@@ -439,14 +616,21 @@ public:
   }
 
 private:
-  Application&            mApplication;
-  Actor                   mScrollParent;
-  Animation               mShowAnimation;
-  Animation               mScrollAnimation;
-  Config                  mConfig;
-  std::vector<ScriptData> mScriptFrameData;
-  size_t                  mScriptFrame;
-  int                     mCurrentPage;
+  Application&                  mApplication;
+  Actor                         mScrollParent;
+  Animation                     mShowAnimation;
+  Animation                     mScrollAnimation;
+  Config                        mConfig;
+  std::vector<ScriptData>       mScriptFrameData;
+  std::vector<Page>             mPages;
+  PropertyNotification          mScrollNotification;
+  DemoHelper::FrameTimeCallback mFrameTimeCallback;
+  size_t                        mScriptFrame;
+  int                           mCurrentPage;
+  float                         mPageWidth;
+  float                         mLabelPointSize;
+  float                         mCreationTime;
+  unsigned long                 mCreationMemory;
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
@@ -487,6 +671,14 @@ int DALI_EXPORT_API main(int argc, char** argv)
     {
       config.mUseTextLabel = true;
     }
+    else if(arg.compare("--virtualize") == 0)
+    {
+      config.mVirtualized = true;
+    }
+    else if(arg.compare("--atlas") == 0)
+    {
+      config.mAtlasing = true;
+    }
     else if(arg.compare("--help") == 0)
     {
       printHelpAndExit = true;
@@ -505,6 +697,8 @@ int DALI_EXPORT_API main(int argc, char** argv)
     PrintHelp("-disable-icon-labels", " Disables labels for each icon");
     PrintHelp("-use-checkbox", " Uses checkboxes for icons");
     PrintHelp("-use-text-label", " Uses TextLabel instead of a TextVisual");
+    PrintHelp("-virtualize", " Creates only the visible page and its neighbours, recycles them while scrolling");
+    PrintHelp("-atlas", " Loads the icon images into the texture atlas");
     return 0;
   }
 
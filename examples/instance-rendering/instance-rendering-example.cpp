@@ -20,6 +20,12 @@
 #include <shared/utility.h>
 
 #include <dali/devel-api/rendering/renderer-devel.h>
+#include <dali/integration-api/debug.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -28,13 +34,19 @@ namespace
 {
 constexpr uint32_t INSTANCE_COUNT_MAX               = 4096; ///< Maximum number of array size for vec2.
 constexpr uint32_t INSTANCE_COUNT_PER_DRAW          = 2048;
+constexpr uint32_t INSTANCE_COUNT_LIMIT             = 200000; ///< Maximum number of instances set by --instances.
 constexpr uint32_t FIRST_INSTANCE_CHANGE_PER_SECOND = 100;
 
+constexpr uint32_t INSTANCES_PER_CHUNK         = 4096; ///< Instances sharing a single instance vertex buffer and draw call.
+constexpr uint32_t CHANGED_INSTANCES_PER_FRAME = 512;  ///< Instances moved every frame in the instance buffer test.
+constexpr uint32_t INSTANCE_UPDATE_INTERVAL_MS = 16;
+constexpr uint32_t STATISTICS_FRAMES           = 300; ///< Frames between the upload statistics logs.
+
 constexpr uint32_t VIEW_SIZE = 32;
 
-Geometry CreateVertexQuadGeometry()
+VertexBuffer CreateQuadVertexBuffer()
 {
-  // Create geometry -- unit square with whole of the texture mapped to it.
+  // Unit square with whole of the texture mapped to it.
   struct Vertex
   {
     Vector3 aPosition;
@@ -50,13 +62,38 @@ Geometry CreateVertexQuadGeometry()
   VertexBuffer vertexBuffer = VertexBuffer::New(Property::Map()
                                                   .Add("aPosition", Property::VECTOR3));
   vertexBuffer.SetData(vertexData, std::extent<decltype(vertexData)>::value);
+  return vertexBuffer;
+}
 
+Geometry CreateVertexQuadGeometry()
+{
+  // Create geometry -- unit square with whole of the texture mapped to it.
   Geometry geometry = Geometry::New();
-  geometry.AddVertexBuffer(vertexBuffer);
+  geometry.AddVertexBuffer(CreateQuadVertexBuffer());
   geometry.SetType(Geometry::TRIANGLE_STRIP);
   return geometry;
 }
 
+/**
+ * Per instance data, stored in instance vertex buffers with a divisor of 1
+ */
+struct InstanceData
+{
+  Vector2 aInstanceOffset;
+  Vector4 aInstanceColor;
+};
+
+/**
+ * Instances drawn by a single renderer, its vertex buffer is uploaded only when an instance changed
+ */
+struct InstanceChunk
+{
+  VertexBuffer instanceBuffer;
+  uint32_t     firstInstance{0u};
+  uint32_t     instanceCount{0u};
+  bool         dirty{false};
+};
+
 Geometry Create16BitIndexQuadGeometry()
 {
   // Create geometry with 16bit index -- unit square with whole of the texture mapped to it.
@@ -120,6 +157,7 @@ enum TestType
   TEST_INSTANCE_RENDERING_WITH_VERTEX_GEOMETRY,
   TEST_INSTANCE_RENDERING_WITH_16BIT_INDEX_GEOMETRY,
   TEST_INSTANCE_RENDERING_WITH_32BIT_INDEX_GEOMETRY,
+  TEST_INSTANCE_RENDERING_WITH_INSTANCE_BUFFER,
 
   TEST_MAX,
 };
@@ -129,6 +167,7 @@ enum TestType
 #include <dali/public-api/rendering/uniform-block.h>
 
 #include <dali/integration-api/string-utils.h>
+#include "generated/instance-buffer-rendering-vert.h"
 #include "generated/instance-rendering-frag.h"
 #include "generated/instance-rendering-vert.h"
 #include "generated/not-instance-rendering-vert.h"
@@ -147,8 +186,10 @@ using Dali::Toolkit::TextLabel;
 class InstanceRenderingController : public ConnectionTracker
 {
 public:
-  InstanceRenderingController(Application& application)
-  : mApplication(application)
+  InstanceRenderingController(Application& application, uint32_t instanceCount, bool instanceBuffer)
+  : mApplication(application),
+    mInstanceCount(instanceCount),
+    mTestNumber(instanceBuffer ? TestType::TEST_INSTANCE_RENDERING_WITH_INSTANCE_BUFFER : TestType::TEST_MULTIPLE_RENDERER)
   {
     // Connect to the Application's Init signal
     mApplication.InitSignal().Connect(this, &InstanceRenderingController::Create);
@@ -178,9 +219,9 @@ public:
     offsetXRange      = static_cast<uint16_t>((positionSize.width - VIEW_SIZE) / 2);
     offsetYRange      = static_cast<uint16_t>((positionSize.height - VIEW_SIZE) / 2);
 
-    CreateShader(TestType::TEST_MULTIPLE_RENDERER);
-    CreateGeometry(TestType::TEST_MULTIPLE_RENDERER);
-    CreateRenderer(TestType::TEST_MULTIPLE_RENDERER);
+    CreateShader(mTestNumber);
+    CreateGeometry(mTestNumber);
+    CreateRenderer(mTestNumber);
 
     window.GetRootLayer().Add(mActor);
 
@@ -195,7 +236,7 @@ public:
     mLabel.SetBackgroundColor(Vector4(1.0f, 1.0f, 1.0f, 0.5f));
     window.GetRootLayer().Add(mLabel);
 
-    UpdateLabel(TestType::TEST_MULTIPLE_RENDERER);
+    UpdateLabel(mTestNumber);
 
     // Respond to a touch anywhere on the window
     window.TouchEventSignal().Connect(this, &InstanceRenderingController::OnTouch);
@@ -211,11 +252,10 @@ public:
 
   void OnTouch(Window window, TouchEvent touch)
   {
-    static int testNumber = 0;
     if(touch.GetState(0) == PointState::STARTED)
     {
-      testNumber++;
-      if(testNumber >= TestType::TEST_MAX)
+      mTestNumber++;
+      if(mTestNumber >= TestType::TEST_MAX)
       {
         mApplication.Quit();
         return;
@@ -224,11 +264,11 @@ public:
       offsetXRange      = static_cast<uint16_t>((positionSize.width - VIEW_SIZE) / 2);
       offsetYRange      = static_cast<uint16_t>((positionSize.height - VIEW_SIZE) / 2);
 
-      CreateShader(testNumber);
-      CreateGeometry(testNumber);
-      CreateRenderer(testNumber);
+      CreateShader(mTestNumber);
+      CreateGeometry(mTestNumber);
+      CreateRenderer(mTestNumber);
 
-      UpdateLabel(testNumber);
+      UpdateLabel(mTestNumber);
 
       for(uint32_t i = 0; i < INSTANCE_COUNT_MAX; ++i)
       {
@@ -263,7 +303,7 @@ public:
 
   void CreateShader(int testNumber)
   {
-    if(mShader)
+    if(mShader && mUniformBlocksConnected)
     {
       mUniformBlocks.DisconnectFromShader(mShader);
     }
@@ -289,10 +329,21 @@ public:
                               ToDaliString(SHADER_INSTANCE_RENDERING_FRAG));
         break;
       }
+      case TestType::TEST_INSTANCE_RENDERING_WITH_INSTANCE_BUFFER:
+      {
+        // Offsets and colors come from the instance vertex buffers, the shared block isn't used
+        mShader = Shader::New(ToDaliString(SHADER_INSTANCE_BUFFER_RENDERING_VERT),
+                              ToDaliString(SHADER_INSTANCE_RENDERING_FRAG));
+        break;
+      }
     }
     // Create shaders
 
-    mUniformBlocks.ConnectToShader(mShader);
+    mUniformBlocksConnected = testNumber != TestType::TEST_INSTANCE_RENDERING_WITH_INSTANCE_BUFFER;
+    if(mUniformBlocksConnected)
+    {
+      mUniformBlocks.ConnectToShader(mShader);
+    }
   }
 
   void CreateGeometry(int testNumber)
@@ -302,6 +353,7 @@ public:
     {
       case TestType::TEST_MULTIPLE_RENDERER:
       case TestType::TEST_INSTANCE_RENDERING_WITH_VERTEX_GEOMETRY:
+      case TestType::TEST_INSTANCE_RENDERING_WITH_INSTANCE_BUFFER:
       default:
       {
         mGeometry = CreateVertexQuadGeometry();
@@ -326,10 +378,17 @@ public:
     {
       mActor.RemoveRenderer(i - 1);
     }
+    if(mTimer)
+    {
+      mTimer.Stop();
+      mTimer.Reset();
+    }
+    mChunks.clear();
+    mInstanceData.clear();
 
     if(testNumber == TestType::TEST_MULTIPLE_RENDERER)
     {
-      for(uint32_t i = 0; i < INSTANCE_COUNT_PER_DRAW; ++i)
+      for(uint32_t i = 0; i < mInstanceCount; ++i)
       {
         mRenderer = Renderer::New(mGeometry, mShader);
 
@@ -341,17 +400,122 @@ public:
         mActor.AddRenderer(mRenderer);
       }
     }
+    else if(testNumber == TestType::TEST_INSTANCE_RENDERING_WITH_INSTANCE_BUFFER)
+    {
+      CreateInstanceBufferRenderers();
+    }
     else
     {
       mRenderer = Renderer::New(mGeometry, mShader);
 
-      mRenderer[DevelRenderer::Property::INSTANCE_COUNT] = static_cast<int32_t>(INSTANCE_COUNT_PER_DRAW);
+      mRenderer[DevelRenderer::Property::INSTANCE_COUNT] = static_cast<int32_t>(mInstanceCount);
+
+      // Increase update area extents, for partial rendering.
+      mRenderer[DevelRenderer::Property::UPDATE_AREA_MARGIN] = Dali::Extents(offsetXRange, offsetXRange, offsetYRange, offsetYRange);
+
+      mActor.AddRenderer(mRenderer);
+    }
+  }
+
+  /**
+   * Splits the instances into chunks, every chunk is drawn by a single instanced renderer
+   * with its own instance vertex buffer. DALi uploads a vertex buffer as a whole, so the
+   * chunks keep the uploads limited to the instances that changed.
+   */
+  void CreateInstanceBufferRenderers()
+  {
+    mInstanceData.resize(mInstanceCount);
+    for(uint32_t i = 0; i < mInstanceCount; ++i)
+    {
+      mInstanceData[i] = CreateInstanceData();
+    }
+
+    // The quad is shared by all chunks, only the instance buffers differ
+    VertexBuffer quadBuffer = CreateQuadVertexBuffer();
+    for(uint32_t firstInstance = 0; firstInstance < mInstanceCount; firstInstance += INSTANCES_PER_CHUNK)
+    {
+      InstanceChunk chunk;
+      chunk.firstInstance  = firstInstance;
+      chunk.instanceCount  = std::min(INSTANCES_PER_CHUNK, mInstanceCount - firstInstance);
+      chunk.instanceBuffer = VertexBuffer::New(Property::Map()
+                                                 .Add("aInstanceOffset", Property::VECTOR2)
+                                                 .Add("aInstanceColor", Property::VECTOR4));
+      chunk.instanceBuffer.SetDivisor(1u);
+      chunk.instanceBuffer.SetData(&mInstanceData[firstInstance], chunk.instanceCount);
+
+      Geometry geometry = Geometry::New();
+      geometry.AddVertexBuffer(quadBuffer);
+      geometry.AddVertexBuffer(chunk.instanceBuffer);
+      geometry.SetType(Geometry::TRIANGLE_STRIP);
+
+      mRenderer = Renderer::New(geometry, mShader);
+
+      mRenderer[DevelRenderer::Property::INSTANCE_COUNT] = static_cast<int32_t>(chunk.instanceCount);
 
       // Increase update area extents, for partial rendering.
       mRenderer[DevelRenderer::Property::UPDATE_AREA_MARGIN] = Dali::Extents(offsetXRange, offsetXRange, offsetYRange, offsetYRange);
 
       mActor.AddRenderer(mRenderer);
+      mChunks.push_back(chunk);
+    }
+
+    mChangedInstance   = 0u;
+    mUploadFrames      = 0u;
+    mUploadedChunks    = 0u;
+    mUploadedInstances = 0u;
+
+    mTimer = Timer::New(INSTANCE_UPDATE_INTERVAL_MS);
+    mTimer.TickSignal().Connect(this, &InstanceRenderingController::OnInstanceUpdateTimer);
+    mTimer.Start();
+
+    DALI_LOG_RELEASE_INFO("Instance buffer test: %u instances in %zu chunks\n", mInstanceCount, mChunks.size());
+  }
+
+  InstanceData CreateInstanceData()
+  {
+    InstanceData data;
+    data.aInstanceOffset = Vector2(Random::Range(-static_cast<float>(offsetXRange), static_cast<float>(offsetXRange)), Random::Range(-static_cast<float>(offsetYRange), static_cast<float>(offsetYRange)));
+    data.aInstanceColor  = Vector4(Random::Range(0.1f, 1.0f), Random::Range(0.1f, 1.0f), Random::Range(0.1f, 1.0f), 1.0f);
+    return data;
+  }
+
+  /**
+   * Moves the next few instances, like the first instance animation of the other tests,
+   * and uploads the instance buffers of the chunks they belong to
+   */
+  bool OnInstanceUpdateTimer()
+  {
+    const uint32_t changedInstances = std::min(CHANGED_INSTANCES_PER_FRAME, mInstanceCount);
+    for(uint32_t i = 0; i < changedInstances; ++i)
+    {
+      mInstanceData[mChangedInstance]                       = CreateInstanceData();
+      mChunks[mChangedInstance / INSTANCES_PER_CHUNK].dirty = true;
+      mChangedInstance                                      = (mChangedInstance + 1u) % mInstanceCount;
+    }
+
+    for(InstanceChunk& chunk : mChunks)
+    {
+      if(chunk.dirty)
+      {
+        chunk.instanceBuffer.SetData(&mInstanceData[chunk.firstInstance], chunk.instanceCount);
+        chunk.dirty = false;
+        ++mUploadedChunks;
+        mUploadedInstances += chunk.instanceCount;
+      }
+    }
+
+    if(++mUploadFrames == STATISTICS_FRAMES)
+    {
+      DALI_LOG_RELEASE_INFO("Instance buffer test: %u instances, uploaded per frame: %.1f chunks, %.1f KB (full upload: %.1f KB)\n",
+                            mInstanceCount,
+                            static_cast<float>(mUploadedChunks) / mUploadFrames,
+                            static_cast<float>(mUploadedInstances) * sizeof(InstanceData) / (1024.0f * mUploadFrames),
+                            static_cast<float>(mInstanceCount) * sizeof(InstanceData) / 1024.0f);
+      mUploadFrames      = 0u;
+      mUploadedChunks    = 0u;
+      mUploadedInstances = 0u;
     }
+    return true;
   }
 
   void UpdateLabel(int testNumber)
@@ -378,6 +542,11 @@ public:
         mLabel.SetProperty(TextLabel::Property::TEXT, "Instance rendering + 32bit indices geometry");
         break;
       }
+      case TestType::TEST_INSTANCE_RENDERING_WITH_INSTANCE_BUFFER:
+      {
+        mLabel.SetProperty(TextLabel::Property::TEXT, "Instance rendering + instance vertex buffers");
+        break;
+      }
       default:
       {
         mLabel.SetProperty(TextLabel::Property::TEXT, "ERROR");
@@ -397,6 +566,7 @@ private:
   uint16_t offsetYRange{0u};
 
   UniformBlock mUniformBlocks;
+  bool         mUniformBlocksConnected{false};
 
   Actor           mActor;
   Property::Index mFirstInstanceIndex{Property::INVALID_INDEX};
@@ -405,14 +575,38 @@ private:
 
   uint32_t mFirstInstance{0};
   Timer    mTimer;
+
+  uint32_t mInstanceCount{INSTANCE_COUNT_PER_DRAW};
+  int      mTestNumber{TestType::TEST_MULTIPLE_RENDERER};
+
+  std::vector<InstanceData>  mInstanceData;
+  std::vector<InstanceChunk> mChunks;
+  uint32_t                   mChangedInstance{0u};
+  uint32_t                   mUploadFrames{0u};
+  uint32_t                   mUploadedChunks{0u};
+  uint64_t                   mUploadedInstances{0u};
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   setenv("DALI_FPS_TRACKING", "5", 0);
 
+  uint32_t instanceCount  = INSTANCE_COUNT_PER_DRAW;
+  bool     instanceBuffer = false;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strncmp(argv[i], "--instances=", 12) == 0)
+    {
+      instanceCount = std::min(static_cast<uint32_t>(std::max(atoi(argv[i] + 12), 1)), INSTANCE_COUNT_LIMIT);
+    }
+    else if(strcmp(argv[i], "--instance-buffer") == 0)
+    {
+      instanceBuffer = true;
+    }
+  }
+
   Application                 application = Application::New(&argc, &argv);
-  InstanceRenderingController test(application);
+  InstanceRenderingController test(application, instanceCount, instanceBuffer);
   application.MainLoop();
   return 0;
 }
@@ -0,0 +1,23 @@
+//@version 100
+
+INPUT highp vec2 aPosition;
+INPUT highp vec2 aInstanceOffset;
+INPUT mediump vec4 aInstanceColor;
+FLAT OUTPUT mediump vec4 vColor;
+
+UNIFORM_BLOCK Vanilla
+{
+  UNIFORM highp mat4 uMvpMatrix;
+  UNIFORM highp vec3 uSize;
+};
+
+void main()
+{
+  vec3 position = vec3(aPosition, 1.0) * uSize;
+
+  // Per instance attributes, the instance vertex buffer has a divisor of 1
+  position.xy += aInstanceOffset;
+  vColor = aInstanceColor;
+
+  gl_Position = uMvpMatrix * vec4(position, 1);
+}
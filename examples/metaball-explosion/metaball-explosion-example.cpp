@@ -16,13 +16,17 @@
  */
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cstdint> // uint32_t, uint16_t etc
 #include <cstdio>
+#include <cstring>
 #include <string>
 
+#include <dali/integration-api/debug.h>
 #include <dali/public-api/math/random.h>
 #include <dali/public-api/rendering/frame-buffer.h>
 #include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/rendering/sampler.h>
 #include <dali/public-api/rendering/texture-set.h>
 #include <dali/public-api/rendering/texture.h>
 
@@ -48,6 +52,23 @@ const char* const BACKGROUND_IMAGE(DEMO_IMAGE_DIR "background-2.jpg");
 // number of metaballs
 constexpr uint32_t METABALL_NUMBER = 6;
 
+/**
+ * Parses --metaball-quality=full|half|quarter
+ * @return The divisor of the metaball field resolution
+ */
+uint32_t ParseFieldDownscale(const char* quality)
+{
+  if(strcmp(quality, "half") == 0)
+  {
+    return 2u;
+  }
+  if(strcmp(quality, "quarter") == 0)
+  {
+    return 4u;
+  }
+  return 1u;
+}
+
 /**
  * Metadata for each ball
  */
@@ -69,6 +90,10 @@ struct MetaballInfo
  * Demo using Metaballs
  *
  * When the metaball is clicked it explodes to smaller balls
+ *
+ * The metaball field is rendered into an offscreen buffer which the composition samples. With
+ * --metaball-quality=half or quarter the field is rendered at half or a quarter of the window
+ * resolution and upsampled with bilinear filtering by the composition.
  */
 class MetaballExplosionController : public ConnectionTracker
 {
@@ -76,8 +101,9 @@ public:
   /**
    * Constructor
    * @param application
+   * @param fieldDownscale The divisor of the metaball field resolution
    */
-  MetaballExplosionController(Application& application);
+  MetaballExplosionController(Application& application, uint32_t fieldDownscale);
 
   /**
    * Destructor
@@ -106,6 +132,7 @@ private: // Data
 
   Texture     mBackgroundTexture;
   FrameBuffer mMetaballFBO;
+  uint32_t    mFieldDownscale;
 
   Actor        mMetaballRoot;
   MetaballInfo mMetaballs[METABALL_NUMBER];
@@ -194,11 +221,12 @@ private: // Data
  * Implementation
  */
 
-MetaballExplosionController::MetaballExplosionController(Application& application)
+MetaballExplosionController::MetaballExplosionController(Application& application, uint32_t fieldDownscale)
 : mApplication(application),
   mScreenSize(),
   mBackgroundTexture(),
   mMetaballFBO(),
+  mFieldDownscale(fieldDownscale),
   mMetaballRoot(),
   mMetaballs(),
   mPositionIndex(),
@@ -361,9 +389,14 @@ void MetaballExplosionController::CreateMetaballActors()
 void MetaballExplosionController::CreateMetaballImage()
 {
   // Create an FBO and a render task to create to render the metaballs with a fragment shader
+  // The metaball quads are sized for the window, the default camera maps them onto a smaller buffer as well
   Window window = mApplication.GetWindow();
 
-  mMetaballFBO = FrameBuffer::New(mScreenSize.x, mScreenSize.y);
+  const uint32_t fieldWidth  = std::max(static_cast<uint32_t>(mScreenSize.x) / mFieldDownscale, 1u);
+  const uint32_t fieldHeight = std::max(static_cast<uint32_t>(mScreenSize.y) / mFieldDownscale, 1u);
+  mMetaballFBO               = FrameBuffer::New(fieldWidth, fieldHeight);
+
+  DALI_LOG_RELEASE_INFO("Metaball field %ux%u, %u metaball passes of %u pixels per frame\n", fieldWidth, fieldHeight, METABALL_NUMBER, fieldWidth * fieldHeight);
 
   window.Add(mMetaballRoot);
 
@@ -388,6 +421,12 @@ void MetaballExplosionController::CreateComposition()
   textureSet.SetTexture(0u, mBackgroundTexture);
   textureSet.SetTexture(1u, mMetaballFBO.GetColorTexture());
 
+  // Upsample a reduced resolution field with bilinear filtering
+  Sampler sampler = Sampler::New();
+  sampler.SetFilterMode(FilterMode::LINEAR, FilterMode::LINEAR);
+  sampler.SetWrapMode(WrapMode::CLAMP_TO_EDGE, WrapMode::CLAMP_TO_EDGE);
+  textureSet.SetSampler(1u, sampler);
+
   // Create geometry
   Geometry metaballGeom = CreateGeometry(false);
 
@@ -574,7 +613,16 @@ int32_t DALI_EXPORT_API main(int argc, char** argv)
 {
   Application application = Application::New(&argc, &argv);
 
-  MetaballExplosionController test(application);
+  uint32_t fieldDownscale = 1u;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strncmp(argv[i], "--metaball-quality=", 19) == 0)
+    {
+      fieldDownscale = ParseFieldDownscale(argv[i] + 19);
+    }
+  }
+
+  MetaballExplosionController test(application, fieldDownscale);
 
   application.MainLoop();
 
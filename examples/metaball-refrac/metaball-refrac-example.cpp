@@ -16,12 +16,16 @@
  */
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cstdint> // uint32_t, uint16_t etc
 #include <cstdio>
+#include <cstring>
 #include <string>
 
+#include <dali/integration-api/debug.h>
 #include <dali/public-api/rendering/frame-buffer.h>
 #include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/rendering/sampler.h>
 #include <dali/public-api/rendering/texture-set.h>
 #include <dali/public-api/rendering/texture.h>
 
@@ -47,6 +51,28 @@ const float       GRAVITY_Y(-0.09);
 // number of metaballs
 constexpr uint32_t METABALL_NUMBER = 6;
 
+/**
+ * Parses --metaball-quality=full|half|quarter
+ * @return The divisor of the metaball field resolution
+ */
+uint32_t ParseFieldDownscale(const char* quality)
+{
+  if(strcmp(quality, "half") == 0)
+  {
+    return 2u;
+  }
+  if(strcmp(quality, "quarter") == 0)
+  {
+    return 4u;
+  }
+  return 1u;
+}
+
+bool IsPlaying(const Animation& animation)
+{
+  return animation && animation.GetState() == Animation::PLAYING;
+}
+
 /**
  * Metadata for each ball
  */
@@ -72,6 +98,12 @@ struct MetaballInfo
  * Demo using Metaballs
  *
  * When the metaball is clicked it starts to grow and fuses into the closest edge of screen
+ *
+ * The metaball field is rendered into an offscreen buffer which the composition samples to refract
+ * the background. With --metaball-quality=half or quarter the field is rendered at half or a quarter
+ * of the window resolution, the composition upsamples it with bilinear filtering: the field is smooth,
+ * so the refraction edges stay soft while the field pass touches 4 or 16 times fewer pixels.
+ * The field is only re-rendered while a metaball animation is playing.
  */
 class MetaballRefracController : public ConnectionTracker
 {
@@ -79,8 +111,9 @@ public:
   /**
    * Constructor
    * @param application
+   * @param fieldDownscale The divisor of the metaball field resolution
    */
-  MetaballRefracController(Application& application);
+  MetaballRefracController(Application& application, uint32_t fieldDownscale);
 
   /**
    * Destructor
@@ -108,6 +141,9 @@ private: // Data
 
   Texture     mBackgroundTexture;
   FrameBuffer mMetaballFBO;
+  RenderTask  mMetaballTask;
+  uint32_t    mFieldDownscale;
+  bool        mFieldAnimating;
 
   Actor        mMetaballRoot;
   MetaballInfo mMetaballs[METABALL_NUMBER];
@@ -195,14 +231,26 @@ private: // Data
    * Function to set the actual position of the metaballs when the user clicks the screen
    */
   void SetPositionToMetaballs(const Vector2& metaballCenter);
+
+  /**
+   * Function to render the metaball field on every frame while an animation is playing, and only once more when they are all over
+   */
+  void UpdateFieldRefresh();
+
+  /**
+   * Function called when an animation of the metaballs finishes, to stop the field updates once the metaballs are gone
+   */
+  void OnFieldAnimationFinished(Animation source);
 };
 
 /**
  * Implementation
  */
 
-MetaballRefracController::MetaballRefracController(Application& application)
-: mApplication(application)
+MetaballRefracController::MetaballRefracController(Application& application, uint32_t fieldDownscale)
+: mApplication(application),
+  mFieldDownscale(fieldDownscale),
+  mFieldAnimating(false)
 {
   // Connect to the Application's Init signal
   mApplication.InitSignal().Connect(this, &MetaballRefracController::Create);
@@ -349,20 +397,25 @@ void MetaballRefracController::CreateMetaballActors()
 void MetaballRefracController::CreateMetaballImage()
 {
   // Create an FBO and a render task to create to render the metaballs with a fragment shader
-  Window window = mApplication.GetWindow();
-  mMetaballFBO  = FrameBuffer::New(mScreenSize.x, mScreenSize.y);
+  // The metaball quads are sized for the window, the default camera maps them onto the smaller buffer as well
+  Window         window      = mApplication.GetWindow();
+  const uint32_t fieldWidth  = std::max(static_cast<uint32_t>(mScreenSize.x) / mFieldDownscale, 1u);
+  const uint32_t fieldHeight = std::max(static_cast<uint32_t>(mScreenSize.y) / mFieldDownscale, 1u);
+  mMetaballFBO               = FrameBuffer::New(fieldWidth, fieldHeight);
+
+  DALI_LOG_RELEASE_INFO("Metaball field %ux%u, %u metaball passes of %u pixels per frame while animating\n", fieldWidth, fieldHeight, METABALL_NUMBER, fieldWidth * fieldHeight);
 
   window.Add(mMetaballRoot);
 
-  //Creation of the render task used to render the metaballs
+  //Creation of the render task used to render the metaballs, nothing moves before the first touch
   RenderTaskList taskList = window.GetRenderTaskList();
-  RenderTask     task     = taskList.CreateTask();
-  task.SetRefreshRate(RenderTask::REFRESH_ALWAYS);
-  task.SetSourceActor(mMetaballRoot);
-  task.SetExclusive(true);
-  task.SetClearColor(Color::BLACK);
-  task.SetClearEnabled(true);
-  task.SetFrameBuffer(mMetaballFBO);
+  mMetaballTask           = taskList.CreateTask();
+  mMetaballTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
+  mMetaballTask.SetSourceActor(mMetaballRoot);
+  mMetaballTask.SetExclusive(true);
+  mMetaballTask.SetClearColor(Color::BLACK);
+  mMetaballTask.SetClearEnabled(true);
+  mMetaballTask.SetFrameBuffer(mMetaballFBO);
 }
 
 void MetaballRefracController::CreateComposition()
@@ -375,6 +428,12 @@ void MetaballRefracController::CreateComposition()
   mTextureSetRefraction.SetTexture(0u, mBackgroundTexture);
   mTextureSetRefraction.SetTexture(1u, mMetaballFBO.GetColorTexture());
 
+  // Upsample a reduced resolution field with bilinear filtering
+  Sampler sampler = Sampler::New();
+  sampler.SetFilterMode(FilterMode::LINEAR, FilterMode::LINEAR);
+  sampler.SetWrapMode(WrapMode::CLAMP_TO_EDGE, WrapMode::CLAMP_TO_EDGE);
+  mTextureSetRefraction.SetSampler(1u, sampler);
+
   // Create normal shader
   mShaderNormal = Shader::New(ToDaliStringView(SHADER_METABALL_VERT), ToDaliStringView(SHADER_FRAGMENT_FRAG));
 
@@ -445,6 +504,7 @@ void MetaballRefracController::CreateAnimations()
     mGravityAnimation[i].AnimateBy(Property(mMetaballs[i].actor, mMetaballs[i].gravityIndex), mGravity * 25.f * 3.f);
     mGravityAnimation[i].SetLooping(false);
     mGravityAnimation[i].Pause();
+    mGravityAnimation[i].FinishedSignal().Connect(this, &MetaballRefracController::OnFieldAnimationFinished);
   }
 
   //Animation to decrease size of metaballs when there is no click
@@ -454,6 +514,7 @@ void MetaballRefracController::CreateAnimations()
     mRadiusDecAnimation[i].AnimateBy(Property(mMetaballs[i].actor, mMetaballs[i].radiusIndex), -0.004f * 25.f * 3.f);
     mRadiusDecAnimation[i].SetLooping(false);
     mRadiusDecAnimation[i].Pause();
+    mRadiusDecAnimation[i].FinishedSignal().Connect(this, &MetaballRefracController::OnFieldAnimationFinished);
   }
 
   // Animation to grow the size of the metaballs the first second of the click
@@ -512,7 +573,9 @@ void MetaballRefracController::LaunchGetBackToPositionAnimation(Animation source
   mPositionVarAnimation[1] = Animation::New(1.f);
   mPositionVarAnimation[1].SetLooping(false);
   mPositionVarAnimation[1].AnimateTo(Property(mMetaballs[1].actor, mMetaballs[1].positionVarIndex), Vector2(0, 0));
+  mPositionVarAnimation[1].FinishedSignal().Connect(this, &MetaballRefracController::OnFieldAnimationFinished);
   mPositionVarAnimation[1].Play();
+  UpdateFieldRefresh();
 }
 
 void MetaballRefracController::LaunchRadiusIncSlowAnimations(Animation source)
@@ -523,6 +586,7 @@ void MetaballRefracController::LaunchRadiusIncSlowAnimations(Animation source)
   }
   mPositionVarAnimation[2].Play();
   mPositionVarAnimation[3].Play();
+  UpdateFieldRefresh();
 }
 
 void MetaballRefracController::StopClickAnimations()
@@ -656,7 +720,47 @@ void MetaballRefracController::OnTouch(Window window, TouchEvent touch)
     default:
       break;
   }
-  return;
+  UpdateFieldRefresh();
+}
+
+void MetaballRefracController::UpdateFieldRefresh()
+{
+  const Animation* animationGroups[] = {mGravityAnimation, mRadiusDecAnimation, mRadiusIncFastAnimation, mRadiusIncSlowAnimation, mRadiusVarAnimation, mPositionVarAnimation};
+
+  bool animating = false;
+  for(const Animation* animations : animationGroups)
+  {
+    for(uint32_t i = 0; i < METABALL_NUMBER && !animating; i++)
+    {
+      animating = IsPlaying(animations[i]);
+    }
+  }
+
+  if(animating != mFieldAnimating)
+  {
+    // REFRESH_ONCE renders the final state of the field, which is then reused by the composition
+    mFieldAnimating = animating;
+    mMetaballTask.SetRefreshRate(animating ? RenderTask::REFRESH_ALWAYS : RenderTask::REFRESH_ONCE);
+  }
+}
+
+void MetaballRefracController::OnFieldAnimationFinished(Animation source)
+{
+  bool fallen = !IsPlaying(mRadiusIncFastAnimation[0]) && !IsPlaying(mRadiusIncSlowAnimation[0]);
+  for(uint32_t i = 0; i < METABALL_NUMBER && fallen; i++)
+  {
+    fallen = !IsPlaying(mGravityAnimation[i]) && !IsPlaying(mRadiusDecAnimation[i]);
+  }
+
+  if(fallen && (IsPlaying(mRadiusVarAnimation[2]) || IsPlaying(mRadiusVarAnimation[3])))
+  {
+    // The metaballs have shrunk to nothing once they have fallen, their radius variations are invisible and the
+    // composition can go back to the plain background
+    mRadiusVarAnimation[2].Stop();
+    mRadiusVarAnimation[3].Stop();
+    ResetMetaballsState();
+  }
+  UpdateFieldRefresh();
 }
 
 void MetaballRefracController::OnKeyEvent(Window window, KeyEvent event)
@@ -677,7 +781,16 @@ int32_t DALI_EXPORT_API main(int argc, char** argv)
 {
   Application application = Application::New(&argc, &argv);
 
-  MetaballRefracController test(application);
+  uint32_t fieldDownscale = 1u;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strncmp(argv[i], "--metaball-quality=", 19) == 0)
+    {
+      fieldDownscale = ParseFieldDownscale(argv[i] + 19);
+    }
+  }
+
+  MetaballRefracController test(application, fieldDownscale);
   application.MainLoop();
 
   return 0;
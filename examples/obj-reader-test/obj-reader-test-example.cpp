@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/integration-api/debug.h>
+#include <dali/integration-api/string-utils.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "shared/obj-reader.h"
+
+using Dali::Integration::ToPropertyValue;
+
+using namespace Dali;
+using Dali::Toolkit::TextLabel;
+using DemoHelper::ObjData;
+using DemoHelper::ObjReader;
+
+namespace
+{
+/**
+ * A test case parses an OBJ content and checks the result of the reader
+ */
+struct TestCase
+{
+  const char* name;
+  const char* content;
+  bool (*check)(bool parsed, const ObjReader& reader, const ObjData& data);
+};
+
+bool HasIndices(const int32_t (&indices)[3], int32_t first, int32_t second, int32_t third)
+{
+  return indices[0] == first && indices[1] == second && indices[2] == third;
+}
+
+bool HasTriangle(const ObjData& data, uint32_t triangle, int32_t first, int32_t second, int32_t third)
+{
+  return triangle < data.triangles.Count() && HasIndices(data.triangles[triangle].pointIndex, first, second, third);
+}
+
+bool FailedAt(bool parsed, const ObjReader& reader, uint32_t line)
+{
+  return !parsed && reader.GetErrorLine() == line && !reader.GetError().empty();
+}
+
+const TestCase TEST_CASES[] = {
+  {"face v",
+   "v 0 0 0\n"
+   "v 1 0 0\n"
+   "v 0 1 0\n"
+   "f 1 2 3\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return parsed && data.triangles.Count() == 1u && HasTriangle(data, 0u, 0, 1, 2) &&
+            HasIndices(data.triangles[0].textureIndex, -1, -1, -1) && HasIndices(data.triangles[0].normalIndex, -1, -1, -1) &&
+            !data.hasTextureIndices && !data.hasNormals;
+   }},
+  {"face v/vt",
+   "v 0 0 0\n"
+   "v 1 0 0\n"
+   "v 0 1 0\n"
+   "vt 0 0\n"
+   "vt 1 0\n"
+   "vt 0 1\n"
+   "f 1/3 2/2 3/1\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return parsed && data.triangles.Count() == 1u && HasTriangle(data, 0u, 0, 1, 2) &&
+            HasIndices(data.triangles[0].textureIndex, 2, 1, 0) && HasIndices(data.triangles[0].normalIndex, -1, -1, -1) &&
+            data.hasTextureIndices && !data.hasNormals && data.textureCoordinates.Count() == 3u;
+   }},
+  {"face v//vn",
+   "v 0 0 0\n"
+   "v 1 0 0\n"
+   "v 0 1 0\n"
+   "vn 0 0 1\n"
+   "vn 0 0 -1\n"
+   "f 1//2 2//2 3//1\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return parsed && data.triangles.Count() == 1u && HasTriangle(data, 0u, 0, 1, 2) &&
+            HasIndices(data.triangles[0].textureIndex, -1, -1, -1) && HasIndices(data.triangles[0].normalIndex, 1, 1, 0) &&
+            !data.hasTextureIndices && data.hasNormals && data.normals[1].z == -1.0f;
+   }},
+  {"face v/vt/vn",
+   "v 0 0 0\n"
+   "v 1 0 0\n"
+   "v 0 1 0\n"
+   "vt 0 0\n"
+   "vt 1 0\n"
+   "vn 0 0 1\n"
+   "f 3/1/1 2/2/1 1/1/1\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return parsed && data.triangles.Count() == 1u && HasTriangle(data, 0u, 2, 1, 0) &&
+            HasIndices(data.triangles[0].textureIndex, 0, 1, 0) && HasIndices(data.triangles[0].normalIndex, 0, 0, 0) &&
+            data.hasTextureIndices && data.hasNormals;
+   }},
+  {"relative indices",
+   "v 0 0 0\n"
+   "v 1 0 0\n"
+   "v 0 1 0\n"
+   "vt 0 0\n"
+   "vn 0 0 1\n"
+   "f -3/-1/-1 -2/-1/-1 -1/-1/-1\n"
+   "v 1 1 0\n"
+   "vt 1 1\n"
+   "f -3 -2/-2 -1/-1/-1\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return parsed && data.triangles.Count() == 2u && HasTriangle(data, 0u, 0, 1, 2) && HasTriangle(data, 1u, 1, 2, 3) &&
+            HasIndices(data.triangles[0].textureIndex, 0, 0, 0) && HasIndices(data.triangles[0].normalIndex, 0, 0, 0) &&
+            HasIndices(data.triangles[1].textureIndex, -1, 0, 1) && HasIndices(data.triangles[1].normalIndex, -1, -1, 0);
+   }},
+  {"polygon triangulation",
+   "v 0 0 0\n"
+   "v 1 0 0\n"
+   "v 2 1 0\n"
+   "v 1 2 0\n"
+   "v 0 1 0\n"
+   "f 1/1/1 2/1/1 3/1/1 4/1/1 5/1/1\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     // The file has no texture coordinate nor normal, the references resolve to -1
+     return parsed && data.triangles.Count() == 3u && HasTriangle(data, 0u, 0, 1, 2) && HasTriangle(data, 1u, 0, 2, 3) &&
+            HasTriangle(data, 2u, 0, 3, 4) && HasIndices(data.triangles[2].normalIndex, -1, -1, -1);
+   }},
+  {"comments, unknown statements and CRLF",
+   "# exported\r\n"
+   "mtllib scene.mtl\r\n"
+   "o object\r\n"
+   "v 1e-1 -2.5E+1 .5 # comment\r\n"
+   "v 1 0 0\r\n"
+   "\r\n"
+   "v 0 1 0\r\n"
+   "g group\r\n"
+   "usemtl material\r\n"
+   "s off\r\n"
+   "f 1 2 3 # comment\r\n"
+   "l 1 2",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return parsed && data.points.Count() == 3u && data.triangles.Count() == 1u && HasTriangle(data, 0u, 0, 1, 2) &&
+            data.points[0].x == 0.1f && data.points[0].y == -25.0f && data.points[0].z == 0.5f &&
+            data.pointMin.y == -25.0f && data.pointMax.x == 1.0f && data.pointMax.y == 1.0f;
+   }},
+  {"malformed vertex",
+   "v 0 0 0\n"
+   "v 1 0\n"
+   "v 0 1 0\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return FailedAt(parsed, reader, 2u);
+   }},
+  {"malformed number",
+   "v 0 0 0\n"
+   "v 1 0 0\n"
+   "vn 0 0 1.0.0\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return FailedAt(parsed, reader, 3u);
+   }},
+  {"vertex index out of range",
+   "v 0 0 0\n"
+   "v 1 0 0\n"
+   "v 0 1 0\n"
+   "f 1 2 4\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return FailedAt(parsed, reader, 4u);
+   }},
+  {"relative index out of range",
+   "v 0 0 0\n"
+   "v 1 0 0\n"
+   "v 0 1 0\n"
+   "f -4 -2 -1\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return FailedAt(parsed, reader, 4u);
+   }},
+  {"face with two vertices",
+   "v 0 0 0\n"
+   "v 1 0 0\n"
+   "f 1 2\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return FailedAt(parsed, reader, 3u);
+   }},
+  {"unexpected character in face",
+   "v 0 0 0\n"
+   "v 1 0 0\n"
+   "v 0 1 0\n"
+   "f 1 2 3x\n",
+   [](bool parsed, const ObjReader& reader, const ObjData& data) {
+     return FailedAt(parsed, reader, 4u);
+   }},
+};
+
+} // namespace
+
+/**
+ * Runs the test cases of the OBJ reader shared by the examples and shows the results,
+ * the results are also printed so the test can run unattended.
+ */
+class ObjReaderTestController : public ConnectionTracker
+{
+public:
+  ObjReaderTestController(Application& application)
+  : mApplication(application),
+    mFailures(0u)
+  {
+    // Connect to the Application's Init signal
+    mApplication.InitSignal().Connect(this, &ObjReaderTestController::Create);
+  }
+
+  ~ObjReaderTestController() = default; // Nothing to do in destructor
+
+  /**
+   * Retrieves the number of test cases which failed
+   */
+  uint32_t GetFailureCount() const
+  {
+    return mFailures;
+  }
+
+private:
+  // The Init signal is received once (only) during the Application lifetime
+  void Create(Application application)
+  {
+    std::string results;
+    for(const TestCase& testCase : TEST_CASES)
+    {
+      ObjData   data;
+      ObjReader reader;
+
+      const bool parsed = reader.Parse(testCase.content, strlen(testCase.content), data);
+      const bool passed = testCase.check(parsed, reader, data);
+      if(!passed)
+      {
+        ++mFailures;
+        DALI_LOG_ERROR("%s: parsed %d, line %u: %s\n", testCase.name, parsed, reader.GetErrorLine(), reader.GetError().c_str());
+      }
+
+      printf("%s %s\n", passed ? "PASS" : "FAIL", testCase.name);
+      results += std::string(passed ? "PASS " : "FAIL ") + testCase.name + "\n";
+    }
+    printf("%u of %zu test cases failed\n", mFailures, sizeof(TEST_CASES) / sizeof(TEST_CASES[0]));
+
+    // Get a handle to the window
+    Window window = application.GetWindow();
+    window.SetBackgroundColor(mFailures ? Color::RED : Color::GREEN);
+
+    TextLabel textLabel = TextLabel::New();
+    textLabel.SetProperty(TextLabel::Property::TEXT, ToPropertyValue(results));
+    textLabel.SetProperty(TextLabel::Property::MULTI_LINE, true);
+    textLabel.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+    textLabel.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+    window.Add(textLabel);
+
+    // Respond to key events
+    window.KeyEventSignal().Connect(this, &ObjReaderTestController::OnKeyEvent);
+  }
+
+  void OnKeyEvent(Window window, KeyEvent event)
+  {
+    if(event.GetState() == KeyEvent::DOWN)
+    {
+      if(IsKey(event, Dali::DALI_KEY_ESCAPE) || IsKey(event, Dali::DALI_KEY_BACK))
+      {
+        mApplication.Quit();
+      }
+    }
+  }
+
+private:
+  Application& mApplication;
+  uint32_t     mFailures; ///< Number of test cases which failed
+};
+
+int DALI_EXPORT_API main(int argc, char** argv)
+{
+  Application             application = Application::New(&argc, &argv);
+  ObjReaderTestController test(application);
+  application.MainLoop();
+  return test.GetFailureCount() ? 1 : 0;
+}
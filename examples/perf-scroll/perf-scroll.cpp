@@ -18,12 +18,15 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include <chrono>
 #include <iostream>
 
 // INTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
 #include "generated/perf-scroll-frag.h"
 #include "generated/perf-scroll-vert.h"
+#include "shared/column-recycler.h"
 #include "shared/utility.h"
 using Dali::Integration::GetStdString;
 using Dali::Integration::ToDaliString;
@@ -160,6 +163,8 @@ struct VertexWithTexture
 
 bool gUseMesh(false);
 bool gUseNinePatch(false);
+bool gRecycle(false);
+bool gUseAtlas(false);
 
 constexpr unsigned int ROWS_PER_PAGE(15);
 constexpr unsigned int COLUMNS_PER_PAGE(15);
@@ -187,6 +192,8 @@ Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
  *  -t[duration] (seconds)
  *  --use-mesh (Use Renderer API)
  *  --nine-patch (Use nine-patch images in ImageView)
+ *  --recycle (Create actors only for the visible columns plus a margin, rebind them as the columns scroll in)
+ *  --atlas (Use Renderer API with the images packed into a few atlas textures)
  */
 class PerfScroll : public ConnectionTracker
 {
@@ -195,7 +202,8 @@ public:
   : mApplication(application),
     mRowsPerPage(ROWS_PER_PAGE),
     mColumnsPerPage(COLUMNS_PER_PAGE),
-    mPageCount(PAGE_COUNT)
+    mPageCount(PAGE_COUNT),
+    mActorColumns(COLUMNS_PER_PAGE * PAGE_COUNT)
   {
     // Connect to the Application's Init signal
     mApplication.InitSignal().Connect(this, &PerfScroll::Create);
@@ -225,6 +233,13 @@ public:
     mParent.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
     window.Add(mParent);
 
+    if(gRecycle)
+    {
+      // Only the visible columns and a margin on both sides have actors
+      mRecycler.Initialize(mParent, mSize.x, mColumnsPerPage, mColumnsPerPage * mPageCount, [this](unsigned int slot, unsigned int column) { RebindColumn(slot, column); });
+      mActorColumns = mRecycler.GetSlotCount();
+    }
+
     if(gUseMesh)
     {
       CreateMeshActors();
@@ -250,19 +265,23 @@ public:
     return !gUseNinePatch ? IMAGE_PATH[i % NUM_IMAGES] : NINEPATCH_IMAGE_PATH[i % NUM_NINEPATCH_IMAGES];
   }
 
+  Property::Map CreateImageMap(int i)
+  {
+    Property::Map propertyMap;
+    propertyMap.Insert(Toolkit::ImageVisual::Property::URL, ImagePath(i));
+    propertyMap.Insert(Toolkit::Visual::Property::TYPE, Toolkit::Visual::IMAGE);
+    return propertyMap;
+  }
+
   void CreateImageViews()
   {
-    Window       window = mApplication.GetWindow();
-    unsigned int actorCount(mRowsPerPage * mColumnsPerPage * mPageCount);
+    unsigned int actorCount(mRowsPerPage * mActorColumns);
     mActor.resize(actorCount);
 
     for(size_t i(0); i < actorCount; ++i)
     {
       mActor[i] = ImageView::New();
-      Property::Map propertyMap;
-      propertyMap.Insert(Toolkit::ImageVisual::Property::URL, ImagePath(i));
-      propertyMap.Insert(Toolkit::Visual::Property::TYPE, Toolkit::Visual::IMAGE);
-      mActor[i].SetProperty(Toolkit::ImageView::Property::IMAGE, propertyMap);
+      mActor[i].SetProperty(Toolkit::ImageView::Property::IMAGE, CreateImageMap(i));
       Dali::DevelActor::SetResizePolicy(mActor[i], ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS);
       mParent.Add(mActor[i]);
     }
@@ -271,34 +290,112 @@ public:
   void CreateMeshActors()
   {
     unsigned int numImages = !gUseNinePatch ? NUM_IMAGES : NUM_NINEPATCH_IMAGES;
+    auto         start     = std::chrono::steady_clock::now();
 
     //Create all the renderers
-    std::vector<Renderer> renderers(numImages);
-    Shader                shader   = Shader::New(ToDaliStringView(SHADER_PERF_SCROLL_VERT), ToDaliStringView(SHADER_PERF_SCROLL_FRAG));
-    Geometry              geometry = DemoHelper::CreateTexturedQuad();
-    for(unsigned int i(0); i < numImages; ++i)
+    Geometry geometry = DemoHelper::CreateTexturedQuad();
+    if(gUseAtlas)
+    {
+      std::vector<std::string> imagePaths;
+      for(unsigned int i(0); i < numImages; ++i)
+      {
+        imagePaths.push_back(ImagePath(i));
+      }
+      mAtlas = DemoHelper::LoadTextureAtlas(imagePaths);
+
+      // A renderer per atlas page, the actors select their image with uAtlasRect
+      std::string vertexShader(SHADER_PERF_SCROLL_VERT);
+      vertexShader  = "#define ATLAS\n" + vertexShader;
+      Shader shader = Shader::New(ToDaliStringView(vertexShader), ToDaliStringView(SHADER_PERF_SCROLL_FRAG));
+      for(Texture& page : mAtlas.pages)
+      {
+        TextureSet textureSet = TextureSet::New();
+        textureSet.SetTexture(0u, page);
+        mRenderers.push_back(Renderer::New(geometry, shader));
+        mRenderers.back().SetTextures(textureSet);
+        mRenderers.back().SetProperty(Renderer::Property::BLEND_MODE, BlendMode::OFF);
+      }
+
+      std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+      DALI_LOG_RELEASE_INFO("PerfScroll: %u images (%zu KB) packed into %zu textures (%zu KB) in %.2f ms\n", numImages, mAtlas.imageBytes / 1024u, mAtlas.pages.size(), mAtlas.pageBytes / 1024u, duration.count());
+    }
+    else
     {
-      renderers[i] = CreateRenderer(i, geometry, shader);
+      mRenderers.resize(numImages);
+      Shader shader = Shader::New(ToDaliStringView(SHADER_PERF_SCROLL_VERT), ToDaliStringView(SHADER_PERF_SCROLL_FRAG));
+      for(unsigned int i(0); i < numImages; ++i)
+      {
+        mRenderers[i] = CreateRenderer(i, geometry, shader);
+      }
+
+      std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+      DALI_LOG_RELEASE_INFO("PerfScroll: %u images loaded into separate textures in %.2f ms\n", numImages, duration.count());
     }
 
     //Create the actors
-    Window       window = mApplication.GetWindow();
-    unsigned int actorCount(mRowsPerPage * mColumnsPerPage * mPageCount);
+    unsigned int actorCount(mRowsPerPage * mActorColumns);
     mActor.resize(actorCount);
     for(size_t i(0); i < actorCount; ++i)
     {
       mActor[i] = Actor::New();
-      mActor[i].AddRenderer(renderers[i % numImages]);
+      BindImage(mActor[i], i);
       mParent.Add(mActor[i]);
     }
   }
 
+  /**
+   * Sets the renderer showing the given image to the mesh actor
+   */
+  void BindImage(Actor& actor, unsigned int imageIndex)
+  {
+    if(actor.GetRendererCount() > 0u)
+    {
+      actor.RemoveRenderer(0u);
+    }
+
+    if(gUseAtlas)
+    {
+      // Images left out of the atlas are not shown
+      const DemoHelper::AtlasRegion& region = mAtlas.regions[imageIndex % mAtlas.regions.size()];
+      if(region.page != DemoHelper::AtlasRegion::INVALID_PAGE)
+      {
+        actor.AddRenderer(mRenderers[region.page]);
+        actor.RegisterProperty("uAtlasRect", region.textureRect);
+      }
+    }
+    else
+    {
+      actor.AddRenderer(mRenderers[imageIndex % mRenderers.size()]);
+    }
+  }
+
+  /**
+   * Moves the actors of the given slot to another column of the grid and binds the images of that column
+   */
+  void RebindColumn(unsigned int slot, unsigned int column)
+  {
+    for(unsigned int row(0); row < mRowsPerPage; ++row)
+    {
+      Actor&             actor     = mActor[slot * mRowsPerPage + row];
+      const unsigned int gridIndex = column * mRowsPerPage + row;
+      actor.SetProperty(Actor::Property::POSITION_X, mSize.x * column + mSize.x * 0.5f);
+      if(gUseMesh)
+      {
+        BindImage(actor, gridIndex);
+      }
+      else
+      {
+        actor.SetProperty(Toolkit::ImageView::Property::IMAGE, CreateImageMap(gridIndex));
+      }
+    }
+  }
+
   void PositionActors()
   {
     Window  window = mApplication.GetWindow();
     Vector3 initialPosition(window.GetPositionSize().width * 0.5f, window.GetPositionSize().height * 0.5f, 1000.0f);
 
-    unsigned int totalColumns = mColumnsPerPage * mPageCount;
+    unsigned int totalColumns = mActorColumns;
 
     size_t count(0);
     float  xpos, ypos;
@@ -344,14 +441,18 @@ public:
 private:
   Application& mApplication;
 
-  std::vector<Actor> mActor;
-  Actor              mParent;
+  std::vector<Actor>         mActor;
+  std::vector<Renderer>      mRenderers;
+  DemoHelper::TextureAtlas   mAtlas; ///< Atlas of the images in the atlas mode
+  Actor                      mParent;
+  DemoHelper::ColumnRecycler mRecycler; ///< Hands the recycled actor columns to the columns scrolling in
 
   Vector3 mSize;
 
   const unsigned int mRowsPerPage;
   const unsigned int mColumnsPerPage;
   const unsigned int mPageCount;
+  unsigned int       mActorColumns; ///< Number of columns with actors
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
@@ -367,6 +468,15 @@ int DALI_EXPORT_API main(int argc, char** argv)
     {
       gUseNinePatch = true;
     }
+    else if(arg.compare("--recycle") == 0)
+    {
+      gRecycle = true;
+    }
+    else if(arg.compare("--atlas") == 0)
+    {
+      gUseMesh  = true;
+      gUseAtlas = true;
+    }
     else if(arg.compare(0, 2, "-t") == 0)
     {
       auto newDuration = atof(arg.substr(2, arg.size()).c_str());
@@ -381,6 +491,8 @@ int DALI_EXPORT_API main(int argc, char** argv)
       cout << "  Options:" << endl;
       cout << "    --use-mesh    Uses the Rendering API directly to create actors" << endl;
       cout << "    --nine-patch  Uses n-patch images instead" << endl;
+      cout << "    --recycle     Creates actors for the visible columns only and rebinds them while scrolling" << endl;
+      cout << "    --atlas       Uses the Rendering API with the images packed into a few atlas textures" << endl;
       cout << "    -t[seconds]   Replace [seconds] with the animation time required, i.e. -t4. Default is 10s." << endl;
       cout << "    -h|--help     Help" << endl;
       return 0;
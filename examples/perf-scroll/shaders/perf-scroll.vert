@@ -8,11 +8,19 @@ UNIFORM_BLOCK Vanilla
 {
 UNIFORM mediump mat4 uMvpMatrix;
 UNIFORM mediump vec3 uSize;
+#ifdef ATLAS
+UNIFORM mediump vec4 uAtlasRect;
+#endif
 };
 
 void main()
 {
   vec4 position = vec4(aPosition,0.0,1.0)*vec4(uSize,1.0);
   gl_Position = uMvpMatrix * position;
+#ifdef ATLAS
+  // The image is a part of an atlas page
+  vTexCoord = uAtlasRect.xy + aTexCoord * uAtlasRect.zw;
+#else
   vTexCoord = aTexCoord;
+#endif
 }
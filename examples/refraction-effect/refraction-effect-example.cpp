@@ -18,19 +18,15 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
-#include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/integration-api/debug.h>
 
-#include <cctype>
-#include <limits>
-#include <sstream>
-
 // INTERNAL INCLUDES
 #include <dali/integration-api/string-utils.h>
 #include "generated/refraction-effect-flat-frag.h"
 #include "generated/refraction-effect-flat-vert.h"
 #include "generated/refraction-effect-refraction-frag.h"
 #include "generated/refraction-effect-refraction-vert.h"
+#include "shared/obj-reader.h"
 #include "shared/utility.h"
 #include "shared/view.h"
 using Dali::Integration::GetStdString;
@@ -137,6 +133,7 @@ private:
     Vector2 windowSize = Vector2(window.GetPositionSize().width, window.GetPositionSize().height);
 
     window.KeyEventSignal().Connect(this, &RefractionEffectExample::OnKeyEvent);
+    window.ResizedSignal().Connect(this, &RefractionEffectExample::OnWindowResized);
 
     // Creates a default view with a default tool bar.
     // The view is added to the window.
@@ -170,7 +167,7 @@ private:
 
     // shader used when the screen is not touched, render a flat surface
     mShaderFlat = Shader::New(ToDaliStringView(SHADER_REFRACTION_EFFECT_FLAT_VERT), ToDaliStringView(SHADER_REFRACTION_EFFECT_FLAT_FRAG));
-    mGeometry   = CreateGeometry(MESH_FILES[mCurrentMeshId]);
+    mGeometry   = GetMeshGeometry(mCurrentMeshId);
 
     Texture texture = DemoHelper::LoadWindowFillingTexture(Uint16Pair(window.GetPositionSize().width, window.GetPositionSize().height), TEXTURE_IMAGES[mCurrentTextureId]);
     mTextureSet     = TextureSet::New();
@@ -226,12 +223,30 @@ private:
   bool OnChangeMesh(Toolkit::Button button)
   {
     mCurrentMeshId = (mCurrentMeshId + 1) % NUM_MESH_FILES;
-    mGeometry      = CreateGeometry(MESH_FILES[mCurrentMeshId]);
+    mGeometry      = GetMeshGeometry(mCurrentMeshId);
     mRenderer.SetGeometry(mGeometry);
 
     return true;
   }
 
+  /**
+   * The meshes are fitted to the window, so the geometries created for the previous size are discarded
+   */
+  void OnWindowResized(Window window, Window::WindowSize size)
+  {
+    for(Geometry& geometry : mMeshGeometries)
+    {
+      geometry.Reset();
+    }
+
+    mGeometry = GetMeshGeometry(mCurrentMeshId);
+    mRenderer.SetGeometry(mGeometry);
+    mMeshActor.SetProperty(Actor::Property::SIZE, Vector2(size.GetWidth(), size.GetHeight()));
+
+    Texture texture = DemoHelper::LoadWindowFillingTexture(Uint16Pair(size.GetWidth(), size.GetHeight()), TEXTURE_IMAGES[mCurrentTextureId]);
+    mTextureSet.SetTexture(0u, texture);
+  }
+
   bool OnChangeTexture(Toolkit::Button button)
   {
     mCurrentTextureId = (mCurrentTextureId + 1) % NUM_TEXTURE_IMAGES;
@@ -300,45 +315,59 @@ private:
     SetLightXYOffset(Vector2::ZERO);
   }
 
+  /**
+   * Retrieves the geometry of a mesh, the mesh file is only read and fitted to the window the first time
+   */
+  Geometry GetMeshGeometry(unsigned int meshId)
+  {
+    if(!mMeshGeometries[meshId])
+    {
+      mMeshGeometries[meshId] = CreateGeometry(MESH_FILES[meshId]);
+    }
+    return mMeshGeometries[meshId];
+  }
+
   Geometry CreateGeometry(const std::string& objFileName)
   {
-    std::vector<Vector3> vertexPositions;
-    Vector<unsigned int> faceIndices;
-    Vector<float>        boundingBox;
-    // read the vertice and faces from the .obj file, and record the bounding box
-    ReadObjFile(objFileName, boundingBox, vertexPositions, faceIndices);
+    // read the vertices and faces from the .obj file, with the bounding box
+    DemoHelper::ObjData   objData;
+    DemoHelper::ObjReader objReader;
+    if(!objReader.Read(objFileName, objData))
+    {
+      DALI_LOG_WARNING("failed to load \"%s\", line %u: %s\n", objFileName.c_str(), objReader.GetErrorLine(), objReader.GetError().c_str());
+    }
 
-    std::vector<Vector2> textureCoordinates;
+    Dali::Vector<Vector3>& vertexPositions = objData.points;
+    std::vector<Vector2>   textureCoordinates;
     // align the mesh, scale it to fit the screen size, and calculate the texture coordinate for each vertex
-    ShapeResizeAndTexureCoordinateCalculation(boundingBox, vertexPositions, textureCoordinates);
+    ShapeResizeAndTexureCoordinateCalculation(objData.pointMin, objData.pointMax, vertexPositions, textureCoordinates);
 
     // re-organize the mesh, the vertices are duplicated, each vertex only belongs to one triangle.
     // Without sharing vertex between triangle, so we can manipulate the texture offset on each triangle conveniently.
     std::vector<Vertex> vertices;
+    vertices.reserve(objData.triangles.Count() * 3u);
 
-    std::size_t size = faceIndices.Size();
-    vertices.reserve(size);
-
-    for(std::size_t i = 0; i < size; i = i + 3)
+    for(const DemoHelper::ObjTriangle& triangle : objData.triangles)
     {
-      Vector3 edge1  = vertexPositions[faceIndices[i + 2]] - vertexPositions[faceIndices[i]];
-      Vector3 edge2  = vertexPositions[faceIndices[i + 1]] - vertexPositions[faceIndices[i]];
-      Vector3 normal = edge1.Cross(edge2);
+      const int32_t* index  = triangle.pointIndex;
+      Vector3        edge1  = vertexPositions[index[2]] - vertexPositions[index[0]];
+      Vector3        edge2  = vertexPositions[index[1]] - vertexPositions[index[0]];
+      Vector3        normal = edge1.Cross(edge2);
       normal.Normalize();
 
       // make sure all the faces are front-facing
       if(normal.z > 0)
       {
-        vertices.push_back(Vertex{vertexPositions[faceIndices[i]], normal, textureCoordinates[faceIndices[i]]});
-        vertices.push_back(Vertex{vertexPositions[faceIndices[i + 1]], normal, textureCoordinates[faceIndices[i + 1]]});
-        vertices.push_back(Vertex{vertexPositions[faceIndices[i + 2]], normal, textureCoordinates[faceIndices[i + 2]]});
+        vertices.push_back(Vertex{vertexPositions[index[0]], normal, textureCoordinates[index[0]]});
+        vertices.push_back(Vertex{vertexPositions[index[1]], normal, textureCoordinates[index[1]]});
+        vertices.push_back(Vertex{vertexPositions[index[2]], normal, textureCoordinates[index[2]]});
       }
       else
       {
         normal *= -1.f;
-        vertices.push_back(Vertex{vertexPositions[faceIndices[i]], normal, textureCoordinates[faceIndices[i]]});
-        vertices.push_back(Vertex{vertexPositions[faceIndices[i + 2]], normal, textureCoordinates[faceIndices[i + 2]]});
-        vertices.push_back(Vertex{vertexPositions[faceIndices[i + 1]], normal, textureCoordinates[faceIndices[i + 1]]});
+        vertices.push_back(Vertex{vertexPositions[index[0]], normal, textureCoordinates[index[0]]});
+        vertices.push_back(Vertex{vertexPositions[index[2]], normal, textureCoordinates[index[2]]});
+        vertices.push_back(Vertex{vertexPositions[index[1]], normal, textureCoordinates[index[1]]});
       }
     }
 
@@ -347,7 +376,10 @@ private:
     vertexFormat["aNormal"]      = Property::VECTOR3;
     vertexFormat["aTexCoord"]    = Property::VECTOR2;
     VertexBuffer surfaceVertices = VertexBuffer::New(vertexFormat);
-    surfaceVertices.SetData(&vertices[0], vertices.size());
+    if(!vertices.empty())
+    {
+      surfaceVertices.SetData(&vertices[0], vertices.size());
+    }
 
     Geometry surface = Geometry::New();
     surface.AddVertexBuffer(surfaceVertices);
@@ -355,93 +387,28 @@ private:
     return surface;
   }
 
-  void ReadObjFile(const std::string&    objFileName,
-                   Vector<float>&        boundingBox,
-                   std::vector<Vector3>& vertexPositions,
-                   Vector<unsigned int>& faceIndices)
+  void ShapeResizeAndTexureCoordinateCalculation(const Vector3&         bBoxMinCorner,
+                                                 const Vector3&         bBoxMaxCorner,
+                                                 Dali::Vector<Vector3>& vertexPositions,
+                                                 std::vector<Vector2>&  textureCoordinates)
   {
-    std::streampos     bufferSize = 0;
-    Dali::Vector<char> fileBuffer;
-    if(!Dali::FileLoader::ReadFile(objFileName, bufferSize, fileBuffer, Dali::FileLoader::FileType::TEXT))
-    {
-      DALI_LOG_WARNING("file open failed for: \"%s\"", objFileName.c_str());
-      return;
-    }
-
-    fileBuffer.PushBack('\0');
-
-    std::stringstream iss(&fileBuffer[0], std::ios::in);
-
-    boundingBox.Resize(6);
-    boundingBox[0] = boundingBox[2] = boundingBox[4] = std::numeric_limits<float>::max();
-    boundingBox[1] = boundingBox[3] = boundingBox[5] = -std::numeric_limits<float>::max();
-
-    std::string line;
-    while(std::getline(iss, line))
-    {
-      if(line[0] == 'v' && std::isspace(line[1])) // vertex
-      {
-        std::istringstream vertexIss(line.substr(2), std::istringstream::in);
-        unsigned int       i = 0;
-        Vector3            vertex;
-        while(vertexIss >> vertex[i++] && i < 3);
-        if(vertex.x < boundingBox[0]) boundingBox[0] = vertex.x;
-        if(vertex.x > boundingBox[1]) boundingBox[1] = vertex.x;
-        if(vertex.y < boundingBox[2]) boundingBox[2] = vertex.y;
-        if(vertex.y > boundingBox[3]) boundingBox[3] = vertex.y;
-        if(vertex.z < boundingBox[4]) boundingBox[4] = vertex.z;
-        if(vertex.z > boundingBox[5]) boundingBox[5] = vertex.z;
-        vertexPositions.push_back(vertex);
-      }
-      else if(line[0] == 'f') // face
-      {
-        unsigned int numOfInt = 3;
-        while(true)
-        {
-          std::size_t found = line.find('/');
-          if(found == std::string::npos)
-          {
-            break;
-          }
-          line[found] = ' ';
-          numOfInt++;
-        }
-
-        std::istringstream         faceIss(line.substr(2), std::istringstream::in);
-        Dali::Vector<unsigned int> indices;
-        indices.Resize(numOfInt);
-        unsigned int i = 0;
-        while(faceIss >> indices[i++] && i < numOfInt);
-        unsigned int step = (i + 1) / 3;
-        faceIndices.PushBack(indices[0] - 1);
-        faceIndices.PushBack(indices[step] - 1);
-        faceIndices.PushBack(indices[2 * step] - 1);
-      }
-    }
-  }
-
-  void ShapeResizeAndTexureCoordinateCalculation(const Vector<float>&  boundingBox,
-                                                 std::vector<Vector3>& vertexPositions,
-                                                 std::vector<Vector2>& textureCoordinates)
-  {
-    Vector3 bBoxSize(boundingBox[1] - boundingBox[0], boundingBox[3] - boundingBox[2], boundingBox[5] - boundingBox[4]);
-    Vector3 bBoxMinCorner(boundingBox[0], boundingBox[2], boundingBox[4]);
+    Vector3 bBoxSize(bBoxMaxCorner - bBoxMinCorner);
 
     auto    positionSize = mApplication.GetWindow().GetPositionSize();
     Vector2 windowSize   = Vector2(positionSize.width, positionSize.height);
     Vector3 scale(windowSize.x / bBoxSize.x, windowSize.y / bBoxSize.y, 1.f);
     scale.z = (scale.x + scale.y) / 2.f;
 
-    textureCoordinates.reserve(vertexPositions.size());
+    textureCoordinates.reserve(vertexPositions.Count());
 
-    for(std::vector<Vector3>::iterator iter = vertexPositions.begin(); iter != vertexPositions.end(); iter++)
+    for(Vector3& position : vertexPositions)
     {
-      Vector3 newPosition((*iter) - bBoxMinCorner);
+      Vector3 newPosition(position - bBoxMinCorner);
 
       textureCoordinates.push_back(Vector2(newPosition.x / bBoxSize.x, newPosition.y / bBoxSize.y));
 
       newPosition -= bBoxSize * 0.5f;
-      (*iter) = newPosition * scale;
+      position = newPosition * scale;
     }
   }
 
@@ -482,6 +449,8 @@ private:
   Toolkit::PushButton mChangeMeshButton;
   unsigned int        mCurrentTextureId;
   unsigned int        mCurrentMeshId;
+
+  Geometry mMeshGeometries[NUM_MESH_FILES]; ///< Geometry of every mesh, created when the mesh is first shown at the current window size
 };
 
 /*****************************************************************************/
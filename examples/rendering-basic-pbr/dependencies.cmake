@@ -0,0 +1,19 @@
+# Optional decompressors for supercompressed ktx2 cube maps, the loader rejects such files without them
+IF(PKG_CONFIG_FOUND)
+  PKG_CHECK_MODULES(KTX_ZLIB QUIET zlib)
+  PKG_CHECK_MODULES(KTX_ZSTD QUIET libzstd)
+ENDIF()
+
+IF(KTX_ZLIB_FOUND)
+  TARGET_COMPILE_DEFINITIONS(${EXAMPLE}.example PRIVATE KTX_LOADER_ZLIB)
+  TARGET_COMPILE_OPTIONS(${EXAMPLE}.example PUBLIC ${KTX_ZLIB_CFLAGS})
+  TARGET_LINK_LIBRARIES(${EXAMPLE}.example ${KTX_ZLIB_LDFLAGS})
+  MESSAGE(STATUS "Included zlib for ${EXAMPLE}")
+ENDIF()
+
+IF(KTX_ZSTD_FOUND)
+  TARGET_COMPILE_DEFINITIONS(${EXAMPLE}.example PRIVATE KTX_LOADER_ZSTD)
+  TARGET_COMPILE_OPTIONS(${EXAMPLE}.example PUBLIC ${KTX_ZSTD_CFLAGS})
+  TARGET_LINK_LIBRARIES(${EXAMPLE}.example ${KTX_ZSTD_LDFLAGS})
+  MESSAGE(STATUS "Included zstd for ${EXAMPLE}")
+ENDIF()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,14 +19,36 @@
 #include "ktx-loader.h"
 
 // EXTERNAL INCLUDES
-#include <dali/devel-api/adaptor-framework/file-stream.h>
 #include <dali/integration-api/debug.h>
+#include <dali/public-api/rendering/texture.h>
 #include <memory.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+
+#ifdef KTX_LOADER_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef KTX_LOADER_ZSTD
+#include <zstd.h>
+#endif
 
 namespace PbrDemo
 {
+namespace
+{
+const uint8_t KTX1_IDENTIFIER[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A}; ///< «KTX 11»\r\n\x1A\n
+const uint8_t KTX2_IDENTIFIER[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A}; ///< «KTX 20»\r\n\x1A\n
+
+const uint32_t KTX1_ENDIANNESS(0x04030201);
+
+const uint32_t SUPERCOMPRESSION_NONE(0u);
+const uint32_t SUPERCOMPRESSION_BASIS_LZ(1u);
+const uint32_t SUPERCOMPRESSION_ZSTD(2u);
+const uint32_t SUPERCOMPRESSION_ZLIB(3u);
+
 struct KtxFileHeader
 {
   char     identifier[12];
@@ -45,6 +67,33 @@ struct KtxFileHeader
   uint32_t bytesOfKeyValueData;
 };
 
+struct Ktx2FileHeader
+{
+  char     identifier[12];
+  uint32_t vkFormat; //VK_FORMAT_R16G16B16_SFLOAT, etc.
+  uint32_t typeSize;
+  uint32_t pixelWidth;
+  uint32_t pixelHeight;
+  uint32_t pixelDepth;
+  uint32_t layerCount;
+  uint32_t faceCount; //Cube map faces are stored in the same order as in ktx
+  uint32_t levelCount;
+  uint32_t supercompressionScheme; //0: none, 1: BasisLZ, 2: Zstandard, 3: zlib
+  uint32_t dfdByteOffset;
+  uint32_t dfdByteLength;
+  uint32_t kvdByteOffset;
+  uint32_t kvdByteLength;
+  uint64_t sgdByteOffset;
+  uint64_t sgdByteLength;
+};
+
+struct Ktx2LevelIndex
+{
+  uint64_t byteOffset;
+  uint64_t byteLength;
+  uint64_t uncompressedByteLength;
+};
+
 /**
  * Convert KTX format to Dali::Pixel::Format
  */
@@ -91,87 +140,385 @@ bool ConvertPixelFormat(const uint32_t ktxPixelFormat, Dali::Pixel::Format& form
   return true;
 }
 
+/**
+ * Convert KTX2 ( Vulkan ) format to Dali::Pixel::Format
+ */
+bool ConvertVkFormat(const uint32_t vkFormat, Dali::Pixel::Format& format)
+{
+  switch(vkFormat)
+  {
+    case 157: // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+    {
+      format = Dali::Pixel::COMPRESSED_RGBA_ASTC_4x4_KHR;
+      break;
+    }
+    case 90: // VK_FORMAT_R16G16B16_SFLOAT
+    {
+      format = Dali::Pixel::RGB16F;
+      break;
+    }
+    case 106: // VK_FORMAT_R32G32B32_SFLOAT
+    {
+      format = Dali::Pixel::RGB32F;
+      break;
+    }
+    case 122: // VK_FORMAT_B10G11R11_UFLOAT_PACK32
+    {
+      format = Dali::Pixel::R11G11B10F;
+      break;
+    }
+    case 37: // VK_FORMAT_R8G8B8A8_UNORM
+    {
+      format = Dali::Pixel::RGBA8888;
+      break;
+    }
+    case 23: // VK_FORMAT_R8G8B8_UNORM
+    {
+      format = Dali::Pixel::RGB888;
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+uint32_t AlignTo4(uint32_t size)
+{
+  return (size + 3u) & ~3u;
+}
+
+} // namespace
+
 bool LoadCubeMapFromKtxFile(const std::string& path, CubeData& cubedata)
 {
-  Dali::FileStream daliFileStream(path);
-  FILE*            fp(daliFileStream.GetFile());
-  if(!fp)
+  KtxCubeMapStream stream;
+  if(!stream.Open(path))
   {
     return false;
   }
 
-  KtxFileHeader header;
-  int           result = fread(&header, sizeof(KtxFileHeader), 1u, fp);
-  if(0 == result)
+  cubedata.img.clear();
+  cubedata.img.resize(stream.GetFaceCount());
+  for(unsigned int face = 0; face < stream.GetFaceCount(); ++face)
   {
-    return false;
+    cubedata.img[face].resize(stream.GetLevelCount());
+  }
+
+  std::vector<PixelData> faces;
+  for(unsigned int mipmapLevel = 0; mipmapLevel < stream.GetLevelCount(); ++mipmapLevel)
+  {
+    if(!stream.ReadLevel(mipmapLevel, faces))
+    {
+      return false;
+    }
+
+    for(unsigned int face = 0; face < faces.size(); ++face)
+    {
+      cubedata.img[face][mipmapLevel] = faces[face];
+    }
   }
 
-  // Skip the key-values:
-  if(fseek(fp, (long int)(header.bytesOfKeyValueData), SEEK_CUR))
+  return true;
+}
+
+KtxCubeMapStream::KtxCubeMapStream()
+: mFile(),
+  mLevels(),
+  mFormat(Pixel::RGB888),
+  mFaceCount(0u),
+  mSupercompression(SUPERCOMPRESSION_NONE),
+  mNextLevel(0u),
+  mPreviewSize(0u),
+  mUploadedBytes(0u)
+{
+}
+
+KtxCubeMapStream::~KtxCubeMapStream()
+{
+  Close();
+}
+
+bool KtxCubeMapStream::Open(const std::string& path, uint32_t previewSize)
+{
+  Close();
+
+  if(!mFile.Open(path.c_str()))
   {
     return false;
   }
 
-  cubedata.img.resize(header.numberOfFaces);
+  const uint8_t* data = mFile.GetData();
+  bool           valid(false);
+  if(mFile.GetSize() >= sizeof(KTX1_IDENTIFIER) && !memcmp(data, KTX1_IDENTIFIER, sizeof(KTX1_IDENTIFIER)))
+  {
+    valid = ReadKtx1Header();
+  }
+  else if(mFile.GetSize() >= sizeof(KTX2_IDENTIFIER) && !memcmp(data, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)))
+  {
+    valid = ReadKtx2Header();
+  }
 
-  for(unsigned int face = 0; face < header.numberOfFaces; ++face) //array_element must be 0 or 1
+  // Every level has to be within the file
+  for(const Level& level : mLevels)
   {
-    cubedata.img[face].resize(header.numberOfMipmapLevels);
+    valid = valid && level.offset <= mFile.GetSize() && level.size <= mFile.GetSize() - level.offset;
   }
 
-  if(0 == header.numberOfMipmapLevels)
+  if(!valid || mLevels.empty())
   {
-    header.numberOfMipmapLevels = 1u;
+    DALI_LOG_ERROR("Invalid or unsupported ktx file: %s\n", path.c_str());
+    Close();
+    return false;
   }
 
-  if(0 == header.numberOfArrayElements)
+  mNextLevel   = static_cast<uint32_t>(mLevels.size());
+  mPreviewSize = previewSize;
+  return true;
+}
+
+Texture KtxCubeMapStream::LoadNext()
+{
+  if(IsComplete())
   {
-    header.numberOfArrayElements = 1u;
+    return Texture();
   }
 
-  if(0 == header.pixelDepth)
+  uint32_t first = mNextLevel - 1u;
+  if(mNextLevel == mLevels.size())
   {
-    header.pixelDepth = 1u;
+    // The preview holds every level not larger than the preview size, at least the smallest one
+    while(first > 0u && std::max(mLevels[first - 1u].width, mLevels[first - 1u].height) <= mPreviewSize)
+    {
+      --first;
+    }
   }
 
-  if(0 == header.pixelHeight)
+  const bool cube    = (mFaceCount == 6u);
+  Texture    texture = Texture::New(cube ? TextureType::TEXTURE_CUBE : TextureType::TEXTURE_2D, mFormat, mLevels[first].width, mLevels[first].height);
+
+  std::vector<PixelData> faces;
+  for(uint32_t level = first; level < mLevels.size(); ++level)
   {
-    header.pixelHeight = 1u;
+    if(!ReadLevel(level, faces))
+    {
+      return Texture();
+    }
+
+    for(uint32_t face = 0u; face < faces.size(); ++face)
+    {
+      const uint32_t layer = cube ? CubeMapLayer::POSITIVE_X + face : 0u;
+      texture.Upload(faces[face], layer, level - first, 0u, 0u, mLevels[level].width, mLevels[level].height);
+      mUploadedBytes += mLevels[level].faceSize;
+    }
   }
 
-  Dali::Pixel::Format daliformat = Pixel::RGB888;
+  mNextLevel = first;
+  return texture;
+}
+
+bool KtxCubeMapStream::IsComplete() const
+{
+  return mNextLevel == 0u;
+}
+
+bool KtxCubeMapStream::ReadLevel(uint32_t level, std::vector<PixelData>& faces) const
+{
+  faces.clear();
+  if(level >= mLevels.size())
+  {
+    return false;
+  }
 
-  ConvertPixelFormat(header.glInternalFormat, daliformat);
+  const Level&   info = mLevels[level];
+  const uint8_t* data = mFile.GetData() + info.offset;
 
-  for(unsigned int mipmapLevel = 0; mipmapLevel < header.numberOfMipmapLevels; ++mipmapLevel)
+  // Supercompressed levels are inflated as a whole, the faces are copied out of the inflated level
+  std::vector<uint8_t> inflated;
+  if(mSupercompression != SUPERCOMPRESSION_NONE)
   {
-    uint32_t byteSize = 0;
-    if(fread(&byteSize, sizeof(byteSize), 1u, fp) != 1)
+    inflated.resize(info.uncompressedSize);
+    bool success(false);
+#ifdef KTX_LOADER_ZLIB
+    if(mSupercompression == SUPERCOMPRESSION_ZLIB)
     {
+      uLongf length = static_cast<uLongf>(info.uncompressedSize);
+      success       = uncompress(inflated.data(), &length, data, static_cast<uLong>(info.size)) == Z_OK && length == info.uncompressedSize;
+    }
+#endif
+#ifdef KTX_LOADER_ZSTD
+    if(mSupercompression == SUPERCOMPRESSION_ZSTD)
+    {
+      size_t length = ZSTD_decompress(inflated.data(), inflated.size(), data, static_cast<size_t>(info.size));
+      success       = !ZSTD_isError(length) && length == info.uncompressedSize;
+    }
+#endif
+    if(!success)
+    {
+      DALI_LOG_ERROR("Failed to inflate ktx2 level %u\n", level);
       return false;
     }
+    data = inflated.data();
+  }
+
+  for(uint32_t face = 0u; face < mFaceCount; ++face)
+  {
+    // resources will be freed when the PixelData is destroyed.
+    uint8_t* buffer = static_cast<uint8_t*>(malloc(info.faceSize));
+    memcpy(buffer, data + face * info.faceStride, info.faceSize);
+    faces.push_back(PixelData::New(buffer, info.faceSize, info.width, info.height, mFormat, PixelData::FREE));
+  }
+
+  return true;
+}
+
+uint32_t KtxCubeMapStream::GetLevelCount() const
+{
+  return static_cast<uint32_t>(mLevels.size());
+}
+
+uint32_t KtxCubeMapStream::GetFaceCount() const
+{
+  return mFaceCount;
+}
+
+uint32_t KtxCubeMapStream::GetUploadedBytes() const
+{
+  return mUploadedBytes;
+}
+
+void KtxCubeMapStream::Close()
+{
+  mFile.Close();
+  mLevels.clear();
+  mFaceCount        = 0u;
+  mSupercompression = SUPERCOMPRESSION_NONE;
+  mNextLevel        = 0u;
+  mUploadedBytes    = 0u;
+}
+
+bool KtxCubeMapStream::ReadKtx1Header()
+{
+  const uint8_t* data = mFile.GetData();
+
+  KtxFileHeader header;
+  if(mFile.GetSize() < sizeof(KtxFileHeader))
+  {
+    return false;
+  }
+  memcpy(&header, data, sizeof(KtxFileHeader));
+
+  // Array textures, 3D textures and files of the other endianness are not supported
+  if(header.endianness != KTX1_ENDIANNESS || header.numberOfArrayElements > 1u || header.pixelDepth > 1u ||
+     (header.numberOfFaces != 1u && header.numberOfFaces != 6u))
+  {
+    return false;
+  }
 
-    if(0 != byteSize % 4u)
+  if(!ConvertPixelFormat(header.glInternalFormat, mFormat))
+  {
+    mFormat = Pixel::RGB888;
+  }
+  mFaceCount = header.numberOfFaces;
+
+  const uint32_t levelCount = std::max(header.numberOfMipmapLevels, 1u);
+  uint64_t       offset     = sizeof(KtxFileHeader) + uint64_t(header.bytesOfKeyValueData);
+  for(uint32_t mipmapLevel = 0; mipmapLevel < levelCount; ++mipmapLevel)
+  {
+    uint32_t imageSize = 0;
+    if(offset + sizeof(imageSize) > mFile.GetSize())
     {
-      byteSize += 4u - byteSize % 4u;
+      return false;
     }
+    memcpy(&imageSize, data + offset, sizeof(imageSize));
+    offset += sizeof(imageSize);
+
+    // The image size of a cube map is the size of a single face, every face is padded to 4 bytes
+    Level level;
+    level.faceSize         = (mFaceCount == 6u) ? imageSize : imageSize / mFaceCount;
+    level.faceStride       = AlignTo4(level.faceSize);
+    level.offset           = offset;
+    level.size             = uint64_t(level.faceStride) * mFaceCount;
+    level.uncompressedSize = level.size;
+    level.width            = std::max(header.pixelWidth >> mipmapLevel, 1u);
+    level.height           = std::max(header.pixelHeight >> mipmapLevel, 1u);
+    mLevels.push_back(level);
+
+    offset += AlignTo4(static_cast<uint32_t>(level.size));
+  }
+
+  return true;
+}
+
+bool KtxCubeMapStream::ReadKtx2Header()
+{
+  const uint8_t* data = mFile.GetData();
+
+  Ktx2FileHeader header;
+  if(mFile.GetSize() < sizeof(Ktx2FileHeader))
+  {
+    return false;
+  }
+  memcpy(&header, data, sizeof(Ktx2FileHeader));
+
+  // Array textures and 3D textures are not supported
+  if(header.layerCount > 1u || header.pixelDepth > 1u || (header.faceCount != 1u && header.faceCount != 6u))
+  {
+    return false;
+  }
 
-    for(unsigned int arrayElement = 0; arrayElement < header.numberOfArrayElements; ++arrayElement) // arrayElement must be 0 or 1
+  if(!ConvertVkFormat(header.vkFormat, mFormat))
+  {
+    DALI_LOG_ERROR("Unsupported ktx2 format %u\n", header.vkFormat);
+    return false;
+  }
+
+  switch(header.supercompressionScheme)
+  {
+    case SUPERCOMPRESSION_NONE:
+#ifdef KTX_LOADER_ZSTD
+    case SUPERCOMPRESSION_ZSTD:
+#endif
+#ifdef KTX_LOADER_ZLIB
+    case SUPERCOMPRESSION_ZLIB:
+#endif
+    {
+      break;
+    }
+    case SUPERCOMPRESSION_BASIS_LZ: // Needs the Basis Universal transcoder
+    default:
     {
-      for(unsigned int face = 0; face < header.numberOfFaces; ++face)
-      {
-        std::unique_ptr<uint8_t, void (*)(void*)> img(static_cast<unsigned char*>(malloc(byteSize)), free); // resources will be freed when the PixelData is destroyed.
-        if(fread(img.get(), byteSize, 1u, fp) != 1)
-        {
-          return false;
-        }
-        cubedata.img[face][mipmapLevel] = PixelData::New(img.release(), byteSize, header.pixelWidth, header.pixelHeight, daliformat, PixelData::FREE);
-      }
+      DALI_LOG_ERROR("Unsupported ktx2 supercompression scheme %u\n", header.supercompressionScheme);
+      return false;
     }
+  }
+  mSupercompression = header.supercompressionScheme;
+  mFaceCount        = header.faceCount;
+
+  const uint32_t levelCount = std::max(header.levelCount, 1u);
+  if(sizeof(Ktx2FileHeader) + levelCount * sizeof(Ktx2LevelIndex) > mFile.GetSize())
+  {
+    return false;
+  }
+
+  for(uint32_t mipmapLevel = 0; mipmapLevel < levelCount; ++mipmapLevel)
+  {
+    Ktx2LevelIndex index;
+    memcpy(&index, data + sizeof(Ktx2FileHeader) + mipmapLevel * sizeof(Ktx2LevelIndex), sizeof(Ktx2LevelIndex));
 
-    header.pixelHeight /= 2u;
-    header.pixelWidth /= 2u;
+    // The faces of a level are tightly packed
+    Level level;
+    level.offset           = index.byteOffset;
+    level.size             = index.byteLength;
+    level.uncompressedSize = (mSupercompression == SUPERCOMPRESSION_NONE) ? index.byteLength : index.uncompressedByteLength;
+    level.faceSize         = static_cast<uint32_t>(level.uncompressedSize / mFaceCount);
+    level.faceStride       = level.faceSize;
+    level.width            = std::max(header.pixelWidth >> mipmapLevel, 1u);
+    level.height           = std::max(header.pixelHeight >> mipmapLevel, 1u);
+    mLevels.push_back(level);
   }
 
   return true;
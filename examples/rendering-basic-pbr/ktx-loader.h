@@ -2,7 +2,7 @@
 #define KTX_LOADER_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,8 +21,13 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/common/vector-wrapper.h>
 #include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/rendering/texture.h>
+#include <cstdint>
 #include <string>
 
+// INTERNAL INCLUDES
+#include "shared/mapped-file.h"
+
 using namespace Dali;
 
 namespace PbrDemo
@@ -36,13 +41,124 @@ struct CubeData
 };
 
 /**
- * @brief Loads a cube map texture from a ktx file.
+ * @brief Loads a cube map texture from a ktx or ktx2 file.
  *
  * @param[in] path The file path.
  * @param[out] cubedata The data structure with all pixel data objects.
  */
 bool LoadCubeMapFromKtxFile(const std::string& path, CubeData& cubedata);
 
+/**
+ * @brief Streams a cube map from a memory mapped ktx or ktx2 file, the smallest mipmaps first.
+ *
+ * Every call of LoadNext() creates a cube texture twice the size of the previous one, holding
+ * every mipmap of the file up to that size. The first texture only holds the mipmaps not larger
+ * than the preview size, so it is available at once; the following textures are created on the
+ * next frames, until the last one holds every mipmap of the file.
+ *
+ * Only the mipmaps of the current texture are read from the mapping, so the file is paged in
+ * gradually and no copy of the whole file is kept. Ktx2 levels supercompressed with zlib or
+ * Zstandard are inflated when they are read, if the library was found at build time.
+ */
+class KtxCubeMapStream
+{
+public:
+  /**
+   * @brief Creates an instance of KtxCubeMapStream, no file is opened.
+   */
+  KtxCubeMapStream();
+
+  /**
+   * @brief Destroys an instance of KtxCubeMapStream and unmaps the file.
+   */
+  ~KtxCubeMapStream();
+
+  /**
+   * @brief Maps the file and reads its header and level index.
+   *
+   * @param[in] path The file path.
+   * @param[in] previewSize The largest mipmap size of the first texture.
+   * @return True if the file is a valid cube map.
+   */
+  bool Open(const std::string& path, uint32_t previewSize = 32u);
+
+  /**
+   * @brief Creates and uploads the next texture of the stream.
+   *
+   * @return The texture, or an empty handle if the stream is complete or a level can't be read.
+   */
+  Texture LoadNext();
+
+  /**
+   * @brief Checks whether the last texture holds every mipmap of the file.
+   */
+  bool IsComplete() const;
+
+  /**
+   * @brief Reads the faces of a mipmap level.
+   *
+   * @param[in] level The mipmap level, 0 is the largest.
+   * @param[out] faces The pixel data of every face.
+   * @return True if the level was read.
+   */
+  bool ReadLevel(uint32_t level, std::vector<PixelData>& faces) const;
+
+  /**
+   * @brief Retrieves the number of mipmap levels of the file.
+   */
+  uint32_t GetLevelCount() const;
+
+  /**
+   * @brief Retrieves the number of faces of the file.
+   */
+  uint32_t GetFaceCount() const;
+
+  /**
+   * @brief Retrieves the number of bytes uploaded so far.
+   */
+  uint32_t GetUploadedBytes() const;
+
+private:
+  KtxCubeMapStream(const KtxCubeMapStream&) = delete;
+  KtxCubeMapStream& operator=(const KtxCubeMapStream&) = delete;
+
+  /**
+   * @brief Unmaps the file and releases the level index.
+   */
+  void Close();
+
+  /**
+   * @brief Reads the header and the level index of a ktx file.
+   */
+  bool ReadKtx1Header();
+
+  /**
+   * @brief Reads the header and the level index of a ktx2 file.
+   */
+  bool ReadKtx2Header();
+
+private:
+  struct Level
+  {
+    uint64_t offset;           ///< Offset of the level data within the file
+    uint64_t size;             ///< Size of the level data within the file
+    uint64_t uncompressedSize; ///< Size of the level data once inflated
+    uint32_t faceStride;       ///< Distance between the faces of the inflated level
+    uint32_t faceSize;         ///< Size of a single face
+    uint32_t width;            ///< Width of the level in pixels
+    uint32_t height;           ///< Height of the level in pixels
+  };
+
+  DemoHelper::MappedFile mFile;             ///< File content, mapped where supported
+  std::vector<Level>     mLevels;           ///< Level index, the largest level first
+  Pixel::Format          mFormat;           ///< Pixel format of the faces
+  uint32_t               mFaceCount;        ///< Number of faces
+  uint32_t               mSupercompression; ///< Ktx2 supercompression scheme, 0 if none
+  uint32_t               mNextLevel;        ///< Largest level of the last texture
+  uint32_t               mPreviewSize;      ///< Largest mipmap size of the first texture
+  uint32_t               mUploadedBytes;    ///< Bytes uploaded so far
+};
+
 } // namespace PbrDemo
 
 #endif //KTX_LOADER_H
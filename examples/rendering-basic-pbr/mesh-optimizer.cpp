@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "mesh-optimizer.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace PbrDemo
+{
+namespace MeshOptimizer
+{
+namespace
+{
+const uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+// Scoring constants of the Forsyth algorithm
+const uint32_t FORSYTH_CACHE_SIZE  = 32u;
+const float    CACHE_DECAY_POWER   = 1.5f;
+const float    LAST_TRIANGLE_SCORE = 0.75f;
+const float    VALENCE_BOOST_SCALE = 2.0f;
+const float    VALENCE_BOOST_POWER = 0.5f;
+
+float VertexScore(int cachePosition, uint32_t remainingTriangles)
+{
+  if(remainingTriangles == 0u)
+  {
+    return -1.0f;
+  }
+
+  float score = 0.0f;
+  if(cachePosition >= 0)
+  {
+    // The vertices of the last triangle get a fixed score, so the next triangle doesn't simply reuse its edge
+    if(cachePosition < 3)
+    {
+      score = LAST_TRIANGLE_SCORE;
+    }
+    else
+    {
+      const float scale = 1.0f / (FORSYTH_CACHE_SIZE - 3u);
+      score             = powf(1.0f - (cachePosition - 3) * scale, CACHE_DECAY_POWER);
+    }
+  }
+
+  // Vertices with few triangles left are finished first, so they leave no lonely triangles behind
+  return score + VALENCE_BOOST_SCALE * powf(static_cast<float>(remainingTriangles), -VALENCE_BOOST_POWER);
+}
+
+} // namespace
+
+float CalculateAcmr(const Dali::Vector<uint32_t>& indices, uint32_t vertexCount, uint32_t cacheSize)
+{
+  const uint32_t triangleCount = indices.Size() / 3u;
+  if(triangleCount == 0u)
+  {
+    return 0.0f;
+  }
+
+  // A vertex is in the FIFO cache while fewer than cacheSize misses happened since it was loaded
+  std::vector<uint32_t> loadTime(vertexCount, 0u);
+  uint32_t              time   = cacheSize + 1u;
+  uint32_t              misses = 0u;
+  for(uint32_t i = 0; i < indices.Size(); ++i)
+  {
+    if(time - loadTime[indices[i]] > cacheSize)
+    {
+      loadTime[indices[i]] = time++;
+      ++misses;
+    }
+  }
+  return static_cast<float>(misses) / triangleCount;
+}
+
+void OptimizeVertexCache(Dali::Vector<uint32_t>& indices, uint32_t vertexCount)
+{
+  const uint32_t triangleCount = indices.Size() / 3u;
+  if(triangleCount == 0u)
+  {
+    return;
+  }
+
+  // The triangles of every vertex, the emitted ones are removed from the end of the lists
+  std::vector<uint32_t> remaining(vertexCount, 0u);
+  std::vector<uint32_t> adjacencyOffset(vertexCount + 1u, 0u);
+  std::vector<uint32_t> adjacency(triangleCount * 3u);
+  for(uint32_t i = 0; i < triangleCount * 3u; ++i)
+  {
+    ++remaining[indices[i]];
+  }
+  for(uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+  {
+    adjacencyOffset[vertex + 1u] = adjacencyOffset[vertex] + remaining[vertex];
+  }
+  std::vector<uint32_t> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+  for(uint32_t i = 0; i < triangleCount * 3u; ++i)
+  {
+    adjacency[fill[indices[i]]++] = i / 3u;
+  }
+
+  std::vector<int>   cachePosition(vertexCount, -1);
+  std::vector<float> vertexScore(vertexCount);
+  for(uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+  {
+    vertexScore[vertex] = VertexScore(-1, remaining[vertex]);
+  }
+
+  std::vector<bool>      emitted(triangleCount, false);
+  std::vector<uint32_t>  cache;
+  std::vector<uint32_t>  newCache;
+  Dali::Vector<uint32_t> output;
+  output.Resize(triangleCount * 3u);
+
+  uint32_t nextTriangle = 0u; ///< Triangles before it are emitted, used when the cache has no candidate
+  uint32_t best         = INVALID_INDEX;
+  for(uint32_t outputTriangle = 0; outputTriangle < triangleCount; ++outputTriangle)
+  {
+    if(best == INVALID_INDEX)
+    {
+      while(emitted[nextTriangle])
+      {
+        ++nextTriangle;
+      }
+      best = nextTriangle;
+    }
+
+    const uint32_t* corners = &indices[best * 3u];
+    std::copy(corners, corners + 3, &output[outputTriangle * 3u]);
+    emitted[best] = true;
+
+    // The vertices of the triangle move to the front of the cache
+    newCache.assign(corners, corners + 3);
+    for(uint32_t vertex : cache)
+    {
+      if(vertex != corners[0] && vertex != corners[1] && vertex != corners[2])
+      {
+        newCache.push_back(vertex);
+      }
+    }
+
+    for(uint32_t corner = 0; corner < 3u; ++corner)
+    {
+      const uint32_t vertex = corners[corner];
+      uint32_t*      begin  = &adjacency[adjacencyOffset[vertex]];
+      uint32_t*      end    = begin + remaining[vertex];
+      uint32_t*      found  = std::find(begin, end, best);
+      if(found != end)
+      {
+        *found = *(end - 1);
+        --remaining[vertex];
+      }
+    }
+
+    for(uint32_t i = 0; i < newCache.size(); ++i)
+    {
+      const uint32_t vertex = newCache[i];
+      cachePosition[vertex] = i < FORSYTH_CACHE_SIZE ? static_cast<int>(i) : -1;
+      vertexScore[vertex]   = VertexScore(cachePosition[vertex], remaining[vertex]);
+    }
+    newCache.resize(std::min<size_t>(newCache.size(), FORSYTH_CACHE_SIZE));
+    cache.swap(newCache);
+
+    // The next triangle is the best one using a cached vertex
+    best            = INVALID_INDEX;
+    float bestScore = -1.0f;
+    for(uint32_t vertex : cache)
+    {
+      for(uint32_t i = 0; i < remaining[vertex]; ++i)
+      {
+        const uint32_t  triangle = adjacency[adjacencyOffset[vertex] + i];
+        const uint32_t* vertices = &indices[triangle * 3u];
+        const float     score    = vertexScore[vertices[0]] + vertexScore[vertices[1]] + vertexScore[vertices[2]];
+        if(score > bestScore)
+        {
+          best      = triangle;
+          bestScore = score;
+        }
+      }
+    }
+  }
+
+  indices.Swap(output);
+}
+
+void OptimizeOverdraw(Dali::Vector<uint32_t>& indices, const Dali::Vector<Vector3>& positions, float threshold)
+{
+  const uint32_t triangleCount = indices.Size() / 3u;
+  const uint32_t vertexCount   = positions.Size();
+  if(triangleCount == 0u)
+  {
+    return;
+  }
+
+  // A cluster starts where none of the vertices of a triangle are in the cache
+  const uint32_t        cacheSize = 16u;
+  std::vector<uint32_t> loadTime(vertexCount, 0u);
+  std::vector<uint32_t> clusterStart;
+  uint32_t              time = cacheSize + 1u;
+  for(uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+  {
+    uint32_t misses = 0u;
+    for(uint32_t corner = 0; corner < 3u; ++corner)
+    {
+      const uint32_t vertex = indices[triangle * 3u + corner];
+      if(time - loadTime[vertex] > cacheSize)
+      {
+        loadTime[vertex] = time++;
+        ++misses;
+      }
+    }
+    if(misses == 3u || triangle == 0u)
+    {
+      clusterStart.push_back(triangle);
+    }
+  }
+  clusterStart.push_back(triangleCount);
+
+  Vector3 meshCenter;
+  for(uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+  {
+    meshCenter += positions[vertex];
+  }
+  meshCenter /= static_cast<float>(std::max(vertexCount, 1u));
+
+  // The clusters on the outside, facing away from the center, are likely to occlude the others
+  const uint32_t     clusterCount = clusterStart.size() - 1u;
+  std::vector<float> sortKey(clusterCount);
+  for(uint32_t cluster = 0; cluster < clusterCount; ++cluster)
+  {
+    Vector3 center;
+    Vector3 normal;
+    float   area = 0.0f;
+    for(uint32_t triangle = clusterStart[cluster]; triangle < clusterStart[cluster + 1u]; ++triangle)
+    {
+      const Vector3& a          = positions[indices[triangle * 3u]];
+      const Vector3& b          = positions[indices[triangle * 3u + 1u]];
+      const Vector3& c          = positions[indices[triangle * 3u + 2u]];
+      const Vector3  faceNormal = (b - a).Cross(c - a);
+      const float    faceArea   = faceNormal.Length();
+      center += (a + b + c) * (faceArea / 3.0f);
+      normal += faceNormal;
+      area += faceArea;
+    }
+    if(area > 0.0f)
+    {
+      center /= area;
+      normal.Normalize();
+    }
+    sortKey[cluster] = (center - meshCenter).Dot(normal);
+  }
+
+  std::vector<uint32_t> order(clusterCount);
+  for(uint32_t cluster = 0; cluster < clusterCount; ++cluster)
+  {
+    order[cluster] = cluster;
+  }
+  std::stable_sort(order.begin(), order.end(), [&sortKey](uint32_t lhs, uint32_t rhs)
+  { return sortKey[lhs] > sortKey[rhs]; });
+
+  Dali::Vector<uint32_t> output;
+  output.Resize(indices.Size());
+  uint32_t outputIndex = 0u;
+  for(uint32_t cluster : order)
+  {
+    for(uint32_t i = clusterStart[cluster] * 3u; i < clusterStart[cluster + 1u] * 3u; ++i)
+    {
+      output[outputIndex++] = indices[i];
+    }
+  }
+
+  if(CalculateAcmr(output, vertexCount) <= CalculateAcmr(indices, vertexCount) * threshold)
+  {
+    indices.Swap(output);
+  }
+}
+
+void OptimizeVertexFetch(Dali::Vector<uint32_t>& indices, uint32_t vertexCount, std::vector<uint32_t>& remap)
+{
+  remap.assign(vertexCount, INVALID_INDEX);
+
+  uint32_t nextVertex = 0u;
+  for(uint32_t i = 0; i < indices.Size(); ++i)
+  {
+    uint32_t& vertex = remap[indices[i]];
+    if(vertex == INVALID_INDEX)
+    {
+      vertex = nextVertex++;
+    }
+    indices[i] = vertex;
+  }
+
+  for(uint32_t& vertex : remap)
+  {
+    if(vertex == INVALID_INDEX)
+    {
+      vertex = nextVertex++;
+    }
+  }
+}
+
+void SplitClusters(const Dali::Vector<uint32_t>& indices, const Dali::Vector<Vector3>& positions, uint32_t maxVertices, uint32_t maxTriangles, std::vector<Cluster>& clusters)
+{
+  clusters.clear();
+
+  const uint32_t triangleCount = indices.Size() / 3u;
+  if(triangleCount == 0u || maxVertices < 3u || maxTriangles == 0u)
+  {
+    return;
+  }
+
+  // Every vertex remembers the last cluster using it, so the distinct vertices are counted once
+  std::vector<uint32_t> lastCluster(positions.Size(), INVALID_INDEX);
+  Cluster               cluster{0u, 0u, 0u, Vector3::ZERO, 0.0f};
+
+  auto closeCluster = [&]()
+  {
+    Vector3 minimum(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Vector3 maximum(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+    for(uint32_t i = cluster.indexOffset; i < cluster.indexOffset + cluster.indexCount; ++i)
+    {
+      const Vector3& position = positions[indices[i]];
+      minimum                 = Vector3(std::min(minimum.x, position.x), std::min(minimum.y, position.y), std::min(minimum.z, position.z));
+      maximum                 = Vector3(std::max(maximum.x, position.x), std::max(maximum.y, position.y), std::max(maximum.z, position.z));
+    }
+
+    cluster.center = (minimum + maximum) * 0.5f;
+    cluster.radius = 0.0f;
+    for(uint32_t i = cluster.indexOffset; i < cluster.indexOffset + cluster.indexCount; ++i)
+    {
+      cluster.radius = std::max(cluster.radius, (positions[indices[i]] - cluster.center).Length());
+    }
+    clusters.push_back(cluster);
+  };
+
+  for(uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+  {
+    const uint32_t* vertices = &indices[triangle * 3u];
+
+    auto countNewVertices = [&]()
+    {
+      uint32_t count = 0u;
+      for(uint32_t corner = 0; corner < 3u; ++corner)
+      {
+        if(lastCluster[vertices[corner]] != clusters.size() && std::find(vertices, vertices + corner, vertices[corner]) == vertices + corner)
+        {
+          ++count;
+        }
+      }
+      return count;
+    };
+
+    uint32_t newVertices = countNewVertices();
+    if(cluster.indexCount / 3u == maxTriangles || cluster.vertexCount + newVertices > maxVertices)
+    {
+      closeCluster();
+      cluster     = Cluster{triangle * 3u, 0u, 0u, Vector3::ZERO, 0.0f};
+      newVertices = countNewVertices();
+    }
+
+    for(uint32_t corner = 0; corner < 3u; ++corner)
+    {
+      lastCluster[vertices[corner]] = clusters.size();
+    }
+    cluster.vertexCount += newVertices;
+    cluster.indexCount += 3u;
+  }
+  closeCluster();
+}
+
+} // namespace MeshOptimizer
+
+} // namespace PbrDemo
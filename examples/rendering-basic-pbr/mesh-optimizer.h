@@ -0,0 +1,123 @@
+#ifndef DALI_DEMO_PBR_MESH_OPTIMIZER_H
+#define DALI_DEMO_PBR_MESH_OPTIMIZER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/math/vector3.h>
+#include <cstdint>
+#include <vector>
+
+using namespace Dali;
+
+namespace PbrDemo
+{
+namespace MeshOptimizer
+{
+/**
+ * @brief A range of consecutive triangles, small enough to be culled on its own.
+ */
+struct Cluster
+{
+  uint32_t indexOffset; ///< First index of the cluster
+  uint32_t indexCount;  ///< Number of indices of the cluster
+  uint32_t vertexCount; ///< Number of distinct vertices used by the cluster
+  Vector3  center;      ///< Center of the bounding sphere
+  float    radius;      ///< Radius of the bounding sphere
+};
+
+/**
+ * @brief Calculates the average cache miss ratio, the number of vertex shader runs per triangle.
+ *
+ * @param[in] indices The triangle list.
+ * @param[in] vertexCount The number of vertices.
+ * @param[in] cacheSize The size of the simulated FIFO post-transform cache.
+ * @return The number of cache misses per triangle, between 0.5 ( ideal ) and 3.
+ */
+float CalculateAcmr(const Dali::Vector<uint32_t>& indices, uint32_t vertexCount, uint32_t cacheSize = 16u);
+
+/**
+ * @brief Reorders the triangles, so the vertices are reused while they are in the post-transform cache.
+ *
+ * Uses the linear-speed vertex cache optimisation of Tom Forsyth: every vertex is scored by its
+ * position in a simulated LRU cache and by the number of its remaining triangles, then the
+ * triangle with the highest score among the ones using cached vertices is emitted next.
+ *
+ * @param[in, out] indices The triangle list.
+ * @param[in] vertexCount The number of vertices.
+ */
+void OptimizeVertexCache(Dali::Vector<uint32_t>& indices, uint32_t vertexCount);
+
+/**
+ * @brief Reorders the clusters of a cache optimised triangle list, so the outer surfaces are drawn first.
+ *
+ * The list is split where the cache starts cold, so moving the clusters keeps the cache efficiency.
+ * The clusters facing away from the center of the mesh are drawn first and occlude the others.
+ *
+ * @param[in, out] indices The triangle list, already optimised for the vertex cache.
+ * @param[in] positions The vertex positions.
+ * @param[in] threshold The maximum allowed growth of the ACMR, the order is kept if it grows more.
+ */
+void OptimizeOverdraw(Dali::Vector<uint32_t>& indices, const Dali::Vector<Vector3>& positions, float threshold = 1.05f);
+
+/**
+ * @brief Renumbers the vertices in the order of their first use, so the vertex fetches are sequential.
+ *
+ * @param[in, out] indices The triangle list.
+ * @param[in] vertexCount The number of vertices.
+ * @param[out] remap The new index of every vertex, the unused vertices are moved to the end.
+ */
+void OptimizeVertexFetch(Dali::Vector<uint32_t>& indices, uint32_t vertexCount, std::vector<uint32_t>& remap);
+
+/**
+ * @brief Splits the triangle list into clusters of consecutive triangles.
+ *
+ * @param[in] indices The triangle list.
+ * @param[in] positions The vertex positions.
+ * @param[in] maxVertices The maximum number of distinct vertices of a cluster.
+ * @param[in] maxTriangles The maximum number of triangles of a cluster.
+ * @param[out] clusters The clusters covering the whole list.
+ */
+void SplitClusters(const Dali::Vector<uint32_t>& indices, const Dali::Vector<Vector3>& positions, uint32_t maxVertices, uint32_t maxTriangles, std::vector<Cluster>& clusters);
+
+/**
+ * @brief Moves every element of the vertex attribute to its new index.
+ */
+template<typename T>
+void RemapVertices(Dali::Vector<T>& data, const std::vector<uint32_t>& remap)
+{
+  if(data.Size() != remap.size())
+  {
+    return;
+  }
+
+  Dali::Vector<T> remapped;
+  remapped.Resize(data.Size());
+  for(uint32_t i = 0; i < remap.size(); ++i)
+  {
+    remapped[remap[i]] = data[i];
+  }
+  data.Swap(remapped);
+}
+
+} // namespace MeshOptimizer
+
+} // namespace PbrDemo
+
+#endif // DALI_DEMO_PBR_MESH_OPTIMIZER_H
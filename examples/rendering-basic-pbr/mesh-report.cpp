@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "mesh-report.h"
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/file-loader.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include "obj-loader.h"
+
+namespace PbrDemo
+{
+namespace
+{
+const char* REPORT_MODELS[] = {
+  DEMO_MODEL_DIR "Dino.obj",
+  DEMO_MODEL_DIR "ToyRobot-Metal.obj",
+  DEMO_MODEL_DIR "surface_pattern_v01.obj",
+  DEMO_MODEL_DIR "surface_pattern_v02.obj",
+  DEMO_MODEL_DIR "teapot.obj",
+  DEMO_MODEL_DIR "sphere.obj",
+};
+
+const uint32_t CLUSTER_VERTICES(64u);   ///< Cluster limits of the usual meshlet size
+const uint32_t CLUSTER_TRIANGLES(124u);
+
+} // namespace
+
+void RunMeshReport()
+{
+  printf("%-24s %9s %9s %9s %6s %9s %9s %10s %10s %10s %10s %9s\n", "model", "optimized", "vertices", "triangles", "index", "ACMR file", "ACMR", "parse (ms)", "parse MB/s", "array (ms)", "optim (ms)", "clusters");
+
+  for(const char* url : REPORT_MODELS)
+  {
+    std::streampos     fileSize;
+    Dali::Vector<char> fileContent;
+    if(!FileLoader::ReadFile(url, fileSize, fileContent, FileLoader::TEXT))
+    {
+      printf("%-24s failed to read\n", strrchr(url, '/') ? strrchr(url, '/') + 1 : url);
+      continue;
+    }
+
+    for(bool optimize : {false, true})
+    {
+      ObjLoader objLoader;
+      auto      start = std::chrono::steady_clock::now();
+      objLoader.LoadObject(fileContent.Begin(), fileSize);
+      const float parseTime       = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+      const float parseThroughput = parseTime > 0.0f ? static_cast<float>(fileSize) / (parseTime * 1000.0f) : 0.0f;
+
+      objLoader.SetOptimization(optimize, optimize ? CLUSTER_VERTICES : 0u, CLUSTER_TRIANGLES);
+      objLoader.CreateGeometry(ObjLoader::TEXTURE_COORDINATES | ObjLoader::TANGENTS, true);
+
+      const ObjLoader::MeshStatistics& statistics = objLoader.GetStatistics();
+      printf("%-24s %9s %9u %9u %6s %9.3f %9.3f %10.2f %10.1f %10.2f %10.2f %9zu\n",
+             strrchr(url, '/') ? strrchr(url, '/') + 1 : url,
+             optimize ? "yes" : "no",
+             statistics.vertexCount,
+             statistics.triangleCount,
+             statistics.use32BitIndices ? "32bit" : "16bit",
+             statistics.acmrFileOrder,
+             statistics.acmrOptimized,
+             parseTime,
+             parseThroughput,
+             statistics.createTime,
+             statistics.optimizeTime,
+             objLoader.GetClusters().size());
+    }
+  }
+}
+
+} // namespace PbrDemo
@@ -0,0 +1,34 @@
+#ifndef DALI_DEMO_PBR_MESH_REPORT_H
+#define DALI_DEMO_PBR_MESH_REPORT_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+namespace PbrDemo
+{
+/**
+ * @brief Loads the OBJ models of the demo with and without the mesh optimisation and prints a table of
+ * their vertex counts, index sizes, cache miss ratios, cluster counts, load times and OBJ parse
+ * throughput in MB/s to stdout.
+ *
+ * Creates geometries, so it has to be called after the application is initialised.
+ */
+void RunMeshReport();
+
+} // namespace PbrDemo
+
+#endif // DALI_DEMO_PBR_MESH_REPORT_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -97,6 +97,11 @@ void ModelPbr::InitTexture(Texture albedoM, Texture normalR, Texture texDiffuse,
   mTextureSet.SetSampler(3, sampler);
 }
 
+void ModelPbr::SetSpecularTexture(Texture texSpecular)
+{
+  mTextureSet.SetTexture(3u, texSpecular);
+}
+
 Actor& ModelPbr::GetActor()
 {
   return mActor;
@@ -118,6 +123,7 @@ Geometry ModelPbr::CreateGeometry(const std::string& url)
 
     objLoader.ClearArrays();
     objLoader.LoadObject(fileContent.Begin(), fileSize);
+    objLoader.SetOptimization(true);
 
     geometry = objLoader.CreateGeometry(PbrDemo::ObjLoader::TEXTURE_COORDINATES | PbrDemo::ObjLoader::TANGENTS, true);
   }
@@ -2,7 +2,7 @@
 #define DALI_DEMO_MODELPBR_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -69,6 +69,15 @@ public:
    */
   void InitTexture(Texture albedoMetalTexture, Texture normalRoughTexture, Texture diffuseTexture, Texture specularTexture);
 
+  /**
+   * @brief Replaces the specular texture of the @p mTextureSet member, ie. by a texture with more mipmaps.
+   *
+   * @note Call InitTexture() before calling this method.
+   *
+   * @param[in] specularTexture The specular texture.
+   */
+  void SetSpecularTexture(Texture specularTexture);
+
   /**
    * @brief Retrieves the actor created by calling the Init() method.
    *
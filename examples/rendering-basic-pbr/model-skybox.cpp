@@ -82,6 +82,11 @@ void ModelSkybox::InitTexture(Texture texSkybox)
   mTextureSet.SetSampler(0, sampler);
 }
 
+void ModelSkybox::SetTexture(Texture texSkybox)
+{
+  mTextureSet.SetTexture(0u, texSkybox);
+}
+
 Actor& ModelSkybox::GetActor()
 {
   return mActor;
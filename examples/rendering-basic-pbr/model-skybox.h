@@ -2,7 +2,7 @@
 #define DALI_DEMO_MODELSKYBOX_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -69,6 +69,15 @@ public:
    */
   void InitTexture(Texture texSkybox);
 
+  /**
+   * @brief Replaces the texture of the @p mTextureSet member, ie. by a texture with more mipmaps.
+   *
+   * @note Call InitTexture() before calling this method.
+   *
+   * @param[in] texSkybox The skybox texture.
+   */
+  void SetTexture(Texture texSkybox);
+
   /**
    * @brief Retrieves the actor created by calling the Init() method.
    *
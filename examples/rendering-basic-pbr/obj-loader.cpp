@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,15 +20,20 @@
 
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
-#include <string.h>
+#include <chrono>
+#include <map>
 #include <sstream>
+#include <tuple>
 
 namespace PbrDemo
 {
 namespace
 {
-const int MAX_POINT_INDICES = 4;
+float MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
 }
+} // namespace
 
 ObjLoader::ObjLoader()
 : mSceneLoaded(false),
@@ -36,7 +41,10 @@ ObjLoader::ObjLoader()
   mHasTextureUv(false),
   mHasDiffuseMap(false),
   mHasNormalMap(false),
-  mHasSpecularMap(false)
+  mHasSpecularMap(false),
+  mClusterVertices(0u),
+  mClusterTriangles(0u),
+  mOptimize(false)
 {
   mSceneAABB.Init();
 }
@@ -207,12 +215,12 @@ void ObjLoader::CenterAndScale(bool center, Dali::Vector<Vector3>& points)
   mSceneAABB = newAABB;
 }
 
-void ObjLoader::CreateGeometryArray(Dali::Vector<Vector3>&        positions,
-                                    Dali::Vector<Vector3>&        normals,
-                                    Dali::Vector<Vector3>&        tangents,
-                                    Dali::Vector<Vector2>&        textures,
-                                    Dali::Vector<unsigned short>& indices,
-                                    bool                          useSoftNormals)
+void ObjLoader::CreateGeometryArray(Dali::Vector<Vector3>&  positions,
+                                    Dali::Vector<Vector3>&  normals,
+                                    Dali::Vector<Vector3>&  tangents,
+                                    Dali::Vector<Vector2>&  textures,
+                                    Dali::Vector<uint32_t>& indices,
+                                    bool                    useSoftNormals)
 {
   //We must calculate the tangents if they weren't supplied, or if they don't match up.
   bool mustCalculateTangents = (mTangents.Size() == 0) || (mTangents.Size() != mNormals.Size());
@@ -220,11 +228,18 @@ void ObjLoader::CreateGeometryArray(Dali::Vector<Vector3>&        positions,
   //However, we don't need to do this if the object doesn't use textures to begin with.
   mustCalculateTangents &= mHasTextureUv;
 
+  // The normals are calculated when the file doesn't supply one for every corner of the faces.
+  bool missingNormals = (mNormals.Size() == 0);
+  for(unsigned int ui = 0; ui < mTriangles.Size() && !missingNormals; ++ui)
+  {
+    missingNormals = (mTriangles[ui].normalIndex[0] < 0) || (mTriangles[ui].normalIndex[1] < 0) || (mTriangles[ui].normalIndex[2] < 0);
+  }
+
   // We calculate the normals if hard normals(flat normals) is set.
   // Use the normals provided by the file to make the tangent calculation per normal,
   // the correct results depends of normal generated by file, otherwise we need to recalculate
   // the normal programmatically.
-  if(((mNormals.Size() == 0) && mustCalculateTangents) || !useSoftNormals)
+  if(missingNormals || !useSoftNormals)
   {
     if(useSoftNormals)
     {
@@ -288,238 +303,147 @@ void ObjLoader::CreateGeometryArray(Dali::Vector<Vector3>&        positions,
   }
   else
   {
-    int numVertices = 3 * mTriangles.Size();
-    positions.Resize(numVertices);
-    normals.Resize(numVertices);
-    textures.Resize(numVertices);
-    tangents.Resize(numVertices);
+    int numIndices = 3 * mTriangles.Size();
+    indices.Resize(numIndices);
 
-    int index = 0;
+    int indiceIndex = 0;
 
-    //We have to normalize the arrays so we can draw we just one index array
+    //We have to normalize the arrays so we can draw we just one index array, the corners with the same attributes share a vertex
+    std::map<std::tuple<int, int, int>, uint32_t> vertices;
     for(unsigned int ui = 0; ui < mTriangles.Size(); ++ui)
     {
       for(int j = 0; j < 3; ++j)
       {
-        positions[index] = mPoints[mTriangles[ui].pointIndex[j]];
-        normals[index]   = mNormals[mTriangles[ui].normalIndex[j]];
+        const std::tuple<int, int, int> corner(mTriangles[ui].pointIndex[j], mTriangles[ui].normalIndex[j], mHasTextureUv ? mTriangles[ui].textureIndex[j] : 0);
 
-        if(mHasTextureUv)
+        auto vertex = vertices.find(corner);
+        if(vertex == vertices.end())
         {
-          textures[index] = mTextureUv[mTriangles[ui].textureIndex[j]];
-          tangents[index] = mTangents[mTriangles[ui].normalIndex[j]];
+          vertex = vertices.emplace(corner, positions.Size()).first;
+          positions.PushBack(mPoints[mTriangles[ui].pointIndex[j]]);
+          normals.PushBack(mNormals[mTriangles[ui].normalIndex[j]]);
+
+          if(mHasTextureUv)
+          {
+            textures.PushBack(mTextureUv[mTriangles[ui].textureIndex[j]]);
+            tangents.PushBack(mTangents[mTriangles[ui].normalIndex[j]]);
+          }
+          else
+          {
+            textures.PushBack(Vector2::ZERO);
+            tangents.PushBack(Vector3::ZERO);
+          }
         }
 
-        ++index;
+        indices[indiceIndex] = vertex->second;
+        indiceIndex++;
       }
     }
   }
 }
 
-bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
+void ObjLoader::OptimizeGeometryArray(Dali::Vector<Vector3>&  positions,
+                                      Dali::Vector<Vector3>&  normals,
+                                      Dali::Vector<Vector3>&  tangents,
+                                      Dali::Vector<Vector2>&  textures,
+                                      Dali::Vector<uint32_t>& indices)
 {
-  Vector3     point;
-  Vector2     texture;
-  std::string vet[MAX_POINT_INDICES], name;
-  int         ptIdx[MAX_POINT_INDICES];
-  int         nrmIdx[MAX_POINT_INDICES];
-  int         texIdx[MAX_POINT_INDICES];
-  TriIndex    triangle, triangle2;
-  int         pntAcum = 0, texAcum = 0, nrmAcum = 0;
-  bool        iniObj     = false;
-  bool        hasTexture = false;
-
-  //Init AABB for the file
-  mSceneAABB.Init();
+  const uint32_t vertexCount = positions.Size();
 
-  std::string        input(objBuffer, fileSize);
-  std::istringstream ss(input);
-  ss.imbue(std::locale("C"));
+  mStatistics.acmrFileOrder = MeshOptimizer::CalculateAcmr(indices, vertexCount);
+  mStatistics.acmrOptimized = mStatistics.acmrFileOrder;
+  mClusters.clear();
 
-  std::string line;
-  std::getline(ss, line);
-
-  while(std::getline(ss, line))
+  if(mOptimize)
   {
-    std::istringstream isline(line, std::istringstream::in);
-    std::string        tag;
-
-    isline >> tag;
+    // The order of the file is kept when the optimiser can't beat it
+    Dali::Vector<uint32_t> optimized = indices;
+    MeshOptimizer::OptimizeVertexCache(optimized, vertexCount);
+    MeshOptimizer::OptimizeOverdraw(optimized, positions);
 
-    if(tag == "v")
+    const float acmr = MeshOptimizer::CalculateAcmr(optimized, vertexCount);
+    if(acmr < mStatistics.acmrFileOrder)
     {
-      //Two different objects in the same file
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
-      mPoints.PushBack(point);
-
-      mSceneAABB.ConsiderNewPointInVolume(point);
+      indices.Swap(optimized);
+      mStatistics.acmrOptimized = acmr;
     }
-    else if(tag == "vn")
-    {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
 
-      mNormals.PushBack(point);
-    }
-    else if(tag == "#_#tangent")
-    {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
-
-      mTangents.PushBack(point);
-    }
-    else if(tag == "#_#binormal")
-    {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
-
-      mBiTangents.PushBack(point);
-    }
-    else if(tag == "vt")
-    {
-      isline >> texture.x;
-      isline >> texture.y;
-      texture.y = 1.0 - texture.y;
-      mTextureUv.PushBack(texture);
-    }
-    else if(tag == "#_#vt1")
-    {
-      isline >> texture.x;
-      isline >> texture.y;
-
-      texture.y = 1.0 - texture.y;
-      mTextureUv2.PushBack(texture);
-    }
-    else if(tag == "s")
-    {
-    }
-    else if(tag == "f")
-    {
-      if(!iniObj)
-      {
-        //name assign
-
-        iniObj = true;
-      }
+    std::vector<uint32_t> remap;
+    MeshOptimizer::OptimizeVertexFetch(indices, vertexCount, remap);
+    MeshOptimizer::RemapVertices(positions, remap);
+    MeshOptimizer::RemapVertices(normals, remap);
+    MeshOptimizer::RemapVertices(tangents, remap);
+    MeshOptimizer::RemapVertices(textures, remap);
+  }
 
-      int numIndices = 0;
-      while((numIndices < MAX_POINT_INDICES) && (isline >> vet[numIndices]))
-      {
-        numIndices++;
-      }
+  if(mClusterVertices > 0u)
+  {
+    MeshOptimizer::SplitClusters(indices, positions, mClusterVertices, mClusterTriangles, mClusters);
+  }
+}
 
-      //Hold slashes that separate attributes of the same point.
-      char separator;
-      char separator2;
+bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
+{
+  DemoHelper::ObjData   data;
+  DemoHelper::ObjReader reader;
+  if(!reader.Parse(objBuffer, static_cast<size_t>(fileSize), data))
+  {
+    DALI_LOG_ERROR("OBJ parse error at line %u: %s\n", reader.GetErrorLine(), reader.GetError().c_str());
+    return false;
+  }
 
-      const char* subString; //A pointer to the position in the string as we move through it.
+  if(data.triangles.Empty())
+  {
+    return false;
+  }
 
-      subString = strstr(vet[0].c_str(), "/"); //Search for the first '/'
+  // The texture coordinates of the demo are upside down compared to the file
+  for(Vector2& textureCoordinate : data.textureCoordinates)
+  {
+    textureCoordinate.y = 1.0f - textureCoordinate.y;
+  }
+  for(Vector2& textureCoordinate : data.textureCoordinates2)
+  {
+    textureCoordinate.y = 1.0f - textureCoordinate.y;
+  }
 
-      if(subString)
-      {
-        if(subString[1] == '/') // Of the form A//C, so has points and normals but no texture coordinates.
-        {
-          for(int i = 0; i < numIndices; i++)
-          {
-            std::istringstream isindex(vet[i]);
-            isindex >> ptIdx[i] >> separator >> separator2 >> nrmIdx[i];
-            texIdx[i] = 0;
-          }
-        }
-        else if(strstr(subString, "/")) // Of the form A/B/C, so has points, textures and normals.
-        {
-          for(int i = 0; i < numIndices; i++)
-          {
-            std::istringstream isindex(vet[i]);
-            isindex >> ptIdx[i] >> separator >> texIdx[i] >> separator2 >> nrmIdx[i];
-          }
+  mPoints.Swap(data.points);
+  mNormals.Swap(data.normals);
+  mTextureUv.Swap(data.textureCoordinates);
+  mTextureUv2.Swap(data.textureCoordinates2);
+  mTangents.Swap(data.tangents);
+  mBiTangents.Swap(data.binormals);
+  mTriangles.Swap(data.triangles);
 
-          hasTexture = true;
-        }
-        else // Of the form A/B, so has points and textures but no normals.
-        {
-          for(int i = 0; i < numIndices; i++)
-          {
-            std::istringstream isindex(vet[i]);
-            isindex >> ptIdx[i] >> separator >> texIdx[i];
-            nrmIdx[i] = 0;
-          }
+  mSceneAABB.pointMin = data.pointMin;
+  mSceneAABB.pointMax = data.pointMax;
 
-          hasTexture = true;
-        }
-      }
-      else // Simply of the form A, as in, point indices only.
-      {
-        for(int i = 0; i < numIndices; i++)
-        {
-          std::istringstream isindex(vet[i]);
-          isindex >> ptIdx[i];
-          texIdx[i] = 0;
-          nrmIdx[i] = 0;
-        }
-      }
+  CenterAndScale(true, mPoints);
+  mSceneLoaded  = true;
+  mHasTextureUv = data.hasTextureIndices;
 
-      //If it is a triangle
-      if(numIndices == 3)
-      {
-        for(int i = 0; i < 3; i++)
-        {
-          triangle.pointIndex[i]   = ptIdx[i] - 1 - pntAcum;
-          triangle.normalIndex[i]  = nrmIdx[i] - 1 - nrmAcum;
-          triangle.textureIndex[i] = texIdx[i] - 1 - texAcum;
-        }
-        mTriangles.PushBack(triangle);
-      }
-      //If on the other hand it is a quad, we will create two triangles
-      else if(numIndices == 4)
+  // The corners without texture coordinate of a textured model use a default one at the end of the array
+  if(mHasTextureUv)
+  {
+    const int32_t defaultUv = static_cast<int32_t>(mTextureUv.Size());
+    bool          missingUv = false;
+    for(TriIndex& triangle : mTriangles)
+    {
+      for(int32_t& textureIndex : triangle.textureIndex)
       {
-        for(int i = 0; i < 3; i++)
+        if(textureIndex < 0)
         {
-          triangle.pointIndex[i]   = ptIdx[i] - 1 - pntAcum;
-          triangle.normalIndex[i]  = nrmIdx[i] - 1 - nrmAcum;
-          triangle.textureIndex[i] = texIdx[i] - 1 - texAcum;
+          textureIndex = defaultUv;
+          missingUv    = true;
         }
-        mTriangles.PushBack(triangle);
-
-        for(int i = 0; i < 3; i++)
-        {
-          int idx                   = (i + 2) % numIndices;
-          triangle2.pointIndex[i]   = ptIdx[idx] - 1 - pntAcum;
-          triangle2.normalIndex[i]  = nrmIdx[idx] - 1 - nrmAcum;
-          triangle2.textureIndex[i] = texIdx[idx] - 1 - texAcum;
-        }
-        mTriangles.PushBack(triangle2);
       }
     }
-    else if(tag == "usemtl")
-    {
-      /// Do nothing.
-    }
-    else if(tag == "mtllib")
+    if(missingUv)
     {
-      /// Do nothing.
-    }
-    else if(tag == "g")
-    {
-      isline >> name;
+      mTextureUv.PushBack(Vector2::ZERO);
     }
   }
-
-  if(iniObj)
-  {
-    CenterAndScale(true, mPoints);
-    mSceneLoaded  = true;
-    mHasTextureUv = hasTexture;
-    return true;
-  }
-
-  return false;
+  return true;
 }
 
 void ObjLoader::LoadMaterial(char*          objBuffer,
@@ -595,13 +519,23 @@ Geometry ObjLoader::CreateGeometry(int objectProperties, bool useSoftNormals)
 {
   Geometry surface = Geometry::New();
 
-  Dali::Vector<Vector3>        positions;
-  Dali::Vector<Vector3>        normals;
-  Dali::Vector<Vector3>        tangents;
-  Dali::Vector<Vector2>        textures;
-  Dali::Vector<unsigned short> indices;
+  Dali::Vector<Vector3>  positions;
+  Dali::Vector<Vector3>  normals;
+  Dali::Vector<Vector3>  tangents;
+  Dali::Vector<Vector2>  textures;
+  Dali::Vector<uint32_t> indices;
 
+  auto start = std::chrono::steady_clock::now();
   CreateGeometryArray(positions, normals, tangents, textures, indices, useSoftNormals);
+  mStatistics.createTime = MillisecondsSince(start);
+
+  start = std::chrono::steady_clock::now();
+  OptimizeGeometryArray(positions, normals, tangents, textures, indices);
+  mStatistics.optimizeTime = MillisecondsSince(start);
+
+  mStatistics.vertexCount     = positions.Count();
+  mStatistics.triangleCount   = indices.Count() / 3u;
+  mStatistics.use32BitIndices = positions.Count() > std::numeric_limits<uint16_t>::max() + 1u;
 
   //All vertices need at least Position and Normal
 
@@ -640,15 +574,42 @@ Geometry ObjLoader::CreateGeometry(int objectProperties, bool useSoftNormals)
     surface.AddVertexBuffer(texCoordBuffer);
   }
 
-  //If indices are required, we set them.
-  if(indices.Size())
+  //If indices are required, we set them. 16 bit indices are used when they can address every vertex.
+  if(indices.Size() && mStatistics.use32BitIndices)
   {
     surface.SetIndexBuffer(&indices[0], indices.Size());
   }
+  else if(indices.Size())
+  {
+    Dali::Vector<unsigned short> shortIndices;
+    shortIndices.Resize(indices.Size());
+    for(uint32_t i = 0; i < indices.Size(); ++i)
+    {
+      shortIndices[i] = static_cast<unsigned short>(indices[i]);
+    }
+    surface.SetIndexBuffer(&shortIndices[0], shortIndices.Size());
+  }
 
   return surface;
 }
 
+void ObjLoader::SetOptimization(bool optimize, uint32_t clusterVertices, uint32_t clusterTriangles)
+{
+  mOptimize         = optimize;
+  mClusterVertices  = clusterVertices;
+  mClusterTriangles = clusterTriangles;
+}
+
+const ObjLoader::MeshStatistics& ObjLoader::GetStatistics() const
+{
+  return mStatistics;
+}
+
+const std::vector<MeshOptimizer::Cluster>& ObjLoader::GetClusters() const
+{
+  return mClusters;
+}
+
 Vector3 ObjLoader::GetCenter()
 {
   Vector3 center = GetSize() * 0.5 + mSceneAABB.pointMin;
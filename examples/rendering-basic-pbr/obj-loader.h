@@ -2,7 +2,7 @@
 #define DALI_DEMO_PBR_OBJ_LOADER_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,11 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/rendering/geometry.h>
 #include <limits>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "mesh-optimizer.h"
+#include "shared/obj-reader.h"
 
 using namespace Dali;
 
@@ -29,12 +34,7 @@ namespace PbrDemo
 class ObjLoader
 {
 public:
-  struct TriIndex
-  {
-    int pointIndex[3];
-    int normalIndex[3];
-    int textureIndex[3];
-  };
+  using TriIndex = DemoHelper::ObjTriangle;
 
   struct BoundingVolume
   {
@@ -67,6 +67,20 @@ public:
     BINORMALS           = 1 << 2
   };
 
+  /**
+   * @brief Describes the last geometry created, and the time it took.
+   */
+  struct MeshStatistics
+  {
+    uint32_t vertexCount{0u};
+    uint32_t triangleCount{0u};
+    bool     use32BitIndices{false}; ///< Whether the geometry has more vertices than 16 bit indices can address
+    float    acmrFileOrder{0.0f};    ///< Cache misses per triangle in the order of the file
+    float    acmrOptimized{0.0f};    ///< Cache misses per triangle after the optimisation
+    float    createTime{0.0f};       ///< Time spent creating the vertex arrays in milliseconds
+    float    optimizeTime{0.0f};     ///< Time spent optimising in milliseconds
+  };
+
   ObjLoader();
   virtual ~ObjLoader();
 
@@ -79,6 +93,18 @@ public:
 
   Geometry CreateGeometry(int objectProperties, bool useSoftNormals);
 
+  /**
+   * @brief Sets how the geometries created afterwards are optimised.
+   *
+   * @param[in] optimize Whether the triangles are reordered for the vertex cache and overdraw, and the vertices for fetching.
+   * @param[in] clusterVertices The maximum number of vertices of a cluster, no clusters are made if it is 0.
+   * @param[in] clusterTriangles The maximum number of triangles of a cluster.
+   */
+  void SetOptimization(bool optimize, uint32_t clusterVertices = 0u, uint32_t clusterTriangles = 0u);
+
+  const MeshStatistics&                      GetStatistics() const;
+  const std::vector<MeshOptimizer::Cluster>& GetClusters() const;
+
   Vector3 GetCenter();
   Vector3 GetSize();
 
@@ -100,6 +126,12 @@ private:
 
   BoundingVolume mSceneAABB;
 
+  MeshStatistics                      mStatistics;
+  std::vector<MeshOptimizer::Cluster> mClusters; ///< Index ranges of the clusters of the last geometry created
+  uint32_t                            mClusterVertices;
+  uint32_t                            mClusterTriangles;
+  bool                                mOptimize;
+
   bool mSceneLoaded;
   bool mMaterialLoaded;
   bool mHasTextureUv;
@@ -152,14 +184,24 @@ private:
    * @param[out] tangents The tangents of the vertices of the object.
    * @param[out] textures The texture coordinates of the vertices of the object.
    * @param[out] indices Indices of corresponding values to match triangles to their respective data.
+   *                     The corners sharing their point, normal and texture coordinate share a vertex.
    * @param[in] useSoftNormals Indicates whether we should average the normals at each point to smooth the surface or not.
    */
-  void CreateGeometryArray(Dali::Vector<Vector3>&        positions,
-                           Dali::Vector<Vector3>&        normals,
-                           Dali::Vector<Vector3>&        tangents,
-                           Dali::Vector<Vector2>&        textures,
-                           Dali::Vector<unsigned short>& indices,
-                           bool                          useSoftNormals);
+  void CreateGeometryArray(Dali::Vector<Vector3>&  positions,
+                           Dali::Vector<Vector3>&  normals,
+                           Dali::Vector<Vector3>&  tangents,
+                           Dali::Vector<Vector2>&  textures,
+                           Dali::Vector<uint32_t>& indices,
+                           bool                    useSoftNormals);
+
+  /**
+   * @brief Reorders the triangles and vertices, and splits the triangles into clusters, as set by SetOptimization().
+   */
+  void OptimizeGeometryArray(Dali::Vector<Vector3>&  positions,
+                             Dali::Vector<Vector3>&  normals,
+                             Dali::Vector<Vector3>&  tangents,
+                             Dali::Vector<Vector2>&  textures,
+                             Dali::Vector<uint32_t>& indices);
 };
 
 } // namespace PbrDemo
@@ -19,6 +19,10 @@
 #include <dali-toolkit/dali-toolkit.h>
 
 #include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <cmath>
+#include <limits>
 #include <sstream>
 
 // INTERNAL INCLUDES
@@ -26,8 +30,10 @@
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
 #include "ktx-loader.h"
+#include "mesh-report.h"
 #include "model-pbr.h"
 #include "model-skybox.h"
+#include "shared/process-memory.h"
 using Dali::Integration::GetStdString;
 using Dali::Integration::ToDaliString;
 using Dali::Integration::ToDaliStringView;
@@ -68,6 +74,19 @@ const float   CAMERA_DEFAULT_NEAR(0.1f);
 const float   CAMERA_DEFAULT_FAR(1000.0f);
 const Vector3 CAMERA_DEFAULT_POSITION(0.0f, 0.0f, 3.5f);
 
+const uint32_t CUBEMAP_PREVIEW_SIZE(32u);      ///< Largest mipmap of the first specular texture
+const int      CUBEMAP_STREAM_INTERVAL_MS(16); ///< Interval of the specular texture uploads
+
+bool gMeshReport(false);   ///< Prints the mesh optimisation report and quits, set by --mesh-report
+bool gStreamCubeMap(true); ///< Streams the specular cube map, the whole map is loaded at once with --no-cubemap-streaming
+
+std::chrono::steady_clock::time_point gStartTime; ///< Time the application was started
+
+float MillisecondsSinceStart()
+{
+  return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - gStartTime).count();
+}
+
 } // namespace
 
 /*
@@ -79,6 +98,14 @@ const Vector3 CAMERA_DEFAULT_POSITION(0.0f, 0.0f, 3.5f);
  * - Pan up/down on right side of screen to change metalness
  * - Pan anywhere else to rotate scene
  *
+ * With --mesh-report the OBJ models of the demo are loaded with and without the mesh optimisation,
+ * a table of their cache miss ratios, load times and parse throughput is printed, then the application quits.
+ *
+ * The specular cube map is streamed from the memory mapped file: the first frame shows its smallest
+ * mipmaps only, larger ones are uploaded on the following frames. The time to the first frame,
+ * the time to the complete cube map and the peak resident set size are logged. Pass
+ * --no-cubemap-streaming to upload the whole cube map before the first frame instead.
+ *
  */
 
 class BasicPbrController : public ConnectionTracker
@@ -90,6 +117,8 @@ public:
     m3dRoot(),
     mUiRoot(),
     mDoubleTapTime(),
+    mStreamTimer(),
+    mSpecularStream(),
     mModelOrientation(),
     mRoughness(1.f),
     mMetalness(0.f),
@@ -108,6 +137,13 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application application)
   {
+    if(gMeshReport)
+    {
+      PbrDemo::RunMeshReport();
+      mApplication.Quit();
+      return;
+    }
+
     // Get a handle to the window
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::BLACK);
@@ -138,6 +174,55 @@ public:
 
     mDoubleTapTime = Timer::New(150);
     mDoubleTapTime.TickSignal().Connect(this, &BasicPbrController::OnDoubleTapTime);
+
+    // The larger mipmaps of the specular cube map are uploaded once the first frame is on the screen
+    window.AddFramePresentedCallback(MakeCallback(this, &BasicPbrController::OnFirstFramePresented), 0);
+    if(!mSpecularStream.IsComplete())
+    {
+      mStreamTimer = Timer::New(CUBEMAP_STREAM_INTERVAL_MS);
+      mStreamTimer.TickSignal().Connect(this, &BasicPbrController::OnStreamTick);
+    }
+  }
+
+  void OnFirstFramePresented(int frameId)
+  {
+    DALI_LOG_RELEASE_INFO("First frame presented after %.1f ms, peak RSS %lu kB\n", MillisecondsSinceStart(), DemoHelper::GetProcessMemoryKb("VmHWM:"));
+    if(mStreamTimer)
+    {
+      mStreamTimer.Start();
+    }
+  }
+
+  /**
+   * Replaces the specular texture by the next one of the stream, with one more mipmap
+   */
+  bool OnStreamTick()
+  {
+    Texture specularTexture = mSpecularStream.LoadNext();
+    if(specularTexture)
+    {
+      SetSpecularTexture(specularTexture);
+    }
+
+    if(!specularTexture || mSpecularStream.IsComplete())
+    {
+      DALI_LOG_RELEASE_INFO("Cube map complete after %.1f ms, %u kB uploaded, peak RSS %lu kB\n", MillisecondsSinceStart(), mSpecularStream.GetUploadedBytes() / 1024u, DemoHelper::GetProcessMemoryKb("VmHWM:"));
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Sets the specular texture to the models and to the skybox
+   */
+  void SetSpecularTexture(Texture specularTexture)
+  {
+    mModel[0].SetSpecularTexture(specularTexture);
+    mModel[1].SetSpecularTexture(specularTexture);
+    mSkybox.SetTexture(specularTexture);
+
+    // The shader selects the mipmap by its distance to the 1x1 level, which moves with the size of the texture
+    mShader.RegisterProperty("uMaxLOD", std::log2(static_cast<float>(specularTexture.GetWidth())));
   }
 
   bool OnDoubleTapTime()
@@ -336,6 +421,7 @@ public:
 
     // Initialise shader uniforms
     // Level 8 because the environment texture has 6 levels plus 2 are missing (2x2 and 1x1)
+    // It is lowered while the specular cube map is streamed, see SetSpecularTexture()
     mShader.RegisterProperty("uMaxLOD", 8.0f);
     mShader.RegisterProperty("uRoughness", 1.0f);
     mShader.RegisterProperty("uMetallic", 0.0f);
@@ -355,34 +441,21 @@ public:
     textureNormalRough.Upload(normalPixelData, 0, 0, 0, 0, normalPixelData.GetWidth(), normalPixelData.GetHeight());
 
     // This texture should have 6 faces and only one mipmap
-    PbrDemo::CubeData diffuse;
-    PbrDemo::LoadCubeMapFromKtxFile(CUBEMAP_DIFFUSE_TEXTURE_URL, diffuse);
+    PbrDemo::KtxCubeMapStream diffuse;
+    diffuse.Open(CUBEMAP_DIFFUSE_TEXTURE_URL, std::numeric_limits<uint32_t>::max());
+    Texture diffuseTexture = diffuse.LoadNext();
 
-    Texture diffuseTexture = Texture::New(TextureType::TEXTURE_CUBE, diffuse.img[0][0].GetPixelFormat(), diffuse.img[0][0].GetWidth(), diffuse.img[0][0].GetHeight());
-    for(unsigned int midmapLevel = 0; midmapLevel < diffuse.img[0].size(); ++midmapLevel)
-    {
-      for(unsigned int i = 0; i < diffuse.img.size(); ++i)
-      {
-        diffuseTexture.Upload(diffuse.img[i][midmapLevel], CubeMapLayer::POSITIVE_X + i, midmapLevel, 0, 0, diffuse.img[i][midmapLevel].GetWidth(), diffuse.img[i][midmapLevel].GetHeight());
-      }
-    }
-
-    // This texture should have 6 faces and 6 mipmaps
-    PbrDemo::CubeData specular;
-    PbrDemo::LoadCubeMapFromKtxFile(CUBEMAP_SPECULAR_TEXTURE_URL, specular);
-
-    Texture specularTexture = Texture::New(TextureType::TEXTURE_CUBE, specular.img[0][0].GetPixelFormat(), specular.img[0][0].GetWidth(), specular.img[0][0].GetHeight());
-    for(unsigned int midmapLevel = 0; midmapLevel < specular.img[0].size(); ++midmapLevel)
-    {
-      for(unsigned int i = 0; i < specular.img.size(); ++i)
-      {
-        specularTexture.Upload(specular.img[i][midmapLevel], CubeMapLayer::POSITIVE_X + i, midmapLevel, 0, 0, specular.img[i][midmapLevel].GetWidth(), specular.img[i][midmapLevel].GetHeight());
-      }
-    }
+    // This texture should have 6 faces and 7 mipmaps, only the smallest ones are uploaded now
+    mSpecularStream.Open(CUBEMAP_SPECULAR_TEXTURE_URL, gStreamCubeMap ? CUBEMAP_PREVIEW_SIZE : std::numeric_limits<uint32_t>::max());
+    Texture specularTexture = mSpecularStream.LoadNext();
 
     mModel[0].InitTexture(textureAlbedoMetal, textureNormalRough, diffuseTexture, specularTexture);
     mModel[1].InitTexture(textureAlbedoMetal, textureNormalRough, diffuseTexture, specularTexture);
     mSkybox.InitTexture(specularTexture);
+    if(specularTexture)
+    {
+      mShader.RegisterProperty("uMaxLOD", std::log2(static_cast<float>(specularTexture.GetWidth())));
+    }
   }
 
   /**
@@ -448,6 +521,9 @@ private:
   Shader       mShader;
   Animation    mAnimation;
   Timer        mDoubleTapTime;
+  Timer        mStreamTimer;
+
+  PbrDemo::KtxCubeMapStream mSpecularStream;
 
   ModelSkybox mSkybox;
   ModelPbr    mModel[2];
@@ -464,7 +540,22 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
-  Application        application = Application::New(&argc, &argv);
+  gStartTime = std::chrono::steady_clock::now();
+
+  Application application = Application::New(&argc, &argv);
+
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i], "--mesh-report") == 0)
+    {
+      gMeshReport = true;
+    }
+    else if(strcmp(argv[i], "--no-cubemap-streaming") == 0)
+    {
+      gStreamCubeMap = false;
+    }
+  }
+
   BasicPbrController test(application);
   application.MainLoop();
   return 0;
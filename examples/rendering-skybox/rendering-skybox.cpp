@@ -18,6 +18,7 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
 
+#include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
 #include "generated/rendering-skybox-cube-frag.h"
 #include "generated/rendering-skybox-cube-vert.h"
@@ -25,6 +26,10 @@
 #include "generated/rendering-skybox-frag.h"
 #include "generated/rendering-skybox-vert.h"
 #include "look-camera.h"
+#include "shared/process-memory.h"
+
+#include <chrono>
+
 using Dali::Integration::GetStdString;
 using Dali::Integration::ToDaliString;
 using Dali::Integration::ToDaliStringView;
@@ -78,12 +83,17 @@ const char* SKYBOX_FACES[SKYBOX_FACE_COUNT] =
  * https://creativecommons.org/licenses/by-sa/4.0
  */
 const char* EQUIRECTANGULAR_TEXTURE_URL = DEMO_IMAGE_DIR "veste_oberhaus_spherical_panoramic.jpg";
+
+std::chrono::steady_clock::time_point gStartTime; ///< Time the application was started
+
 } // namespace
 
 // This example shows how to create a skybox
 //
 // Recommended screen size on desktop: 1280x720
 //
+// The time to the first frame and the peak resident set size are logged once the first frame is presented.
+//
 class TexturedCubeController : public ConnectionTracker
 {
 public:
@@ -137,6 +147,14 @@ public:
     mDoubleTapGesture = TapGestureDetector::New(2);
     mDoubleTapGesture.Attach(window.GetRootLayer());
     mDoubleTapGesture.DetectedSignal().Connect(this, &TexturedCubeController::OnDoubleTap);
+
+    window.AddFramePresentedCallback(MakeCallback(this, &TexturedCubeController::OnFirstFramePresented), 0);
+  }
+
+  void OnFirstFramePresented(int frameId)
+  {
+    const float milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - gStartTime).count();
+    DALI_LOG_RELEASE_INFO("First frame presented after %.1f ms, peak RSS %lu kB\n", milliseconds, DemoHelper::GetProcessMemoryKb("VmHWM:"));
   }
 
   /**
@@ -468,6 +486,8 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  gStartTime = std::chrono::steady_clock::now();
+
   Application            application = Application::New(&argc, &argv);
   TexturedCubeController test(application);
   application.MainLoop();
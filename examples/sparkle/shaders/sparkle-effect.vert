@@ -18,7 +18,10 @@ UNIFORM mat4  uMvpMatrix;
 UNIFORM float uPercentage;
 UNIFORM float uPercentageMarked;
 UNIFORM vec3  uParticleColors[NUM_COLOR];
-UNIFORM float uOpacity[NUM_PARTICLE];
+UNIFORM float uOpacityTime;
+UNIFORM vec4  uOpacityTiming;
+UNIFORM vec2  uOpacityRange;
+UNIFORM float uOpacityEasing;
 UNIFORM vec2  uTapIndices;
 UNIFORM float uTapOffset[MAXIMUM_ANIMATION_COUNT];
 UNIFORM vec2  uTapPoint[MAXIMUM_ANIMATION_COUNT];
@@ -28,13 +31,26 @@ UNIFORM float uEffectScale;
 UNIFORM float uBreak;
 };
 
+// The opacity of every particle goes from uOpacityRange.x to uOpacityRange.y during its own time period,
+// which starts at (uOpacityTiming.x + uOpacityTiming.y*idx)*idx and lasts uOpacityTiming.z + uOpacityTiming.w*idx*idx.
+// A single animation of uOpacityTime fades all the particles one after another.
+float ParticleOpacity(float idx)
+{
+  float start = (uOpacityTiming.x + uOpacityTiming.y*idx)*idx;
+  float duration = uOpacityTiming.z + uOpacityTiming.w*idx*idx;
+  float progress = duration > 0.0 ? clamp((uOpacityTime-start)/duration, 0.0, 1.0) : step(start, uOpacityTime);
+  progress = mix(progress, 0.5-0.5*cos(progress*3.14159265), uOpacityEasing); // ease in out sine
+  return mix(uOpacityRange.x, uOpacityRange.y, progress);
+}
+
 void main()
 {
   // we store the particle index inside texCoord attribute
   float idx = abs(aTexCoord.y)-1.0;
+  float opacity = ParticleOpacity(idx);
 
   // early out if the particle is invisible
-  if(uOpacity[int(idx)]<1e-5)
+  if(opacity<1e-5)
   {
     gl_Position = vec4(0.0);
     vColor = vec4(0.0);
@@ -75,7 +91,7 @@ void main()
     position = mix( position, edgePoint, uTapOffset[id] ) ;
   }
 
-  position = mix( position, vec2( 250.0,250.0 ),uBreak*(1.0-uOpacity[int(idx)]) ) ;
+  position = mix( position, vec2( 250.0,250.0 ),uBreak*(1.0-opacity) ) ;
 
   // vertex position on the mesh: (sign(aTexCoord.x), sign(aTexCoord.y))*PARTICLE_HALF_SIZE
   gl_Position = uMvpMatrix * vec4( position.x+sign(aTexCoord.x)*PARTICLE_HALF_SIZE/uEffectScale,
@@ -85,7 +101,7 @@ void main()
   // we store the color index inside texCoord attribute
   float colorIndex = abs(aTexCoord.x);
   vColor.rgb = uParticleColors[int(colorIndex)-1];
-  vColor.a = fract(colorIndex) * uOpacity[int(idx)];
+  vColor.a = fract(colorIndex) * opacity;
 
   // produce a 'seemingly' random fade in/out
   percentage = mod(uPercentage+increment+0.15, 1.0);
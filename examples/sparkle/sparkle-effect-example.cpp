@@ -282,7 +282,7 @@ private:
       {
         case 0:
         {
-          PlayParticleFadeAnimation(0, NUM_PARTICLE, 0.f, 3.f);
+          PlayParticleFadeAnimation(0.f, 3.f);
           break;
         }
         case 1:
@@ -371,49 +371,36 @@ private:
     breakAnimation.AnimateTo(Property(mMeshActor, Actor::Property::POSITION), ACTOR_POSITION, EaseOutSquare);
     breakAnimation.FinishedSignal().Connect(this, &SparkleEffectExample::OnBreakAnimationFinished);
 
-    float              timeUnit = duration / (NUM_PARTICLE + 1) / (NUM_PARTICLE + 1);
-    std::ostringstream oss;
-    for(unsigned int i = 0; i < NUM_PARTICLE; i++)
-    {
-      oss.str("");
-      oss << OPACITY_UNIFORM_NAME << i << "]";
-      mEffect.SetProperty(mEffect.GetPropertyIndex(ToDaliString(oss.str())), 0.01f);
-      float timeSlice = timeUnit * i * i;
-      breakAnimation.AnimateTo(Property(mEffect, ToDaliString(oss.str())), 1.f, AlphaFunction::EASE_IN_OUT_SINE, TimePeriod(timeSlice * 0.5f, timeSlice));
-    }
+    // the particle i fades in with an ease in out sine during TimePeriod( timeUnit * i * i * 0.5, timeUnit * i * i )
+    float timeUnit = duration / (NUM_PARTICLE + 1) / (NUM_PARTICLE + 1);
+    SetParticleFade(Vector4(0.f, timeUnit * 0.5f, 0.f, timeUnit), Vector2(0.01f, 1.f), true);
+    breakAnimation.AnimateTo(Property(mEffect, ToDaliString(OPACITY_TIME_UNIFORM_NAME)), duration * 1.5f, AlphaFunction::LINEAR);
 
     breakAnimation.Play();
   }
 
   /**
    * Animate the particle opacity
-   * Particles with index between startIndex ~ startIndex+numParticle-1 fade to the target opacity one after another
-   * @param[in] startIndex The index of the first particle
-   * @param[in] numParticle The number of particle to change opacity
+   * All the particles fade to the target opacity one after another
    * @param[in] targetValue The final opacity
    * @param[in] duration The duration for the animation
    */
-  void PlayParticleFadeAnimation(unsigned int startIndex, unsigned int numParticle, float targetValue, float duration)
+  void PlayParticleFadeAnimation(float targetValue, float duration)
   {
     if(GetFloatUniformValue(BREAK_UNIFORM_NAME) > 0.f)
     {
       return;
     }
 
-    // start the opacity animation one particle after another gradually
-    float timeSlice    = duration / (numParticle + 1);
+    // start the opacity animation one particle after another gradually: the particle i fades during TimePeriod( timeSlice * i, fadeDuration * 2 )
+    float timeSlice    = duration / (NUM_PARTICLE + 1);
     float fadeDuration = timeSlice > 0.5f ? timeSlice : 0.5f;
 
-    Animation          fadeAnimation = Animation::New(duration + fadeDuration * 2.f);
-    std::ostringstream oss;
-    for(unsigned int i = startIndex; i < numParticle; i++)
-    {
-      if(i >= NUM_PARTICLE) break; // out of bound
+    Vector2 opacityRange = mEffect.GetProperty<Vector2>(mEffect.GetPropertyIndex(ToDaliString(OPACITY_RANGE_UNIFORM_NAME)));
+    SetParticleFade(Vector4(timeSlice, 0.f, fadeDuration * 2.f, 0.f), Vector2(opacityRange.y, targetValue), false);
 
-      oss.str("");
-      oss << OPACITY_UNIFORM_NAME << i << "]";
-      fadeAnimation.AnimateTo(Property(mEffect, ToDaliString(oss.str())), targetValue, TimePeriod(timeSlice * i, fadeDuration * 2.f));
-    }
+    Animation fadeAnimation = Animation::New(duration + fadeDuration * 2.f);
+    fadeAnimation.AnimateTo(Property(mEffect, ToDaliString(OPACITY_TIME_UNIFORM_NAME)), duration + fadeDuration * 2.f, AlphaFunction::LINEAR);
 
     fadeAnimation.Play();
     mFadeAnimation = fadeAnimation;
@@ -510,6 +497,20 @@ private:
     animation.Reset();
   }
 
+  /**
+   * Helper to prepare a fade of the particles, the opacity time is reset to the start of the fade
+   * @param[in] timing The start ( x + y * index ) * index and the duration z + w * index * index of the fade of each particle
+   * @param[in] range The opacity of the particles before and after the fade
+   * @param[in] easeInOutSine Whether the particles fade with an ease in out sine instead of linearly
+   */
+  void SetParticleFade(const Vector4& timing, const Vector2& range, bool easeInOutSine)
+  {
+    mEffect.SetProperty(mEffect.GetPropertyIndex(ToDaliString(OPACITY_TIMING_UNIFORM_NAME)), timing);
+    mEffect.SetProperty(mEffect.GetPropertyIndex(ToDaliString(OPACITY_RANGE_UNIFORM_NAME)), range);
+    mEffect.SetProperty(mEffect.GetPropertyIndex(ToDaliString(OPACITY_EASING_UNIFORM_NAME)), easeInOutSine ? 1.f : 0.f);
+    mEffect.SetProperty(mEffect.GetPropertyIndex(ToDaliString(OPACITY_TIME_UNIFORM_NAME)), 0.f);
+  }
+
   /**
    * Helper retrieve a uniform value from the Sparkle effect shader
    * @param[in] uniformName The uniform
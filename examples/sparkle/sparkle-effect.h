@@ -40,8 +40,14 @@ namespace SparkleEffect
 const std::string PERCENTAGE_UNIFORM_NAME("uPercentage");
 // uniform array of particle color, set their value as the PARTICLE_COLORS given below
 const std::string PARTICLE_COLOR_UNIFORM_NAME("uParticleColors[");
-// uniform array of particle opacity
-const std::string OPACITY_UNIFORM_NAME("uOpacity[");
+// uniform which drives the particle opacity, every particle fades during its own period of this time
+const std::string OPACITY_TIME_UNIFORM_NAME("uOpacityTime");
+// uniform which gives the start ( x + y * index ) * index and the duration z + w * index * index of the fade of each particle
+const std::string OPACITY_TIMING_UNIFORM_NAME("uOpacityTiming");
+// uniform which gives the opacity of the particles before and after their fade
+const std::string OPACITY_RANGE_UNIFORM_NAME("uOpacityRange");
+// uniform which selects the linear ( 0.0 ) or the ease in out sine ( 1.0 ) fade
+const std::string OPACITY_EASING_UNIFORM_NAME("uOpacityEasing");
 // uniform which offsets the path control point, with this values >=0, the paths are squeezed towards the GatheringPoint
 const std::string ACCELARATION_UNIFORM_NAME("uAcceleration");
 // uniform which indicates the ongoing tap animations
@@ -251,13 +257,10 @@ Shader New()
   handle.RegisterProperty("uEffectScale", ACTOR_SCALE);
 
   // set the initial uniform values
-
-  for(unsigned int i = 0; i < NUM_PARTICLE; i++)
-  {
-    oss.str("");
-    oss << OPACITY_UNIFORM_NAME << i << "]";
-    handle.RegisterProperty(ToDaliString(oss.str()), 1.f);
-  }
+  handle.RegisterProperty(ToDaliString(OPACITY_TIME_UNIFORM_NAME), 0.f);
+  handle.RegisterProperty(ToDaliString(OPACITY_TIMING_UNIFORM_NAME), Vector4::ZERO);
+  handle.RegisterProperty(ToDaliString(OPACITY_RANGE_UNIFORM_NAME), Vector2::ONE);
+  handle.RegisterProperty(ToDaliString(OPACITY_EASING_UNIFORM_NAME), 0.f);
   handle.RegisterProperty(ToDaliString(PERCENTAGE_UNIFORM_NAME), 0.f);
   handle.RegisterProperty(ToDaliString(ACCELARATION_UNIFORM_NAME), 0.f);
   handle.RegisterProperty(ToDaliString(BREAK_UNIFORM_NAME), 0.f);
@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file text-layout-benchmark-example.cpp
+ * @brief Measures the text pipeline of TextLabel for every script of MultiLanguageStrings
+ *
+ * For each script, layout mode ( single-line, multi-line, ellipsis ) and render mode ( sync,
+ * ASYNC_AUTO ), a batch of labels is created and timed in phases:
+ *  - shape:    the first natural size query, which validates the fonts, shapes the text and lays it out on a single line
+ *  - layout:   a height for width query, which lays out the shaped glyphs at the label width
+ *  - relayout: a second height for width query at a narrower width
+ *  - render:   from adding the labels to the window until a presented frame shows all of them,
+ *              which includes the glyph rasterization and the texture upload
+ * The application quits once every case has run and logs a table of the results.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/text-controls/text-label-devel.h>
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+// INTERNAL INCLUDES
+#include <dali/integration-api/string-utils.h>
+#include "shared/multi-language-strings.h"
+using Dali::Integration::ToPropertyValue;
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace MultiLanguageStrings;
+
+namespace
+{
+enum LayoutMode
+{
+  SINGLE_LINE,
+  MULTI_LINE,
+  ELLIPSIS,
+  NUMBER_OF_LAYOUT_MODES
+};
+
+const char* LAYOUT_MODE_NAMES[NUMBER_OF_LAYOUT_MODES] = {"single-line", "multi-line", "ellipsis"};
+
+const int   DEFAULT_LABEL_COUNT(1000);
+const float POINT_SIZE(12.0f);
+const float LABEL_WIDTH_FACTOR(0.25f);    ///< Width of the multi-line and ellipsis labels, relative to the window width
+const float RELAYOUT_WIDTH_FACTOR(0.75f); ///< Width of the relayout, relative to the layout width
+const int   RENDER_TIMEOUT_MS(30000);     ///< Longest wait for the labels of a case to be visible
+
+/**
+ * Milliseconds elapsed since the given time point
+ */
+float GetMillisecondsSince(std::chrono::steady_clock::time_point startTime)
+{
+  return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void PrintHelp(const char* const opt, const char* const optDescription)
+{
+  const std::ios_base::fmtflags flags = std::cout.flags();
+  std::cout << std::left << "  --";
+  std::cout.width(24);
+  std::cout << opt;
+  std::cout << optDescription;
+  std::cout << std::endl;
+  std::cout.flags(flags);
+}
+
+} // namespace
+
+/**
+ * @brief Runs the text layout benchmark cases one after the other.
+ */
+class TextLayoutBenchmark : public ConnectionTracker
+{
+public:
+  struct Config
+  {
+    Config()
+    : mLabelCount(DEFAULT_LABEL_COUNT),
+      mScript(),
+      mLayoutModes{true, true, true},
+      mSync(true),
+      mAsync(true)
+    {
+    }
+
+    int         mLabelCount;                          ///< Labels created by each case
+    std::string mScript;                              ///< Only the scripts whose name contains this are run, all if empty
+    bool        mLayoutModes[NUMBER_OF_LAYOUT_MODES]; ///< The layout modes to run
+    bool        mSync;                                ///< Whether to run the sync render mode
+    bool        mAsync;                               ///< Whether to run the ASYNC_AUTO render mode
+  };
+
+  TextLayoutBenchmark(Application& application, const Config& config)
+  : mApplication(application),
+    mConfig(config),
+    mCurrentCase(0u),
+    mRenderFrames(0u)
+  {
+    for(unsigned int language = 0u; language < NUMBER_OF_LANGUAGES; ++language)
+    {
+      if(!mConfig.mScript.empty() && LANGUAGES[language].languageRomanName.find(mConfig.mScript) == std::string::npos)
+      {
+        continue;
+      }
+
+      for(int mode = 0; mode < NUMBER_OF_LAYOUT_MODES; ++mode)
+      {
+        if(!mConfig.mLayoutModes[mode])
+        {
+          continue;
+        }
+
+        for(int async = 0; async < 2; ++async)
+        {
+          if(async ? mConfig.mAsync : mConfig.mSync)
+          {
+            Case benchmarkCase;
+            benchmarkCase.mLanguage = language;
+            benchmarkCase.mMode     = static_cast<LayoutMode>(mode);
+            benchmarkCase.mAsync    = async != 0;
+            mCases.push_back(benchmarkCase);
+          }
+        }
+      }
+    }
+
+    // Connect to the Application's Init signal
+    mApplication.InitSignal().Connect(this, &TextLayoutBenchmark::Create);
+  }
+
+  ~TextLayoutBenchmark() = default;
+
+  void Create(Application& application)
+  {
+    Window window = application.GetWindow();
+    window.SetBackgroundColor(Color::WHITE);
+    window.KeyEventSignal().Connect(this, &TextLayoutBenchmark::OnKeyEvent);
+
+    mRenderTimer = Timer::New(RENDER_TIMEOUT_MS);
+    mRenderTimer.TickSignal().Connect(this, &TextLayoutBenchmark::OnRenderTimeout);
+
+    // Give the window a frame to settle before the first case.
+    window.AddFramePresentedCallback(MakeCallback(this, &TextLayoutBenchmark::OnCaseFinished), 0);
+  }
+
+private:
+  // Time of each phase of a case, in milliseconds
+  struct Case
+  {
+    unsigned int mLanguage{0u};
+    LayoutMode   mMode{SINGLE_LINE};
+    bool         mAsync{false};
+    float        mCreate{0.0f};
+    float        mShape{0.0f};
+    float        mLayout{0.0f};
+    float        mRelayout{0.0f};
+    float        mRender{0.0f};
+    bool         mTimedOut{false};
+  };
+
+  /**
+   * Creates the labels of the current case, measures the shaping and layout phases and adds
+   * the labels to the window.
+   */
+  void RunCase()
+  {
+    Case&       benchmarkCase = mCases[mCurrentCase];
+    Window      window        = mApplication.GetWindow();
+    const float windowWidth   = window.GetPositionSize().width;
+    const float windowHeight  = window.GetPositionSize().height;
+    const float width         = benchmarkCase.mMode == SINGLE_LINE ? windowWidth : windowWidth * LABEL_WIDTH_FACTOR;
+
+    auto startTime = std::chrono::steady_clock::now();
+    mLabels.reserve(mConfig.mLabelCount);
+    for(int i = 0; i < mConfig.mLabelCount; ++i)
+    {
+      TextLabel label = TextLabel::New(Control::ControlBehaviour::DISABLE_STYLE_CHANGE_SIGNALS);
+      label.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+      label.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+      label.SetProperty(TextLabel::Property::TEXT_COLOR, Color::BLACK);
+      label.SetProperty(TextLabel::Property::POINT_SIZE, POINT_SIZE);
+      label.SetProperty(TextLabel::Property::MULTI_LINE, benchmarkCase.mMode == MULTI_LINE);
+      label.SetProperty(TextLabel::Property::ELLIPSIS, benchmarkCase.mMode == ELLIPSIS);
+      if(benchmarkCase.mAsync)
+      {
+        label.SetProperty(DevelTextLabel::Property::RENDER_MODE, DevelTextLabel::Render::Mode::ASYNC_AUTO);
+      }
+      label.SetProperty(TextLabel::Property::TEXT, ToPropertyValue(LANGUAGES[benchmarkCase.mLanguage].text));
+      mLabels.push_back(label);
+    }
+    benchmarkCase.mCreate = GetMillisecondsSince(startTime);
+
+    startTime = std::chrono::steady_clock::now();
+    for(auto& label : mLabels)
+    {
+      label.GetNaturalSize();
+    }
+    benchmarkCase.mShape = GetMillisecondsSince(startTime);
+
+    float height = 0.0f;
+    startTime    = std::chrono::steady_clock::now();
+    for(auto& label : mLabels)
+    {
+      height = label.GetHeightForWidth(width);
+    }
+    benchmarkCase.mLayout = GetMillisecondsSince(startTime);
+
+    startTime = std::chrono::steady_clock::now();
+    for(auto& label : mLabels)
+    {
+      label.GetHeightForWidth(width * RELAYOUT_WIDTH_FACTOR);
+    }
+    benchmarkCase.mRelayout = GetMillisecondsSince(startTime);
+
+    // Stack the labels down the window, wrapping to the top, so they're all on screen.
+    mRoot = Actor::New();
+    mRoot.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+    mRoot.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+    const int rows = std::max(static_cast<int>(windowHeight / std::max(height, 1.0f)), 1);
+    for(size_t i = 0; i < mLabels.size(); ++i)
+    {
+      mLabels[i].SetProperty(Actor::Property::SIZE, Vector2(width, height));
+      mLabels[i].SetProperty(Actor::Property::POSITION, Vector2(0.0f, height * (i % rows)));
+      mRoot.Add(mLabels[i]);
+    }
+
+    mRenderFrames = 0u;
+    mRenderStart  = std::chrono::steady_clock::now();
+    window.Add(mRoot);
+    window.AddFramePresentedCallback(MakeCallback(this, &TextLayoutBenchmark::OnFramePresented), static_cast<int>(mCurrentCase));
+    mRenderTimer.Start();
+  }
+
+  /**
+   * Finishes the render phase once every label of the current case is ready.
+   *
+   * @param[in] frameId The index of the case that requested the callback
+   */
+  void OnFramePresented(int frameId)
+  {
+    if(static_cast<size_t>(frameId) != mCurrentCase)
+    {
+      return; // The case has timed out
+    }
+
+    ++mRenderFrames;
+    for(auto& label : mLabels)
+    {
+      if(!label.IsResourceReady())
+      {
+        mApplication.GetWindow().AddFramePresentedCallback(MakeCallback(this, &TextLayoutBenchmark::OnFramePresented), frameId);
+        return;
+      }
+    }
+
+    mCases[mCurrentCase].mRender = GetMillisecondsSince(mRenderStart);
+    FinishCase();
+  }
+
+  bool OnRenderTimeout()
+  {
+    mCases[mCurrentCase].mRender   = GetMillisecondsSince(mRenderStart);
+    mCases[mCurrentCase].mTimedOut = true;
+    FinishCase();
+    return false;
+  }
+
+  /**
+   * Logs the result of the current case, releases its labels and lets a frame go before the next case.
+   */
+  void FinishCase()
+  {
+    mRenderTimer.Stop();
+
+    const Case& benchmarkCase = mCases[mCurrentCase];
+    DALI_LOG_RELEASE_INFO("Text layout benchmark ( %s, %s, %s ): %d labels, create %.2f ms, shape %.2f ms, layout %.2f ms, relayout %.2f ms, render %.2f ms in %u frames%s\n",
+                          LANGUAGES[benchmarkCase.mLanguage].languageRomanName.c_str(),
+                          LAYOUT_MODE_NAMES[benchmarkCase.mMode],
+                          benchmarkCase.mAsync ? "async" : "sync",
+                          mConfig.mLabelCount,
+                          benchmarkCase.mCreate,
+                          benchmarkCase.mShape,
+                          benchmarkCase.mLayout,
+                          benchmarkCase.mRelayout,
+                          benchmarkCase.mRender,
+                          mRenderFrames,
+                          benchmarkCase.mTimedOut ? ", timed out" : "");
+
+    UnparentAndReset(mRoot);
+    mLabels.clear();
+    ++mCurrentCase;
+
+    mApplication.GetWindow().AddFramePresentedCallback(MakeCallback(this, &TextLayoutBenchmark::OnCaseFinished), 0);
+  }
+
+  void OnCaseFinished(int frameId)
+  {
+    if(mCurrentCase < mCases.size())
+    {
+      RunCase();
+    }
+    else
+    {
+      PrintReport();
+      mApplication.Quit();
+    }
+  }
+
+  /**
+   * Logs a table of every case, the times are per label in microseconds.
+   */
+  void PrintReport()
+  {
+    const float toMicroseconds = 1000.0f / std::max(mConfig.mLabelCount, 1);
+
+    DALI_LOG_RELEASE_INFO("Text layout benchmark, %d labels per case, microseconds per label\n", mConfig.mLabelCount);
+    DALI_LOG_RELEASE_INFO("%-14s %-11s %-6s %9s %9s %9s %9s %9s\n", "script", "mode", "render", "create", "shape", "layout", "relayout", "render");
+    for(const auto& benchmarkCase : mCases)
+    {
+      DALI_LOG_RELEASE_INFO("%-14s %-11s %-6s %9.1f %9.1f %9.1f %9.1f %9.1f%s\n",
+                            LANGUAGES[benchmarkCase.mLanguage].languageRomanName.c_str(),
+                            LAYOUT_MODE_NAMES[benchmarkCase.mMode],
+                            benchmarkCase.mAsync ? "async" : "sync",
+                            benchmarkCase.mCreate * toMicroseconds,
+                            benchmarkCase.mShape * toMicroseconds,
+                            benchmarkCase.mLayout * toMicroseconds,
+                            benchmarkCase.mRelayout * toMicroseconds,
+                            benchmarkCase.mRender * toMicroseconds,
+                            benchmarkCase.mTimedOut ? " (timed out)" : "");
+    }
+  }
+
+  void OnKeyEvent(Window window, KeyEvent event)
+  {
+    if(event.GetState() == KeyEvent::DOWN)
+    {
+      if(IsKey(event, Dali::DALI_KEY_ESCAPE) || IsKey(event, Dali::DALI_KEY_BACK))
+      {
+        mApplication.Quit();
+      }
+    }
+  }
+
+private:
+  Application&                          mApplication;
+  Config                                mConfig;
+  std::vector<Case>                     mCases;        ///< Every case to run, in order
+  size_t                                mCurrentCase;  ///< Index of the case being run
+  std::vector<TextLabel>                mLabels;       ///< Labels of the current case
+  Actor                                 mRoot;         ///< Parent of the labels of the current case
+  Timer                                 mRenderTimer;  ///< Ends the render phase if the labels never become ready
+  std::chrono::steady_clock::time_point mRenderStart;  ///< Time the labels were added to the window
+  uint32_t                              mRenderFrames; ///< Frames presented during the render phase
+};
+
+int DALI_EXPORT_API main(int argc, char** argv)
+{
+  TextLayoutBenchmark::Config config;
+
+  bool printHelpAndExit = false;
+
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strncmp(argv[i], "--labels=", 9) == 0)
+    {
+      config.mLabelCount = std::max(atoi(argv[i] + 9), 1);
+    }
+    else if(strncmp(argv[i], "--script=", 9) == 0)
+    {
+      config.mScript = argv[i] + 9;
+    }
+    else if(strncmp(argv[i], "--mode=", 7) == 0)
+    {
+      bool known = false;
+      for(int mode = 0; mode < NUMBER_OF_LAYOUT_MODES; ++mode)
+      {
+        config.mLayoutModes[mode] = strcmp(argv[i] + 7, LAYOUT_MODE_NAMES[mode]) == 0;
+        known                     = known || config.mLayoutModes[mode];
+      }
+      if(!known)
+      {
+        // Otherwise every layout mode would be disabled and the benchmark would quit without running a case
+        std::cerr << "Unknown layout mode \"" << argv[i] + 7 << "\", expected single-line, multi-line or ellipsis" << std::endl;
+        return 1;
+      }
+    }
+    else if(strcmp(argv[i], "--sync") == 0)
+    {
+      config.mAsync = false;
+    }
+    else if(strcmp(argv[i], "--async") == 0)
+    {
+      config.mSync = false;
+    }
+    else if(strcmp(argv[i], "--help") == 0)
+    {
+      printHelpAndExit = true;
+    }
+  }
+
+  if(printHelpAndExit)
+  {
+    PrintHelp("labels=<num>", " Number of labels created by each case");
+    PrintHelp("script=<name>", " Runs only the scripts whose name contains <name>, e.g. Arabic");
+    PrintHelp("mode=<mode>", " Runs only the single-line, multi-line or ellipsis layout");
+    PrintHelp("sync", " Runs only the sync render mode");
+    PrintHelp("async", " Runs only the ASYNC_AUTO render mode");
+    return 0;
+  }
+
+  Application         application = Application::New(&argc, &argv);
+  TextLayoutBenchmark test(application, config);
+  application.MainLoop();
+  return 0;
+}
@@ -18,16 +18,25 @@
 /**
  * @file text-memory-profiling-example.cpp
  * @brief Memory consumption profiling for TextLabel
+ *
+ * The RSS and PSS of the process and the texture bytes of the labels are sampled before and
+ * after each batch of labels is shown, and a table of the memory cost per label is logged.
+ * With --batch, every type of text is profiled in turn and the application quits afterwards.
  */
 
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include <dali/integration-api/debug.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
 
 // INTERNAL INCLUDES
 #include <controls/navigation-view/navigation-view.h>
 #include <dali/integration-api/string-utils.h>
+#include <shared/process-memory.h>
 #include <shared/view.h>
 using Dali::Integration::GetStdString;
 using Dali::Integration::ToDaliString;
@@ -75,6 +84,56 @@ const char* BACK_IMAGE(DEMO_IMAGE_DIR "icon-change.png");
 const char* BACK_IMAGE_SELECTED(DEMO_IMAGE_DIR "icon-change-selected.png");
 const char* INDICATOR_IMAGE(DEMO_IMAGE_DIR "loading.png");
 
+/**
+ * @brief Memory of the process, in kilobytes
+ */
+struct MemorySample
+{
+  long rssKb; ///< Resident set size
+  long pssKb; ///< Proportional set size, the resident set size if it's not available
+};
+
+/**
+ * @brief Samples the memory of the process from /proc/self/smaps_rollup, or /proc/self/status
+ * if the kernel doesn't provide it
+ */
+MemorySample SampleMemory()
+{
+  MemorySample sample{static_cast<long>(DemoHelper::GetProcessMemoryKb("Rss:", "/proc/self/smaps_rollup")),
+                      static_cast<long>(DemoHelper::GetProcessMemoryKb("Pss:", "/proc/self/smaps_rollup"))};
+  if(sample.rssKb == 0)
+  {
+    sample.rssKb = static_cast<long>(DemoHelper::GetProcessMemoryKb("VmRSS:"));
+    sample.pssKb = sample.rssKb;
+  }
+  return sample;
+}
+
+/**
+ * @brief Sums the size of the textures used by the renderers of the children of an actor
+ */
+uint64_t GetTextureBytes(Actor parent)
+{
+  uint64_t bytes = 0u;
+  for(unsigned int i = 0; i < parent.GetChildCount(); ++i)
+  {
+    Actor child = parent.GetChildAt(i);
+    for(unsigned int j = 0; j < child.GetRendererCount(); ++j)
+    {
+      TextureSet textures = child.GetRendererAt(j).GetTextures();
+      for(size_t k = 0; textures && k < textures.GetTextureCount(); ++k)
+      {
+        Texture texture = textures.GetTexture(k);
+        if(texture)
+        {
+          bytes += uint64_t(texture.GetWidth()) * texture.GetHeight() * Pixel::GetBytesPerPixel(texture.GetPixelFormat());
+        }
+      }
+    }
+  }
+  return bytes;
+}
+
 } // anonymous namespace
 
 /**
@@ -83,9 +142,10 @@ const char* INDICATOR_IMAGE(DEMO_IMAGE_DIR "loading.png");
 class TextMemoryProfilingExample : public ConnectionTracker, public Toolkit::ItemFactory
 {
 public:
-  TextMemoryProfilingExample(Application& application)
+  TextMemoryProfilingExample(Application& application, bool batch)
   : mApplication(application),
-    mCurrentTextStyle(SINGLE_COLOR_TEXT)
+    mCurrentTextStyle(SINGLE_COLOR_TEXT),
+    mBatch(batch)
   {
     // Connect to the Application's Init signal
     mApplication.InitSignal().Connect(this, &TextMemoryProfilingExample::Create);
@@ -250,12 +310,9 @@ public:
   void CreateTextLabels(int type)
   {
     // Delete any existing text labels
-    unsigned int numChildren = mLayer.GetChildCount();
+    RemoveTextLabels();
 
-    for(unsigned int i = 0; i < numChildren; ++i)
-    {
-      mLayer.Remove(mLayer.GetChildAt(0));
-    }
+    mMemoryBefore = SampleMemory();
 
     mLayer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
     mLayer.SetProperty(Actor::Property::PIVOT, Pivot::BOTTOM_CENTER);
@@ -272,7 +329,86 @@ public:
       mLayer.Add(label);
     }
 
-    mTitle.SetProperty(TextLabel::Property::TEXT, "Run memps on target");
+    mTitle.SetProperty(TextLabel::Property::TEXT, "Measuring...");
+
+    // The textures of the labels are created when they're rendered
+    mApplication.GetWindow().AddFramePresentedCallback(MakeCallback(this, &TextMemoryProfilingExample::OnTextLabelsPresented), type);
+  }
+
+  /**
+   * @brief Removes the text labels of the last batch
+   */
+  void RemoveTextLabels()
+  {
+    unsigned int numChildren = mLayer.GetChildCount();
+
+    for(unsigned int i = 0; i < numChildren; ++i)
+    {
+      mLayer.Remove(mLayer.GetChildAt(0));
+    }
+  }
+
+  /**
+   * @brief Records the memory cost of the batch of labels once it has been rendered
+   */
+  void OnTextLabelsPresented(int type)
+  {
+    MemorySample after = SampleMemory();
+
+    Measurement& measurement = mMeasurements[type];
+    measurement.rssKb        = after.rssKb - mMemoryBefore.rssKb;
+    measurement.pssKb        = after.pssKb - mMemoryBefore.pssKb;
+    measurement.textureBytes = GetTextureBytes(mLayer);
+    measurement.valid        = true;
+
+    char title[64];
+    snprintf(title, sizeof(title), "%.1f kB RSS per label", measurement.rssKb / float(NUMBER_OF_LABELS));
+    mTitle.SetProperty(TextLabel::Property::TEXT, title);
+
+    PrintReport();
+
+    if(mBatch)
+    {
+      mNavigationView.Pop();
+      RemoveTextLabels();
+      mApplication.GetWindow().AddFramePresentedCallback(MakeCallback(this, &TextMemoryProfilingExample::OnBatchStep), type + 1);
+    }
+  }
+
+  /**
+   * @brief Profiles the next type of text in batch mode, once the labels of the previous type are gone
+   */
+  void OnBatchStep(int type)
+  {
+    if(type < NUMBER_OF_TYPES)
+    {
+      CreateTextLabels(type);
+    }
+    else
+    {
+      mApplication.Quit();
+    }
+  }
+
+  /**
+   * @brief Logs the memory cost per label of every type measured so far
+   */
+  void PrintReport()
+  {
+    DALI_LOG_RELEASE_INFO("Text memory profiling, %d labels per type, bytes per label\n", NUMBER_OF_LABELS);
+    DALI_LOG_RELEASE_INFO("%-40s %10s %10s %10s\n", "type", "RSS", "PSS", "textures");
+    for(int type = 0; type < NUMBER_OF_TYPES; ++type)
+    {
+      const Measurement& measurement = mMeasurements[type];
+      if(measurement.valid)
+      {
+        DALI_LOG_RELEASE_INFO("%-40s %10ld %10ld %10llu\n",
+                              TEXT_TYPE_STRING[type].c_str(),
+                              measurement.rssKb * 1024 / NUMBER_OF_LABELS,
+                              measurement.pssKb * 1024 / NUMBER_OF_LABELS,
+                              static_cast<unsigned long long>(measurement.textureBytes / NUMBER_OF_LABELS));
+      }
+    }
   }
 
   /**
@@ -327,6 +463,11 @@ public:
 
     PropertyNotification notification = mIndicator.AddPropertyNotification(Actor::Property::VISIBLE, GreaterThanCondition(0.01f));
     notification.NotifySignal().Connect(this, &TextMemoryProfilingExample::OnIndicatorVisible);
+
+    if(mBatch)
+    {
+      window.AddFramePresentedCallback(MakeCallback(this, &TextMemoryProfilingExample::OnBatchStep), 0);
+    }
   }
 
   /**
@@ -406,6 +547,15 @@ public:
   }
 
 private:
+  // Memory cost of a batch of labels
+  struct Measurement
+  {
+    long     rssKb{0};         ///< RSS increase, in kilobytes
+    long     pssKb{0};         ///< PSS increase, in kilobytes
+    uint64_t textureBytes{0u}; ///< Size of the textures of the labels
+    bool     valid{false};     ///< Whether the type has been measured
+  };
+
   Application& mApplication;
 
   ItemLayoutPtr  mLayout;
@@ -423,12 +573,24 @@ private:
   TapGestureDetector mTapDetector;
 
   unsigned int mCurrentTextStyle;
+  bool         mBatch;                         ///< Whether every type is profiled automatically
+  MemorySample mMemoryBefore{0, 0};            ///< Memory before the current batch of labels
+  Measurement  mMeasurements[NUMBER_OF_TYPES]; ///< Memory cost of each type
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  bool batch = false;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i], "--batch") == 0)
+    {
+      batch = true;
+    }
+  }
+
   Application                application = Application::New(&argc, &argv, DEMO_THEME_PATH);
-  TextMemoryProfilingExample test(application);
+  TextMemoryProfilingExample test(application, batch);
   application.MainLoop();
   return 0;
 }
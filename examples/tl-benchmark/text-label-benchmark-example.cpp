@@ -21,13 +21,22 @@
 #include <dali-toolkit/devel-api/styling/style-manager-devel.h>
 #include <dali-toolkit/devel-api/text/text-enumerations-devel.h>
 #include <dali/integration-api/debug.h>
+#include <dali/public-api/update/frame-callback-interface.h>
 
 #include <dali/devel-api/adaptor-framework/performance-logger.h>
 
 #include <dali/integration-api/string-utils.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <list>
+#include <string>
 #include <thread>
+#include <unordered_map>
 using Dali::Integration::GetStdString;
 using Dali::Integration::ToDaliString;
 using Dali::Integration::ToDaliStringView;
@@ -42,9 +51,104 @@ namespace
 uint32_t gRows(20);
 uint32_t gColumns(20);
 uint32_t gDurationMilliSeconds(100);
+uint32_t gReportTicks(100);
 
 bool gAsyncText{false};
 bool gMultiline{false};
+bool gCompareModes{false};
+
+const uint32_t FRAME_TIME_BUCKETS(1000u);        ///< Number of buckets of the frame time histogram
+const float    FRAME_TIME_BUCKET_MS(0.1f);       ///< Width of a bucket, longer frames go in the last bucket
+const char*    MODE_NAMES[] = {"sync", "async"}; ///< Names of the render modes, indexed by gAsyncText
+
+/**
+ * Summary of a set of samples, in milliseconds
+ */
+struct Distribution
+{
+  size_t count{0u};
+  float  mean{0.0f};
+  float  deviation{0.0f};
+  float  p50{0.0f};
+  float  p90{0.0f};
+  float  p99{0.0f};
+  float  max{0.0f};
+};
+
+Distribution MakeDistribution(std::vector<float> samples)
+{
+  Distribution distribution;
+  if(samples.empty())
+  {
+    return distribution;
+  }
+
+  std::sort(samples.begin(), samples.end());
+  double sum        = 0.0;
+  double sumSquares = 0.0;
+  for(float sample : samples)
+  {
+    sum += sample;
+    sumSquares += double(sample) * sample;
+  }
+
+  const size_t count      = samples.size();
+  auto         percentile = [&samples, count](float p) { return samples[std::min(count - 1, static_cast<size_t>(p * count))]; };
+
+  distribution.count     = count;
+  distribution.mean      = sum / count;
+  distribution.deviation = std::sqrt(std::max(sumSquares / count - double(distribution.mean) * distribution.mean, 0.0));
+  distribution.p50       = percentile(0.5f);
+  distribution.p90       = percentile(0.9f);
+  distribution.p99       = percentile(0.99f);
+  distribution.max       = samples.back();
+  return distribution;
+}
+
+/**
+ * Records a histogram of the frame times on the update thread
+ */
+class FrameTimeHistogram : public FrameCallbackInterface
+{
+public:
+  FrameTimeHistogram()
+  {
+    Reset();
+  }
+
+  void Reset()
+  {
+    for(auto& bucket : mBuckets)
+    {
+      bucket = 0u;
+    }
+  }
+
+  /**
+   * Expands the histogram into samples, at the centre of their buckets
+   */
+  std::vector<float> GetSamples() const
+  {
+    std::vector<float> samples;
+    for(uint32_t i = 0; i < FRAME_TIME_BUCKETS; ++i)
+    {
+      samples.insert(samples.end(), mBuckets[i], (i + 0.5f) * FRAME_TIME_BUCKET_MS);
+    }
+    return samples;
+  }
+
+private:
+  bool Update(UpdateProxy& /* updateProxy */, float elapsedSeconds) override
+  {
+    const uint32_t bucket = static_cast<uint32_t>(elapsedSeconds * 1000.0f / FRAME_TIME_BUCKET_MS);
+    ++mBuckets[std::min(bucket, FRAME_TIME_BUCKETS - 1)];
+    return false;
+  }
+
+private:
+  std::array<std::atomic<uint32_t>, FRAME_TIME_BUCKETS> mBuckets; ///< Number of frames per bucket
+};
+
 } // namespace
 
 // This example shows the blur radius property of the color visual and animates it.
@@ -76,6 +180,24 @@ public:
   PerformanceLogger customNew1Logger;
   PerformanceLogger customColorLogger;
 
+  // Samples of a render mode, in milliseconds
+  struct ModeStats
+  {
+    std::vector<float> visibleTimes;  ///< From the creation of a label until it is resource ready
+    std::vector<float> blockingTimes; ///< From the start of a tick until the event loop is idle again
+    std::vector<float> frameTimes;    ///< Frame times while the labels stream in
+    uint32_t           dropped{0u};   ///< Labels removed before they became ready
+    bool               measured{false};
+  };
+
+  using Clock = std::chrono::steady_clock;
+
+  std::unordered_map<uint32_t, Clock::time_point> mPendingLabels; ///< Creation time of the labels which aren't ready yet, by actor id
+  ModeStats                                       mStats[2];      ///< Samples of the sync and async modes
+  FrameTimeHistogram                              mFrameTimes;
+  Clock::time_point                               mTickStart;
+  uint32_t                                        mTickCount{0u};
+
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application application)
   {
@@ -99,12 +221,16 @@ public:
     customNew1Logger.EnableLogging(true);
     customColorLogger.EnableLogging(true);
 
+    UiContext::Get().AddFrameCallback(mFrameTimes, mWindow.GetRootLayer());
+
     // Respond to key events
     mWindow.KeyEventSignal().Connect(this, &TextLabelBenchmarkExample::OnKeyEvent);
   }
 
   bool OnTick()
   {
+    mTickStart = Clock::now();
+
     auto  positionSize = mWindow.GetPositionSize();
     float width        = (float)positionSize.width / m;
     float height       = (float)positionSize.height / n;
@@ -133,6 +259,9 @@ public:
           bgView[TextLabel::Property::TEXT]       = "Hello, world!";
           bgView[TextLabel::Property::POINT_SIZE] = 12;
 
+          mPendingLabels[bgView.GetProperty<int>(Actor::Property::ID)] = Clock::now();
+          bgView.ResourceReadySignal().Connect(this, &TextLabelBenchmarkExample::OnLabelReady);
+
           if(gAsyncText)
           {
             bgView[DevelTextLabel::Property::RENDER_MODE] = DevelTextLabel::Render::Mode::ASYNC_AUTO;
@@ -165,14 +294,137 @@ public:
 
       while((int)list.size() > n + 1)
       {
-        list.front().Unparent();
+        RemoveRow(list.front());
         list.pop_front();
       }
     }
 
+    // The labels are laid out and, in sync mode, rendered when the event loop processes the tick
+    mApplication.AddIdle(MakeCallback(this, &TextLabelBenchmarkExample::OnTickProcessed));
+
     return true;
   }
 
+  void OnLabelReady(Control control)
+  {
+    auto iter = mPendingLabels.find(control.GetProperty<int>(Actor::Property::ID));
+    if(iter != mPendingLabels.end())
+    {
+      mStats[gAsyncText].visibleTimes.push_back(std::chrono::duration<float, std::milli>(Clock::now() - iter->second).count());
+      mPendingLabels.erase(iter);
+    }
+  }
+
+  void OnTickProcessed()
+  {
+    ModeStats& stats = mStats[gAsyncText];
+    stats.blockingTimes.push_back(std::chrono::duration<float, std::milli>(Clock::now() - mTickStart).count());
+    stats.measured = true;
+
+    if(++mTickCount < gReportTicks)
+    {
+      return;
+    }
+
+    stats.frameTimes = mFrameTimes.GetSamples();
+    mTickCount       = 0u;
+    mFrameTimes.Reset();
+
+    if(!gCompareModes)
+    {
+      PrintReport();
+      stats = ModeStats();
+    }
+    else if(!gAsyncText)
+    {
+      // Start again from an empty window in the async mode, the labels cut off by the switch aren't counted as dropped
+      mPendingLabels.clear();
+      for(auto& row : list)
+      {
+        RemoveRow(row);
+      }
+      list.clear();
+      gAsyncText = true;
+    }
+    else
+    {
+      PrintReport();
+      timer.Stop();
+      mApplication.Quit();
+    }
+  }
+
+  /**
+   * Removes a row of labels, the labels which aren't ready yet are counted as dropped
+   */
+  void RemoveRow(Control row)
+  {
+    for(uint32_t i = 0; i < row.GetChildCount(); ++i)
+    {
+      if(mPendingLabels.erase(row.GetChildAt(i).GetProperty<int>(Actor::Property::ID)))
+      {
+        ++mStats[gAsyncText].dropped;
+      }
+    }
+    row.Unparent();
+  }
+
+  /**
+   * Logs the distributions of the measured render modes side by side
+   */
+  void PrintReport()
+  {
+    Distribution distributions[2][3];
+    std::string  header;
+    for(int mode = 0; mode < 2; ++mode)
+    {
+      if(mStats[mode].measured)
+      {
+        distributions[mode][0] = MakeDistribution(mStats[mode].visibleTimes);
+        distributions[mode][1] = MakeDistribution(mStats[mode].blockingTimes);
+        distributions[mode][2] = MakeDistribution(mStats[mode].frameTimes);
+        header += std::string(" ") + std::string(10 - strlen(MODE_NAMES[mode]), ' ') + MODE_NAMES[mode];
+      }
+    }
+
+    const char* metricNames[3] = {"visible ms", "tick blocking ms", "frame ms"};
+    const char* statNames[]    = {"count", "mean", "deviation", "p50", "p90", "p99", "max"};
+
+    DALI_LOG_RELEASE_INFO("TL benchmark ( %d rows, %d columns, %d ms per tick%s ), %u ticks per mode\n", n, m, duration, gMultiline ? ", multi-line" : "", gReportTicks);
+    DALI_LOG_RELEASE_INFO("%-28s%s\n", "", header.c_str());
+    for(int metric = 0; metric < 3; ++metric)
+    {
+      for(int stat = 0; stat < 7; ++stat)
+      {
+        std::string line;
+        for(int mode = 0; mode < 2; ++mode)
+        {
+          if(mStats[mode].measured)
+          {
+            const Distribution& distribution = distributions[mode][metric];
+            const float         values[]     = {float(distribution.count), distribution.mean, distribution.deviation, distribution.p50, distribution.p90, distribution.p99, distribution.max};
+            char                value[16];
+            snprintf(value, sizeof(value), stat == 0 ? " %10.0f" : " %10.2f", values[stat]);
+            line += value;
+          }
+        }
+        DALI_LOG_RELEASE_INFO("%-16s %-11s%s\n", stat == 0 ? metricNames[metric] : "", statNames[stat], line.c_str());
+      }
+    }
+
+    std::string dropped;
+    for(int mode = 0; mode < 2; ++mode)
+    {
+      if(mStats[mode].measured)
+      {
+        char value[16];
+        snprintf(value, sizeof(value), " %10u", mStats[mode].dropped);
+        dropped += value;
+      }
+    }
+    DALI_LOG_RELEASE_INFO("%-28s%s\n", "labels never visible", dropped.c_str());
+  }
+
   void OnKeyEvent(Window window, KeyEvent event)
   {
     if(event.GetState() == KeyEvent::DOWN)
@@ -209,6 +461,10 @@ int DALI_EXPORT_API main(int argc, char** argv)
     {
       gDurationMilliSeconds = atoi(arg.substr(2, arg.size()).c_str());
     }
+    else if(arg.compare(0, 2, "-n") == 0)
+    {
+      gReportTicks = std::max(atoi(arg.substr(2, arg.size()).c_str()), 1);
+    }
     else if(arg.compare(0, 2, "-p") == 0)
     {
       std::string subarg = arg.substr(2, arg.size());
@@ -222,10 +478,20 @@ int DALI_EXPORT_API main(int argc, char** argv)
         {
           gMultiline = true;
         }
+        if(c == 'C' || c == 'c')
+        {
+          gCompareModes = true;
+        }
       }
     }
   }
 
+  if(gCompareModes)
+  {
+    // The sync mode is measured first
+    gAsyncText = false;
+  }
+
   TextLabelBenchmarkExample test(application);
   application.MainLoop();
   return 0;
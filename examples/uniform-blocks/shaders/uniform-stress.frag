@@ -0,0 +1,40 @@
+//@version 100
+
+// RING_ALLOCATOR is defined by the application when the renderer data is read from the
+// block uploaded by the ring allocator, instead of being set as uniforms of every actor.
+#ifdef RING_ALLOCATOR
+UNIFORM sampler2D sUniformData;
+#endif
+
+UNIFORM_BLOCK FragmentBlock
+{
+#ifdef RING_ALLOCATOR
+  UNIFORM highp float uDataOffset;
+  UNIFORM highp vec2  uDataTextureSize;
+#else
+  UNIFORM mediump vec4 uStressColor;
+  UNIFORM mediump vec4 uStressParams;
+#endif
+};
+
+#ifdef RING_ALLOCATOR
+// Reads the vec4 stored at the given texel of the block
+mediump vec4 FetchData(highp float texel)
+{
+  highp float row = floor(texel / uDataTextureSize.x);
+  highp vec2  uv  = (vec2(texel - row * uDataTextureSize.x, row) + 0.5) / uDataTextureSize;
+  return TEXTURE(sUniformData, uv);
+}
+#endif
+
+void main()
+{
+#ifdef RING_ALLOCATOR
+  mediump vec4 color  = FetchData(uDataOffset);
+  mediump vec4 params = FetchData(uDataOffset + 1.0);
+#else
+  mediump vec4 color  = uStressColor;
+  mediump vec4 params = uStressParams;
+#endif
+  gl_FragColor = vec4(mix(color.rgb, vec3(1.0), params.x), 1.0);
+}
@@ -18,10 +18,21 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/public-api/rendering/uniform-block.h>
 
+#include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
 #include "generated/uniform-block-alt-frag.h"
 #include "generated/uniform-block-frag.h"
 #include "generated/uniform-block-vert.h"
+#include "generated/uniform-stress-frag.h"
+#include "uniform-ring-allocator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
 using Dali::Integration::GetStdString;
 using Dali::Integration::ToDaliString;
 using Dali::Integration::ToDaliStringView;
@@ -31,14 +42,43 @@ using Dali::Integration::ToStdString;
 using namespace Dali;
 using Dali::Toolkit::TextLabel;
 
+namespace
+{
+const uint32_t STRESS_RENDERER_COUNT(10000u);
+const uint32_t STRESS_RENDERER_COUNT_MAX(100000u);
+const uint32_t STRESS_FRAME_INTERVAL_MS(16u);
+const uint32_t STRESS_STATISTICS_FRAMES(120u); ///< Frames between the event time logs
+const uint32_t RING_FRAME_COUNT(3u);           ///< Textures in the ring, so a texture isn't overwritten while still in use
+
+/**
+ * Per renderer data of the stress test, written as uniforms or packed by the ring allocator
+ */
+struct StressData
+{
+  Vector4 color;
+  Vector4 params; ///< x: Amount of white mixed into the color
+};
+
+/**
+ * How the stress test passes the per renderer data to the shader
+ */
+enum StressMode
+{
+  STRESS_PER_PROPERTY = 0, ///< Every renderer has its own uniform properties, all written every frame
+  STRESS_RING_ALLOCATOR,   ///< The data of all renderers is packed into one block and uploaded once per frame
+  STRESS_MODE_COUNT
+};
+} // namespace
+
 /**
  * This application tests that shaders with uniform blocks work as expected.
  */
 class UniformBlocksController : public ConnectionTracker
 {
 public:
-  UniformBlocksController(Application& application)
-  : mApplication(application)
+  UniformBlocksController(Application& application, uint32_t stressRendererCount)
+  : mApplication(application),
+    mStressRendererCount(stressRendererCount)
   {
     // Connect to the Application's Init signal
     mApplication.InitSignal().Connect(this, &UniformBlocksController::Create);
@@ -53,6 +93,12 @@ public:
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
 
+    if(mStressRendererCount > 0u)
+    {
+      CreateStressTest(window);
+      return;
+    }
+
     mUniformBlocks = UniformBlock::New("SharedFragmentBlock");
 
     CreateShader(0);
@@ -87,8 +133,164 @@ public:
     return true;
   }
 
+  /**
+   * Creates a grid of actors, each with per frame uniform data, sharing a single renderer
+   */
+  void CreateStressTest(Window window)
+  {
+    CreateGeometry();
+
+    const uint32_t blockSize = mStressRendererCount * sizeof(StressData);
+    mRingAllocator.reset(new UniformRingAllocator(blockSize, RING_FRAME_COUNT, sizeof(Vector4)));
+
+    const Window::WindowSize size = window.GetSize();
+    const Vector2            windowSize(size.GetWidth(), size.GetHeight());
+    const uint32_t           columns = static_cast<uint32_t>(std::ceil(std::sqrt(mStressRendererCount * windowSize.width / windowSize.height)));
+    const uint32_t           rows    = (mStressRendererCount + columns - 1u) / columns;
+    const Vector2            cellSize(windowSize.width / columns, windowSize.height / rows);
+
+    mStressActors.reserve(mStressRendererCount);
+    for(uint32_t i = 0; i < mStressRendererCount; ++i)
+    {
+      Actor actor = Actor::New();
+      actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+      actor.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+      actor.SetProperty(Actor::Property::POSITION, Vector2((i % columns) * cellSize.width, (i / columns) * cellSize.height));
+      actor.SetProperty(Actor::Property::SIZE, cellSize);
+      window.Add(actor);
+      mStressActors.push_back(actor);
+    }
+
+    mLabel = TextLabel::New();
+    mLabel.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
+    mLabel.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::BOTTOM_CENTER);
+    mLabel.SetBackgroundColor(Vector4(1.0f, 1.0f, 1.0f, 0.5f));
+    window.Add(mLabel);
+
+    SetStressMode(STRESS_PER_PROPERTY);
+
+    window.TouchEventSignal().Connect(this, &UniformBlocksController::OnTouch);
+    window.KeyEventSignal().Connect(this, &UniformBlocksController::OnKeyEvent);
+
+    mTimer = Timer::New(STRESS_FRAME_INTERVAL_MS);
+    mTimer.TickSignal().Connect(this, &UniformBlocksController::OnStressTick);
+    mTimer.Start();
+  }
+
+  void SetStressMode(int mode)
+  {
+    mStressMode = mode;
+
+    std::string fragmentShader(SHADER_UNIFORM_STRESS_FRAG);
+    if(mStressMode == STRESS_RING_ALLOCATOR)
+    {
+      fragmentShader = "#define RING_ALLOCATOR\n" + fragmentShader;
+    }
+    mShader   = Shader::New(ToDaliStringView(SHADER_UNIFORM_BLOCK_VERT), ToDaliStringView(fragmentShader));
+    mRenderer = Renderer::New(mGeometry, mShader);
+
+    if(mStressMode == STRESS_RING_ALLOCATOR)
+    {
+      mRenderer.SetTextures(mRingAllocator->GetTextureSet());
+      mRenderer.RegisterProperty("uDataTextureSize", mRingAllocator->GetTextureSize());
+    }
+
+    // Register the properties of the mode, the values are written by the first frame
+    mStressPropertyIndices.assign(mStressActors.size() * 2u, Property::INVALID_INDEX);
+    mStressDataOffsets.assign(mStressActors.size(), UniformRingAllocator::INVALID_OFFSET);
+    for(uint32_t i = 0; i < mStressActors.size(); ++i)
+    {
+      Actor& actor = mStressActors[i];
+      if(actor.GetRendererCount() > 0u)
+      {
+        actor.RemoveRenderer(0u);
+      }
+      actor.AddRenderer(mRenderer);
+
+      if(mStressMode == STRESS_RING_ALLOCATOR)
+      {
+        mStressPropertyIndices[i * 2u] = actor.RegisterProperty("uDataOffset", 0.0f);
+      }
+      else
+      {
+        mStressPropertyIndices[i * 2u]      = actor.RegisterProperty("uStressColor", Color::WHITE);
+        mStressPropertyIndices[i * 2u + 1u] = actor.RegisterProperty("uStressParams", Vector4::ZERO);
+      }
+    }
+
+    mStressFrames    = 0u;
+    mStressEventTime = 0.0;
+    mLabel.SetProperty(TextLabel::Property::TEXT, std::to_string(mStressActors.size()) + (mStressMode == STRESS_RING_ALLOCATOR ? " renderers, ring allocator" : " renderers, per property uniforms"));
+  }
+
+  bool OnStressTick()
+  {
+    const auto  start = std::chrono::steady_clock::now();
+    const float time  = static_cast<float>(mStressFrame++) * 0.02f;
+
+    if(mStressMode == STRESS_RING_ALLOCATOR)
+    {
+      mRingAllocator->BeginFrame();
+    }
+
+    for(uint32_t i = 0; i < mStressActors.size(); ++i)
+    {
+      StressData data;
+      data.color  = Vector4(0.5f + 0.5f * sinf(time + i * 0.01f), 0.5f + 0.5f * sinf(time * 1.3f + i * 0.02f), 0.5f + 0.5f * sinf(time * 1.7f + i * 0.03f), 1.0f);
+      data.params = Vector4(0.25f + 0.25f * sinf(time * 2.0f + i * 0.05f), 0.0f, 0.0f, 0.0f);
+
+      if(mStressMode == STRESS_RING_ALLOCATOR)
+      {
+        // Allocations happen in the same order every frame, so the offsets are written only once
+        const uint32_t offset = mRingAllocator->Allocate(sizeof(StressData));
+        if(offset == UniformRingAllocator::INVALID_OFFSET)
+        {
+          break;
+        }
+        memcpy(mRingAllocator->GetData(offset), &data, sizeof(StressData));
+        if(offset != mStressDataOffsets[i])
+        {
+          mStressDataOffsets[i] = offset;
+          mStressActors[i].SetProperty(mStressPropertyIndices[i * 2u], static_cast<float>(offset / sizeof(Vector4)));
+        }
+      }
+      else
+      {
+        mStressActors[i].SetProperty(mStressPropertyIndices[i * 2u], data.color);
+        mStressActors[i].SetProperty(mStressPropertyIndices[i * 2u + 1u], data.params);
+      }
+    }
+
+    if(mStressMode == STRESS_RING_ALLOCATOR)
+    {
+      mRingAllocator->EndFrame();
+    }
+
+    // Update and render times are logged by DALI_LOG_PERFORMANCE_STATS
+    mStressEventTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if(++mStressFrames == STRESS_STATISTICS_FRAMES)
+    {
+      DALI_LOG_RELEASE_INFO("Uniform stress test: %u renderers, %s, event time per frame: %.3f ms\n",
+                            static_cast<uint32_t>(mStressActors.size()),
+                            mStressMode == STRESS_RING_ALLOCATOR ? "ring allocator" : "per property uniforms",
+                            mStressEventTime / mStressFrames);
+      mStressFrames    = 0u;
+      mStressEventTime = 0.0;
+    }
+    return true;
+  }
+
   void OnTouch(Window window, TouchEvent touch)
   {
+    if(mStressRendererCount > 0u)
+    {
+      if(touch.GetState(0) == PointState::STARTED)
+      {
+        SetStressMode((mStressMode + 1) % STRESS_MODE_COUNT);
+      }
+      return;
+    }
+
     static int testNumber = 0;
     if(touch.GetState(0) == PointState::STARTED)
     {
@@ -219,12 +421,42 @@ private:
 
   uint32_t mFirstActor{0};
   Timer    mTimer;
+
+  uint32_t                              mStressRendererCount{0u};
+  int                                   mStressMode{STRESS_PER_PROPERTY};
+  std::vector<Actor>                    mStressActors;
+  std::vector<Property::Index>          mStressPropertyIndices; ///< Two indices per actor
+  std::vector<uint32_t>                 mStressDataOffsets;     ///< Offsets of the actor data written last
+  std::unique_ptr<UniformRingAllocator> mRingAllocator;
+  TextLabel                             mLabel;
+  uint32_t                              mStressFrame{0u};
+  uint32_t                              mStressFrames{0u};
+  double                                mStressEventTime{0.0};
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  uint32_t stressRendererCount = 0u;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i], "--stress") == 0)
+    {
+      stressRendererCount = STRESS_RENDERER_COUNT;
+    }
+    else if(strncmp(argv[i], "--stress=", 9) == 0)
+    {
+      stressRendererCount = std::min(static_cast<uint32_t>(std::max(atoi(argv[i] + 9), 1)), STRESS_RENDERER_COUNT_MAX);
+    }
+  }
+
+  if(stressRendererCount > 0u)
+  {
+    // Logs the update and render times, to compare the modes beyond the event side cost
+    setenv("DALI_LOG_PERFORMANCE_STATS", "1", 0);
+  }
+
   Application             application = Application::New(&argc, &argv);
-  UniformBlocksController test(application);
+  UniformBlocksController test(application, stressRendererCount);
   application.MainLoop();
   return 0;
 }
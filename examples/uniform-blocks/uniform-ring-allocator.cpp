@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "uniform-ring-allocator.h"
+
+#include <dali/public-api/common/dali-common.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/rendering/sampler.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Dali;
+
+namespace
+{
+const uint32_t TEXEL_SIZE(4u * sizeof(float)); ///< A single RGBA32F texel holds a vec4
+const uint32_t TEXTURE_WIDTH(1024u);           ///< Width of the block textures in texels
+} // namespace
+
+UniformRingAllocator::UniformRingAllocator(uint32_t blockSize, uint32_t frameCount, uint32_t alignment)
+: mTextures(),
+  mTextureSet(TextureSet::New()),
+  mBlock(nullptr),
+  mBlockSize(0u),
+  mAlignment(alignment),
+  mOffset(0u),
+  mFrame(0u),
+  mRowSize(TEXTURE_WIDTH * TEXEL_SIZE),
+  mRowCount(0u)
+{
+  DALI_ASSERT_ALWAYS(alignment >= TEXEL_SIZE && (alignment & (alignment - 1u)) == 0u && "Alignment must be a power of two multiple of a vec4");
+
+  mRowCount  = std::max(1u, (blockSize + mRowSize - 1u) / mRowSize);
+  mBlockSize = mRowCount * mRowSize;
+
+  for(uint32_t i = 0; i < std::max(frameCount, 1u); ++i)
+  {
+    mTextures.push_back(Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA32F, TEXTURE_WIDTH, mRowCount));
+  }
+
+  // Every renderer reads exact texels
+  Sampler sampler = Sampler::New();
+  sampler.SetFilterMode(FilterMode::NEAREST, FilterMode::NEAREST);
+  mTextureSet.SetTexture(0u, mTextures[mFrame]);
+  mTextureSet.SetSampler(0u, sampler);
+}
+
+UniformRingAllocator::~UniformRingAllocator()
+{
+  delete[] mBlock;
+}
+
+void UniformRingAllocator::BeginFrame()
+{
+  // The block of the previous frame is owned by its upload, every frame starts with a new one
+  if(!mBlock)
+  {
+    mBlock = new uint8_t[mBlockSize];
+  }
+  mOffset = 0u;
+}
+
+uint32_t UniformRingAllocator::Allocate(uint32_t size)
+{
+  const uint32_t offset = (mOffset + mAlignment - 1u) & ~(mAlignment - 1u);
+  if(!mBlock || offset + size > mBlockSize)
+  {
+    return INVALID_OFFSET;
+  }
+
+  mOffset = offset + size;
+  return offset;
+}
+
+void* UniformRingAllocator::GetData(uint32_t offset)
+{
+  return mBlock + offset;
+}
+
+void UniformRingAllocator::EndFrame()
+{
+  if(!mBlock || mOffset == 0u)
+  {
+    return;
+  }
+
+  // Only the rows holding allocations are uploaded, the rest of the last row is cleared
+  const uint32_t rows = (mOffset + mRowSize - 1u) / mRowSize;
+  memset(mBlock + mOffset, 0, rows * mRowSize - mOffset);
+
+  PixelData pixelData = PixelData::New(mBlock, rows * mRowSize, TEXTURE_WIDTH, rows, Pixel::RGBA32F, PixelData::DELETE_ARRAY);
+  mBlock              = nullptr;
+
+  mFrame = (mFrame + 1u) % mTextures.size();
+  mTextures[mFrame].Upload(pixelData, 0u, 0u, 0u, 0u, TEXTURE_WIDTH, rows);
+  mTextureSet.SetTexture(0u, mTextures[mFrame]);
+}
+
+TextureSet UniformRingAllocator::GetTextureSet() const
+{
+  return mTextureSet;
+}
+
+Vector2 UniformRingAllocator::GetTextureSize() const
+{
+  return Vector2(static_cast<float>(TEXTURE_WIDTH), static_cast<float>(mRowCount));
+}
+
+uint32_t UniformRingAllocator::GetAllocatedSize() const
+{
+  return mOffset;
+}
@@ -0,0 +1,110 @@
+#ifndef UNIFORM_RING_ALLOCATOR_H
+#define UNIFORM_RING_ALLOCATOR_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/rendering/texture-set.h>
+#include <dali/public-api/rendering/texture.h>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The UniformRingAllocator class
+ * Packs the per renderer uniform data of a frame into one large block and uploads it once per frame.
+ *
+ * Every frame the renderers sub-allocate their data from the block, the offsets are aligned, so
+ * every allocation starts at a vec4 boundary ( or at a coarser alignment, like a uniform buffer
+ * offset alignment ). The block is stored in a RGBA32F texture, one texel per vec4, and the
+ * shaders read their data from the texel given by their offset. The block is uploaded to the next
+ * texture of a ring, so a texture is not overwritten while the previous frames may still use it.
+ *
+ * When the renderers allocate in the same order every frame, their offsets don't change and only
+ * the block has to be uploaded, instead of writing every uniform of every renderer.
+ */
+class UniformRingAllocator
+{
+public:
+  static constexpr uint32_t INVALID_OFFSET = 0xFFFFFFFFu; ///< Returned when the block is full
+
+  /**
+   * Creates an instance of UniformRingAllocator
+   * @param[in] blockSize Size of the frame block in bytes, rounded up to whole texture rows
+   * @param[in] frameCount Number of textures in the ring
+   * @param[in] alignment Alignment of the allocations in bytes, a power of two and a multiple of 16
+   */
+  UniformRingAllocator(uint32_t blockSize, uint32_t frameCount, uint32_t alignment);
+
+  /**
+   * Destroys an instance of UniformRingAllocator
+   */
+  ~UniformRingAllocator();
+
+  /**
+   * Starts a new frame, all allocations of the previous frame are released
+   */
+  void BeginFrame();
+
+  /**
+   * Allocates data from the block of the current frame
+   * @param[in] size Size of the data in bytes
+   * @return Offset of the data within the block in bytes, or INVALID_OFFSET if the block is full
+   */
+  uint32_t Allocate(uint32_t size);
+
+  /**
+   * Returns the data at the given offset of the current frame block
+   */
+  void* GetData(uint32_t offset);
+
+  /**
+   * Uploads the allocated part of the block to the next texture of the ring,
+   * and sets the texture to the texture set
+   */
+  void EndFrame();
+
+  /**
+   * Returns the texture set holding the texture uploaded last
+   */
+  Dali::TextureSet GetTextureSet() const;
+
+  /**
+   * Returns the size of the block textures in texels
+   */
+  Dali::Vector2 GetTextureSize() const;
+
+  /**
+   * Returns the number of bytes allocated in the current frame
+   */
+  uint32_t GetAllocatedSize() const;
+
+private:
+  std::vector<Dali::Texture> mTextures;   ///< Ring of block textures
+  Dali::TextureSet           mTextureSet; ///< Texture set holding the texture uploaded last
+
+  uint8_t* mBlock;     ///< Block of the current frame, handed over to the upload at the end of the frame
+  uint32_t mBlockSize; ///< Size of the block in bytes
+  uint32_t mAlignment; ///< Alignment of the allocations in bytes
+  uint32_t mOffset;    ///< End of the last allocation
+  uint32_t mFrame;     ///< Index of the texture uploaded last
+  uint32_t mRowSize;   ///< Size of a single texture row in bytes
+  uint32_t mRowCount;  ///< Number of texture rows
+};
+
+#endif
@@ -124,7 +124,50 @@ Vector3 FromHueSaturationLightness(Vector3 hsl)
   return rgb;
 }
 
-Geometry CreateTesselatedQuad(unsigned int xVerts, unsigned int yVerts, Vector2 scale, VertexFn positionFn, VertexFn texCoordFn)
+namespace
+{
+template<typename IndexType>
+void SetGridIndices(Geometry geometry, unsigned int xVerts, unsigned int yVerts)
+{
+  int                    numInds = (xVerts - 1) * (yVerts - 1) * 6;
+  std::vector<IndexType> indices;
+  indices.reserve(numInds);
+
+  for(unsigned int i = 1; i < yVerts; ++i)
+  {
+    if((i & 1) == 0)
+    {
+      for(unsigned int j = 1; j < xVerts; ++j)
+      {
+        IndexType iBase = i * xVerts + j;
+        indices.push_back(iBase);
+        indices.push_back(iBase - 1);
+        indices.push_back(iBase - xVerts - 1);
+        indices.push_back(indices.back());
+        indices.push_back(iBase - xVerts);
+        indices.push_back(iBase);
+      }
+    }
+    else
+    {
+      for(unsigned int j = 1; j < xVerts; ++j)
+      {
+        IndexType iBase = i * xVerts + j;
+        indices.push_back(iBase);
+        indices.push_back(iBase - 1);
+        indices.push_back(iBase - xVerts);
+        indices.push_back(indices.back());
+        indices.push_back(iBase - 1);
+        indices.push_back(iBase - xVerts - 1);
+      }
+    }
+  }
+
+  geometry.SetIndexBuffer(indices.data(), indices.size());
+}
+} // namespace
+
+Geometry CreateTesselatedQuad(unsigned int xVerts, unsigned int yVerts, Vector2 scale, VertexFn positionFn, VertexFn texCoordFn, std::vector<Vector2>* positions)
 {
   DALI_ASSERT_DEBUG(xVerts > 1 && yVerts > 1);
   int numVerts = xVerts * yVerts;
@@ -159,43 +202,26 @@ Geometry CreateTesselatedQuad(unsigned int xVerts, unsigned int yVerts, Vector2
                                                   .Add("aTexCoord", Property::VECTOR2));
   vertexBuffer.SetData(vertices.data(), vertices.size());
 
-  int                   numInds = (xVerts - 1) * (yVerts - 1) * 6;
-  std::vector<uint16_t> indices;
-  indices.reserve(numInds);
-
-  for(unsigned int i = 1; i < yVerts; ++i)
+  if(positions)
   {
-    if((i & 1) == 0)
-    {
-      for(unsigned int j = 1; j < xVerts; ++j)
-      {
-        int iBase = i * xVerts + j;
-        indices.push_back(iBase);
-        indices.push_back(iBase - 1);
-        indices.push_back(iBase - xVerts - 1);
-        indices.push_back(indices.back());
-        indices.push_back(iBase - xVerts);
-        indices.push_back(iBase);
-      }
-    }
-    else
+    positions->clear();
+    positions->reserve(vertices.size());
+    for(auto& vertex : vertices)
     {
-      for(unsigned int j = 1; j < xVerts; ++j)
-      {
-        int iBase = i * xVerts + j;
-        indices.push_back(iBase);
-        indices.push_back(iBase - 1);
-        indices.push_back(iBase - xVerts);
-        indices.push_back(indices.back());
-        indices.push_back(iBase - 1);
-        indices.push_back(iBase - xVerts - 1);
-      }
+      positions->push_back(vertex.aPosition);
     }
   }
 
   Geometry geom = Geometry::New();
   geom.AddVertexBuffer(vertexBuffer);
-  geom.SetIndexBuffer(indices.data(), indices.size());
+  if(numVerts > 65536)
+  {
+    SetGridIndices<uint32_t>(geom, xVerts, yVerts);
+  }
+  else
+  {
+    SetGridIndices<uint16_t>(geom, xVerts, yVerts);
+  }
   return geom;
 }
 
@@ -17,6 +17,7 @@
  *
  */
 #include <cmath>
+#include <vector>
 #include "dali/public-api/actors/actor.h"
 #include "dali/public-api/math/vector3.h"
 #include "dali/public-api/rendering/geometry.h"
@@ -73,7 +74,9 @@ using VertexFn = Dali::Vector2 (*)(const Dali::Vector2&);
 /// vertices vertically. Allows the use of an optional @a shaderFn, which can be used to
 /// modify the vertex positions - these will be in the [{ 0.f, 0.f}, { 1.f, 1.f}] range.
 /// After returning from the shader, they're transformed
-Dali::Geometry CreateTesselatedQuad(unsigned int xVerts, unsigned int yVerts, Dali::Vector2 scale, VertexFn positionFn = nullptr, VertexFn texCoordFn = nullptr);
+///@note 32 bit indices are used when there are more than 65536 vertices.
+///@param[out] positions If not null, receives the transformed vertex positions, row by row.
+Dali::Geometry CreateTesselatedQuad(unsigned int xVerts, unsigned int yVerts, Dali::Vector2 scale, VertexFn positionFn = nullptr, VertexFn texCoordFn = nullptr, std::vector<Dali::Vector2>* positions = nullptr);
 
 Dali::Texture LoadTexture(const std::string& path);
 
@@ -16,14 +16,19 @@
  */
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/dali-toolkit.h>
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <numeric>
 #include "dali/devel-api/adaptor-framework/tilt-sensor.h"
+#include "dali/integration-api/debug.h"
 #include "dali/public-api/actors/camera-actor.h"
 #include "dali/public-api/actors/layer.h"
 #include "dali/public-api/adaptor-framework/application.h"
 #include "dali/public-api/adaptor-framework/key.h"
+#include "dali/public-api/adaptor-framework/timer.h"
 #include "dali/public-api/animation/animation.h"
 #include "dali/public-api/events/key-event.h"
 #include "dali/public-api/events/pan-gesture-detector.h"
@@ -31,6 +36,7 @@
 #include "dali/public-api/events/tap-gesture.h"
 #include "dali/public-api/render-tasks/render-task-list.h"
 #include "dali/public-api/render-tasks/render-task.h"
+#include "shared/frame-time-callback.h"
 #include "utils.h"
 
 #include <dali/integration-api/string-utils.h>
@@ -77,6 +83,91 @@ const float TRANSITION_TIME_SCALE = 6.f;
 
 const std::string_view NORMAL_MAP_NAME = "noise512.png";
 
+const Vector2 WAVES_GRID_SCALE{.25f, 3.8f};
+
+/**
+ * Grid resolutions of the levels of detail, the coarsest first
+ */
+struct LodLevel
+{
+  unsigned int xVerts;
+  unsigned int yVerts;
+};
+
+const LodLevel     LOD_LEVELS[] = {{8, 32}, {12, 48}, {16, 64}, {24, 96}, {32, 128}, {48, 192}};
+const unsigned int LOD_LEVEL_COUNT(sizeof(LOD_LEVELS) / sizeof(LOD_LEVELS[0]));
+const unsigned int DEFAULT_LOD_LEVEL(2u);     ///< The grid used without --lod
+const float        DEFAULT_LOD_ERROR(24.f);   ///< Longest on-screen edge tolerated, in pixels
+const unsigned int REPORT_INTERVAL_MS(5000u); ///< Frame time report period of --report
+
+Vector2 WavesPosition(const Vector2& v)
+{
+  float y = v.y + .5f;    // 0..1
+  y = std::sqrt(y) - .5f; // perspective correction - increase vertex density closer to viewer
+
+  float x = v.x + v.x * (1.f - y) * 5.5f;
+
+  y -= .24f; // further translation
+  return Vector2{x, y};
+}
+
+Vector2 WavesTexCoord(const Vector2& v)
+{
+  return Vector2{v.x, std::sqrt(v.y)};
+}
+
+struct ProjectedVertex
+{
+  Vector2 position; ///< Position relative to the centre of the screen, in pixels
+  bool    valid;    ///< Whether the vertex is in front of the camera
+  bool    onScreen; ///< Whether the vertex is within the screen
+};
+
+/**
+ * Returns the on-screen length of an edge, or 0 if it's not visible
+ */
+float GetEdgeLength(const ProjectedVertex& a, const ProjectedVertex& b)
+{
+  return (a.valid && b.valid && (a.onScreen || b.onScreen)) ? (b.position - a.position).Length() : 0.f;
+}
+
+/**
+ * Projects the edges of a grid created by CreateTesselatedQuad(), at half the wave amplitude,
+ * and returns the length of the longest edge visible on screen, in pixels. This is the screen
+ * space error of the level, as the wave surface is linearly interpolated along the edges.
+ */
+float CalculateScreenSpaceError(const std::vector<Vector2>& positions, unsigned int xVerts, const Matrix& mvp, const Vector3& size, const Vector2& halfScreenSize)
+{
+  std::vector<ProjectedVertex> projected;
+  projected.reserve(positions.size());
+  for(auto& p : positions)
+  {
+    Vector4         clip = mvp * Vector4(p.x * size.x, WAVE_AMPLITUDE * .5f * size.y, p.y * size.z, 1.f);
+    ProjectedVertex vertex{Vector2::ZERO, clip.w > Math::MACHINE_EPSILON_1, false};
+    if(vertex.valid)
+    {
+      Vector2 ndc(clip.x / clip.w, clip.y / clip.w);
+      vertex.position = ndc * halfScreenSize;
+      vertex.onScreen = std::abs(ndc.x) <= 1.f && std::abs(ndc.y) <= 1.f;
+    }
+    projected.push_back(vertex);
+  }
+
+  float maxLength = 0.f;
+  for(size_t i = 0; i < projected.size(); ++i)
+  {
+    if(i % xVerts != 0)
+    {
+      maxLength = std::max(maxLength, GetEdgeLength(projected[i - 1], projected[i]));
+    }
+    if(i >= xVerts)
+    {
+      maxLength = std::max(maxLength, GetEdgeLength(projected[i - xVerts], projected[i]));
+    }
+  }
+  return maxLength;
+}
+
 Vector3 RandomColor()
 {
   float r = .5f + (rand() % RAND_MAX) / float(RAND_MAX) * .5f;
@@ -119,8 +210,15 @@ private:
 class WavesExample : public ConnectionTracker
 {
 public:
-  WavesExample(Application& app)
-  : mApp(app)
+  /**
+   * @param[in] app The application
+   * @param[in] lodError The longest on-screen grid edge tolerated in pixels, or 0 to always use the default grid
+   * @param[in] report Whether to log the grid size and the frame times periodically
+   */
+  WavesExample(Application& app, float lodError, bool report)
+  : mApp(app),
+    mLodError(lodError),
+    mReport(report)
   {
     mApp.InitSignal().Connect(this, &WavesExample::Create);
     mApp.TerminateSignal().Connect(this, &WavesExample::Destroy);
@@ -133,8 +231,18 @@ private:
 
   CameraActor mCamera; // no ownership
 
-  Actor  mWaves;
-  Shader mWaveShader;
+  Actor    mWaves;
+  Shader   mWaveShader;
+  Renderer mRenderer;
+
+  float                             mLodError;
+  bool                              mReport;
+  unsigned int                      mLodLevel{DEFAULT_LOD_LEVEL};
+  std::vector<Geometry>             mLodGeometries; ///< Every level of detail with --lod, otherwise the default level only
+  std::vector<std::vector<Vector2>> mLodPositions;  ///< Vertex positions of each level, to measure their screen space error on every resize
+
+  DemoHelper::FrameTimeCallback mFrameTimeCallback;
+  Timer                         mReportTimer;
 
   Property::Index mUInvLightDir{Property::INVALID_INDEX};
   Property::Index mULightColorSqr{Property::INVALID_INDEX};
@@ -176,18 +284,23 @@ private:
 
     auto shader = CreateShader();
 
-    // Create geometry
-    Geometry geom = CreateTesselatedQuad(
-      16, 64, Vector2{.25f, 3.8f}, [](const Vector2& v)
+    // Create geometry; with --lod, every level is built up front and the one to use is picked
+    // once the first frame has been presented and the camera and actor matrices are known,
+    // then again whenever the window is resized.
+    if(mLodError > 0.f)
     {
-      float y = v.y + .5f;  // 0..1
-      y = std::sqrt(y) - .5f; // perspective correction - increase vertex density closer to viewer
-
-      float x = v.x + v.x * (1.f - y) * 5.5f;
-
-      y -= .24f;  // further translation
-      return Vector2{ x, y }; }, [](const Vector2& v)
-    { return Vector2{v.x, std::sqrt(v.y)}; });
+      mLodGeometries.resize(LOD_LEVEL_COUNT);
+      mLodPositions.resize(LOD_LEVEL_COUNT);
+      for(unsigned int i = 0; i < LOD_LEVEL_COUNT; ++i)
+      {
+        mLodGeometries[i] = CreateTesselatedQuad(LOD_LEVELS[i].xVerts, LOD_LEVELS[i].yVerts, WAVES_GRID_SCALE, WavesPosition, WavesTexCoord, &mLodPositions[i]);
+      }
+    }
+    else
+    {
+      mLodGeometries.assign(1u, CreateTesselatedQuad(LOD_LEVELS[DEFAULT_LOD_LEVEL].xVerts, LOD_LEVELS[DEFAULT_LOD_LEVEL].yVerts, WAVES_GRID_SCALE, WavesPosition, WavesTexCoord));
+    }
+    Geometry geom = mLodGeometries[mLodGeometries.size() > 1 ? DEFAULT_LOD_LEVEL : 0u];
 
     // Create texture
     auto normalMap = LoadTexture(std::string(DEMO_IMAGE_DIR) + NORMAL_MAP_NAME.data());
@@ -202,6 +315,7 @@ private:
 
     // Create renderer
     Renderer renderer = CreateRenderer(textures, geom, shader, OPTION_DEPTH_TEST | OPTION_DEPTH_WRITE);
+    mRenderer         = renderer;
 
     auto waves = CreateActor();
     auto size  = Vector2(Vector2(window.GetPositionSize().width, window.GetPositionSize().height));
@@ -213,7 +327,22 @@ private:
     window.Add(waves);
     mWaves = waves;
 
+    if(mLodError > 0.f)
+    {
+      window.AddFramePresentedCallback(MakeCallback(this, &WavesExample::OnFramePresented), 0);
+    }
+
+    if(mReport)
+    {
+      UiContext::Get().AddFrameCallback(mFrameTimeCallback, rootLayer);
+
+      mReportTimer = Timer::New(REPORT_INTERVAL_MS);
+      mReportTimer.TickSignal().Connect(this, &WavesExample::OnReportTimer);
+      mReportTimer.Start();
+    }
+
     window.KeyEventSignal().Connect(this, &WavesExample::OnKeyEvent);
+    window.ResizedSignal().Connect(this, &WavesExample::OnWindowResized);
 
     // Setup double tap detector for color change
     mDoubleTapGesture = TapGestureDetector::New(2);
@@ -248,7 +377,15 @@ private:
 
   void Destroy(Application app)
   {
+    if(mReportTimer)
+    {
+      mReportTimer.Stop();
+    }
+
     mCamera.Reset();
+    mRenderer.Reset();
+    mLodGeometries.clear();
+    mLodPositions.clear();
 
     mDoubleTapGesture.Reset();
     mPanGesture.Reset();
@@ -256,6 +393,82 @@ private:
     UnparentAndReset(mWaves);
   }
 
+  /**
+   * The waves cover the window, the level of detail is picked again once a frame of the new size is presented
+   */
+  void OnWindowResized(Window window, Window::WindowSize size)
+  {
+    mWaves.SetProperty(Actor::Property::SIZE, Vector3(size.GetWidth(), 100.f, size.GetHeight()));
+
+    if(mLodError > 0.f)
+    {
+      window.AddFramePresentedCallback(MakeCallback(this, &WavesExample::OnFramePresented), 0);
+    }
+  }
+
+  /**
+   * Picks the coarsest level of detail whose longest on-screen edge is within the tolerance,
+   * or the finest level if none is.
+   */
+  void OnFramePresented(int frameId)
+  {
+    Matrix world      = mWaves.GetCurrentProperty<Matrix>(Actor::Property::WORLD_MATRIX);
+    Matrix view       = mCamera.GetCurrentProperty<Matrix>(CameraActor::Property::VIEW_MATRIX);
+    Matrix projection = mCamera.GetCurrentProperty<Matrix>(CameraActor::Property::PROJECTION_MATRIX);
+    Matrix modelView(false);
+    Matrix mvp(false);
+    Matrix::Multiply(modelView, world, view);
+    Matrix::Multiply(mvp, modelView, projection);
+
+    Vector3 size         = mWaves.GetCurrentProperty<Vector3>(Actor::Property::SIZE);
+    auto    positionSize = mApp.GetWindow().GetPositionSize();
+    Vector2 halfScreenSize(positionSize.width * .5f, positionSize.height * .5f);
+
+    unsigned int level = LOD_LEVEL_COUNT - 1;
+    for(unsigned int i = LOD_LEVEL_COUNT; i-- > 0;)
+    {
+      float error = CalculateScreenSpaceError(mLodPositions[i], LOD_LEVELS[i].xVerts, mvp, size, halfScreenSize);
+      if(error <= mLodError)
+      {
+        level = i;
+      }
+      DALI_LOG_RELEASE_INFO("Waves LOD %u: %ux%u grid, %u vertices, %u triangles, longest edge %.1f px\n",
+                            i,
+                            LOD_LEVELS[i].xVerts,
+                            LOD_LEVELS[i].yVerts,
+                            GetVertexCount(i),
+                            GetTriangleCount(i),
+                            error);
+    }
+
+    mLodLevel = level;
+    mRenderer.SetGeometry(mLodGeometries[level]);
+    DALI_LOG_RELEASE_INFO("Waves LOD %u selected for a tolerance of %.1f px\n", level, mLodError);
+  }
+
+  bool OnReportTimer()
+  {
+    DALI_LOG_RELEASE_INFO("Waves ( LOD %u ): %u vertices, %u triangles, frames %u, average frame %.2f ms, max frame %.2f ms\n",
+                          mLodLevel,
+                          GetVertexCount(mLodLevel),
+                          GetTriangleCount(mLodLevel),
+                          mFrameTimeCallback.GetFrameCount(),
+                          mFrameTimeCallback.GetAverageMilliseconds(),
+                          mFrameTimeCallback.GetMaxMilliseconds());
+    mFrameTimeCallback.Reset();
+    return true;
+  }
+
+  static unsigned int GetVertexCount(unsigned int level)
+  {
+    return LOD_LEVELS[level].xVerts * LOD_LEVELS[level].yVerts;
+  }
+
+  static unsigned int GetTriangleCount(unsigned int level)
+  {
+    return (LOD_LEVELS[level].xVerts - 1) * (LOD_LEVELS[level].yVerts - 1) * 2;
+  }
+
   Shader CreateShader()
   {
     Vector3 lightColorSqr{LIGHT_COLOR};
@@ -397,8 +610,26 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  float lodError = 0.f;
+  bool  report   = false;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i], "--lod") == 0)
+    {
+      lodError = DEFAULT_LOD_ERROR;
+    }
+    else if(strncmp(argv[i], "--lod-error=", 12) == 0)
+    {
+      lodError = std::max(float(atof(argv[i] + 12)), 1.f);
+    }
+    else if(strcmp(argv[i], "--report") == 0)
+    {
+      report = true;
+    }
+  }
+
   Application  application = Application::New(&argc, &argv, DEMO_THEME_PATH);
-  WavesExample example(application);
+  WavesExample example(application, lodError, report);
   application.MainLoop();
   return 0;
 }
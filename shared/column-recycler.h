@@ -0,0 +1,127 @@
+#ifndef DALI_DEMO_COLUMN_RECYCLER_H
+#define DALI_DEMO_COLUMN_RECYCLER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/dali.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace DemoHelper
+{
+/**
+ * @brief The ColumnRecycler class
+ * Keeps a pool of actor columns for a grid scrolling horizontally: only the visible columns and
+ * a margin on both sides have actors, all of them children of a single scroll parent.
+ *
+ * Every grid column has a fixed slot in the pool ( column % slot count ). A step property
+ * notification on the X position of the scroll parent fires once per column scrolled, and the
+ * slots of the columns leaving the window are handed to the columns entering it through the
+ * rebind function, which moves the actors of the slot and binds the images of the new column.
+ */
+class ColumnRecycler : public Dali::ConnectionTracker
+{
+public:
+  /**
+   * Moves the actors of a slot to a grid column
+   * @param[in] slot The slot of the pool
+   * @param[in] column The grid column the slot shows from now on
+   */
+  using RebindFunction = std::function<void(unsigned int slot, unsigned int column)>;
+
+  /**
+   * Creates an instance of ColumnRecycler, it has no slots until Initialize() is called
+   */
+  ColumnRecycler()
+  : mColumnWidth(1.0f),
+    mTotalColumns(0u),
+    mMargin(0u)
+  {
+  }
+
+  /**
+   * Sizes the pool and starts following the scroll position of the parent
+   * @param[in] scrollParent The parent of the recycled actors, column 0 is at its origin
+   * @param[in] columnWidth The width of a grid column
+   * @param[in] visibleColumns The number of columns visible at once
+   * @param[in] totalColumns The number of columns of the grid
+   * @param[in] rebind Called when a slot has to show another column
+   */
+  void Initialize(Dali::Actor scrollParent, float columnWidth, unsigned int visibleColumns, unsigned int totalColumns, RebindFunction rebind)
+  {
+    mScrollParent = scrollParent;
+    mColumnWidth  = columnWidth;
+    mTotalColumns = totalColumns;
+    mMargin       = std::max(visibleColumns / 2u, 1u);
+    mRebind       = rebind;
+
+    // The slots start with the first columns of the grid
+    mColumnOfSlot.resize(std::min(totalColumns, visibleColumns + mMargin * 2u));
+    for(unsigned int i = 0; i < mColumnOfSlot.size(); ++i)
+    {
+      mColumnOfSlot[i] = i;
+    }
+
+    mScrollNotification = mScrollParent.AddPropertyNotification(Dali::Actor::Property::POSITION_X, Dali::StepCondition(columnWidth, 0.0f));
+    mScrollNotification.NotifySignal().Connect(this, &ColumnRecycler::OnScrollPositionChanged);
+  }
+
+  /**
+   * Retrieves the number of slots, ie. the number of columns with actors
+   */
+  unsigned int GetSlotCount() const
+  {
+    return static_cast<unsigned int>(mColumnOfSlot.size());
+  }
+
+private:
+  void OnScrollPositionChanged(Dali::PropertyNotification& source)
+  {
+    const int totalColumns  = static_cast<int>(mTotalColumns);
+    const int slotCount     = static_cast<int>(mColumnOfSlot.size());
+    const int visibleColumn = static_cast<int>(floorf(-mScrollParent.GetCurrentProperty<float>(Dali::Actor::Property::POSITION_X) / mColumnWidth));
+    const int firstColumn   = std::max(0, std::min(totalColumns - slotCount, visibleColumn - static_cast<int>(mMargin)));
+
+    // Every column has a fixed slot, so the columns leaving the window are replaced by the ones entering it
+    for(int column = firstColumn; column < firstColumn + slotCount; ++column)
+    {
+      const unsigned int slot = static_cast<unsigned int>(column % slotCount);
+      if(mColumnOfSlot[slot] != static_cast<unsigned int>(column))
+      {
+        mColumnOfSlot[slot] = static_cast<unsigned int>(column);
+        mRebind(slot, static_cast<unsigned int>(column));
+      }
+    }
+  }
+
+private:
+  Dali::Actor                mScrollParent;       ///< Parent of the recycled actors
+  Dali::PropertyNotification mScrollNotification; ///< Notifies when the parent scrolls by a column
+  std::vector<unsigned int>  mColumnOfSlot;       ///< Grid column shown by every slot
+  RebindFunction             mRebind;             ///< Moves the actors of a slot to another column
+  float                      mColumnWidth;        ///< Width of a grid column
+  unsigned int               mTotalColumns;       ///< Number of columns of the grid
+  unsigned int               mMargin;             ///< Number of columns with actors on each side of the viewport
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_COLUMN_RECYCLER_H
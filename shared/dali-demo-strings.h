@@ -106,6 +106,7 @@ extern "C" {
 #define DALI_DEMO_STR_TITLE_NATIVE_IMAGE_SOURCE_QUEUE dgettext(DALI_DEMO_DOMAIN_LOCAL, "DALI_DEMO_STR_TITLE_NATIVE_IMAGE_SOURCE_QUEUE")
 #define DALI_DEMO_STR_TITLE_NATIVE_IMAGE_TEST dgettext(DALI_DEMO_DOMAIN_LOCAL, "DALI_DEMO_STR_TITLE_NATIVE_IMAGE_TEST")
 #define DALI_DEMO_STR_TITLE_NEGOTIATE_SIZE dgettext(DALI_DEMO_DOMAIN_LOCAL, "DALI_DEMO_STR_TITLE_NEGOTIATE_SIZE")
+#define DALI_DEMO_STR_TITLE_OBJ_READER_TEST dgettext(DALI_DEMO_DOMAIN_LOCAL, "DALI_DEMO_STR_TITLE_OBJ_READER_TEST")
 #define DALI_DEMO_STR_TITLE_PAGE_TURN dgettext(DALI_DEMO_DOMAIN_LOCAL, "DALI_DEMO_STR_TITLE_PAGE_TURN")
 #define DALI_DEMO_STR_TITLE_PARTICLES dgettext(DALI_DEMO_DOMAIN_LOCAL, "DALI_DEMO_STR_TITLE_PARTICLES")
 #define DALI_DEMO_STR_TITLE_PARTICLE_SYSTEM dgettext(DALI_DEMO_DOMAIN_LOCAL, "DALI_DEMO_STR_TITLE_PARTICLE_SYSTEM")
@@ -242,6 +243,7 @@ extern "C" {
 #define DALI_DEMO_STR_TITLE_NATIVE_IMAGE_SOURCE "Native Image Source"
 #define DALI_DEMO_STR_TITLE_NATIVE_IMAGE_SOURCE_QUEUE "Native Image Source Queue"
 #define DALI_DEMO_STR_TITLE_NEGOTIATE_SIZE "Negotiate Size"
+#define DALI_DEMO_STR_TITLE_OBJ_READER_TEST "OBJ Reader Test"
 #define DALI_DEMO_STR_TITLE_PAGE_TURN "Page Turn"
 #define DALI_DEMO_STR_TITLE_PARTICLES "Particles"
 #define DALI_DEMO_STR_TITLE_PARTICLE_SYSTEM "Particle System"
@@ -78,6 +78,8 @@ const int     EXAMPLES_PER_ROW            = 3;
 const int     ROWS_PER_PAGE               = 3;
 const int     EXAMPLES_PER_PAGE           = EXAMPLES_PER_ROW * ROWS_PER_PAGE;
 const Vector3 TABLE_RELATIVE_SIZE(0.95f, 0.9f, 0.8f); ///< TableView's relative size to the entire scene. The Y value means sum of the logo and table relative heights.
+const int     VIRTUALIZED_PAGE_COUNT      = 3;     ///< Number of page actors in the virtualized mode: the current page and its neighbours
+const int     TILE_LABEL_CHILD_INDEX      = 1;     ///< Index of the label within the tile children ( after the border image )
 
 const char* const DEMO_BUILD_DATE = __DATE__ " " __TIME__;
 
@@ -277,7 +279,8 @@ DaliTableView::DaliTableView(Application& application)
   mPageWidth(0.0f),
   mTotalPages(),
   mScrolling(false),
-  mSortAlphabetically(false)
+  mSortAlphabetically(false),
+  mVirtualized(false)
 {
   application.InitSignal().Connect(this, &DaliTableView::Initialize);
 }
@@ -292,6 +295,11 @@ void DaliTableView::SortAlphabetically(bool sortAlphabetically)
   mSortAlphabetically = sortAlphabetically;
 }
 
+void DaliTableView::SetVirtualized(bool virtualized)
+{
+  mVirtualized = virtualized;
+}
+
 void DaliTableView::Initialize(Application application)
 {
   Window window = application.GetWindow();
@@ -432,6 +440,12 @@ void DaliTableView::OnFocusIndicatorDisabled(Dali::Actor /* actor */)
 
 void DaliTableView::ApplyCubeEffectToPages()
 {
+  if(mVirtualized)
+  {
+    // The effect is applied when a page actor is recycled
+    return;
+  }
+
   ScrollViewPagePathEffect effect = ScrollViewPagePathEffect::DownCast(mScrollViewEffect);
   unsigned int             pageCount(0);
   for(std::vector<Actor>::iterator pageIter = mPages.begin(); pageIter != mPages.end(); ++pageIter)
@@ -454,16 +468,28 @@ void DaliTableView::Populate()
       { return lhs.title < rhs.title; });
     }
 
+    if(mVirtualized)
+    {
+      // Only the current page and its neighbours exist, they are recycled as the scroll view moves
+      mPages.resize(mTotalPages);
+      for(int t = 0; t < std::min(mTotalPages, VIRTUALIZED_PAGE_COUNT); t++)
+      {
+        mPagePool.push_back(RecyclablePage{CreateRecyclablePage(), -1});
+      }
+      UpdateVirtualPages(0);
+
+      mScrollView.ScrollUpdatedSignal().Connect(this, &DaliTableView::OnScrollUpdated);
+
+      SetupScrollViewRulers(mScrollView, mApplication.GetWindow().GetPositionSize().width, mPageWidth, mTotalPages);
+      return;
+    }
+
     ExampleListConstIter iter = mExampleList.begin();
 
     for(int t = 0; t < mTotalPages && iter != mExampleList.end(); t++)
     {
       // Create Table
-      TableView page = TableView::New(ROWS_PER_PAGE, EXAMPLES_PER_ROW);
-      page.SetProperty(Actor::Property::PIVOT, Pivot::CENTER);
-      page.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-      DevelActor::SetResizePolicy(page, ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
-      mScrollView.Add(page);
+      TableView page = CreatePage();
 
       // Calculate the number of images going across (columns) within a page, according to the screen resolution and dpi.
       const float margin               = 2.0f;
@@ -493,6 +519,106 @@ void DaliTableView::Populate()
   SetupScrollViewRulers(mScrollView, mApplication.GetWindow().GetPositionSize().width, mPageWidth, mTotalPages);
 }
 
+TableView DaliTableView::CreatePage()
+{
+  TableView page = TableView::New(ROWS_PER_PAGE, EXAMPLES_PER_ROW);
+  page.SetProperty(Actor::Property::PIVOT, Pivot::CENTER);
+  page.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  DevelActor::SetResizePolicy(page, ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+  mScrollView.Add(page);
+  return page;
+}
+
+TableView DaliTableView::CreateRecyclablePage()
+{
+  TableView page = CreatePage();
+
+  // Hidden until it's assigned a page index and positioned by the scroll view effect
+  page.SetProperty(Actor::Property::VISIBLE, false);
+
+  const float margin               = 2.0f;
+  const float tileParentMultiplier = 1.0f / EXAMPLES_PER_ROW;
+
+  for(int row = 0; row < ROWS_PER_PAGE; row++)
+  {
+    for(int column = 0; column < EXAMPLES_PER_ROW; column++)
+    {
+      // Name and title are set when the page is recycled
+      Vector2 position(static_cast<float>(column) / (EXAMPLES_PER_ROW - 1.0f), static_cast<float>(row) / (EXAMPLES_PER_ROW - 1.0f));
+      Actor   tile = CreateTile(std::string(), std::string(), Vector3(tileParentMultiplier, tileParentMultiplier, 1.0f), position);
+
+      tile.SetProperty(DevelActor::Property::PADDING, Vector4(margin, margin, margin, margin));
+      page.AddChild(tile, TableView::CellPosition(row, column));
+    }
+  }
+
+  return page;
+}
+
+void DaliTableView::RecyclePage(TableView pageActor, int pageIndex)
+{
+  // Move the page to its new place within the effect
+  pageActor.RemoveConstraints();
+  ScrollViewPagePathEffect effect = ScrollViewPagePathEffect::DownCast(mScrollViewEffect);
+  effect.ApplyToPage(pageActor, pageIndex);
+  pageActor.SetProperty(Actor::Property::VISIBLE, true);
+
+  for(int slot = 0; slot < EXAMPLES_PER_PAGE; slot++)
+  {
+    Actor        tile         = pageActor.GetChildAt(slot);
+    const size_t exampleIndex = static_cast<size_t>(pageIndex * EXAMPLES_PER_PAGE + slot);
+    const bool   used         = exampleIndex < mExampleList.size();
+
+    // The last page may not be full
+    tile.SetProperty(Actor::Property::VISIBLE, used);
+    tile.SetProperty(Actor::Property::SENSITIVE, used);
+    tile.SetProperty(Actor::Property::FOCUSABLE, used);
+    if(used)
+    {
+      const Example& example = mExampleList[exampleIndex];
+      tile.SetProperty(Actor::Property::NAME, ToPropertyValue(example.name));
+      tile.GetChildAt(TILE_LABEL_CHILD_INDEX).SetProperty(TextLabel::Property::TEXT, ToDaliString(example.title));
+    }
+    else
+    {
+      tile.SetProperty(Actor::Property::NAME, "");
+    }
+  }
+
+  mPages[pageIndex] = pageActor;
+}
+
+void DaliTableView::UpdateVirtualPages(int centerPage)
+{
+  const int firstPage = std::max(0, centerPage - 1);
+  const int lastPage  = std::min(mTotalPages - 1, centerPage + 1);
+
+  // Release page actors which are no longer needed, they keep their content until recycled
+  std::vector<RecyclablePage*> freePages;
+  for(RecyclablePage& page : mPagePool)
+  {
+    if(page.index < firstPage || page.index > lastPage)
+    {
+      if(page.index >= 0)
+      {
+        mPages[page.index].Reset();
+      }
+      freePages.push_back(&page);
+    }
+  }
+
+  for(int pageIndex = firstPage; pageIndex <= lastPage && !freePages.empty(); pageIndex++)
+  {
+    if(!mPages[pageIndex])
+    {
+      RecyclablePage* page = freePages.back();
+      freePages.pop_back();
+      page->index = pageIndex;
+      RecyclePage(page->actor, pageIndex);
+    }
+  }
+}
+
 Actor DaliTableView::CreateTile(const std::string& name, const std::string& title, const Dali::Vector3& sizeMultiplier, Vector2& position)
 {
   Toolkit::ImageView focusableTile = ImageView::New();
@@ -636,6 +762,11 @@ void DaliTableView::OnScrollComplete(const Dali::Vector2& position)
   mScrolling = false;
 }
 
+void DaliTableView::OnScrollUpdated(const Dali::Vector2& position)
+{
+  UpdateVirtualPages(mScrollView.GetCurrentPage());
+}
+
 bool DaliTableView::OnScrollTouched(Actor actor, TouchEvent event)
 {
   if(PointState::DOWN == event.GetState(0))
@@ -688,6 +819,11 @@ Dali::Actor DaliTableView::OnKeyboardPreFocusChange(Dali::Actor current, Dali::A
 
   if(!current && !proposed)
   {
+    if(mVirtualized)
+    {
+      UpdateVirtualPages(mScrollView.GetCurrentPage());
+    }
+
     // Set the initial focus to the first tile in the current page should be focused.
     nextFocusActor = mPages[mScrollView.GetCurrentPage()].GetChildAt(0);
   }
@@ -722,6 +858,12 @@ Dali::Actor DaliTableView::OnKeyboardPreFocusChange(Dali::Actor current, Dali::A
     // Scroll to the page in the given direction
     mScrollView.ScrollTo(newPage);
 
+    if(mVirtualized)
+    {
+      // The page may not exist yet when the focus wraps around
+      UpdateVirtualPages(newPage);
+    }
+
     if(direction == Dali::Toolkit::Control::KeyboardFocus::LEFT)
     {
       // Work out the cell position for the last tile
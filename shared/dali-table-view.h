@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/popup/popup.h>
+#include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali/dali.h>
 
 // INTERNAL INCLUDES
@@ -65,6 +66,17 @@ public:
    */
   void SortAlphabetically(bool sortAlphabetically);
 
+  /**
+   * Enables the virtualized mode in which only the current page and its neighbours
+   * are created. The page actors and their tiles are recycled while scrolling.
+   *
+   * @param[in] virtualized If true, pages are created on demand.
+   *
+   * @note Should be called before the Application MainLoop is started.
+   * @note By default all the pages are created up front.
+   */
+  void SetVirtualized(bool virtualized);
+
 private:                                                          // Application callbacks & implementation
   static constexpr unsigned int FOCUS_ANIMATION_ACTOR_NUMBER = 2; ///< The number of elements used to form the custom focus effect
 
@@ -94,6 +106,35 @@ private:                                                          // Application
    */
   Dali::Actor CreateTile(const std::string& name, const std::string& title, const Dali::Vector3& sizeMultiplier, Dali::Vector2& position);
 
+  /**
+   * Creates an empty page added to the scroll view.
+   *
+   * @return The page actor.
+   */
+  Dali::Toolkit::TableView CreatePage();
+
+  /**
+   * Creates a page with a tile for every slot of the page for the virtualized mode.
+   *
+   * @return The page actor.
+   */
+  Dali::Toolkit::TableView CreateRecyclablePage();
+
+  /**
+   * Shows the examples of the given page on a recycled page actor.
+   *
+   * @param[in] pageActor The page actor to reuse.
+   * @param[in] pageIndex Index of the page to show.
+   */
+  void RecyclePage(Dali::Toolkit::TableView pageActor, int pageIndex);
+
+  /**
+   * Makes sure the given page and its neighbours are created in the virtualized mode.
+   *
+   * @param[in] centerPage Index of the current page.
+   */
+  void UpdateVirtualPages(int centerPage);
+
   // Signal handlers
 
   /**
@@ -147,6 +188,13 @@ private:                                                          // Application
    */
   void OnScrollComplete(const Dali::Vector2& position);
 
+  /**
+   * Signal emitted when the scroll position changes.
+   *
+   * @param[in] position The current position of the scroll contents.
+   */
+  void OnScrollUpdated(const Dali::Vector2& position);
+
   /**
    * Signal emitted when any Sensitive Actor has been touched
    * (other than those touches consumed by OnTilePressed)
@@ -238,14 +286,25 @@ private:
   };
   FocusEffect mFocusEffect[FOCUS_ANIMATION_ACTOR_NUMBER]; ///< The elements used to create the custom focus effect
 
-  std::vector<Dali::Actor> mPages;       ///< List of pages.
-  ExampleList              mExampleList; ///< List of examples.
+  /**
+   * Page actor reused for different pages in the virtualized mode.
+   */
+  struct RecyclablePage
+  {
+    Dali::Toolkit::TableView actor; ///< The page actor
+    int                      index; ///< Index of the page currently shown
+  };
+
+  std::vector<Dali::Actor>    mPages;       ///< List of pages, in the virtualized mode only the created pages are set.
+  std::vector<RecyclablePage> mPagePool;    ///< Page actors recycled in the virtualized mode.
+  ExampleList                 mExampleList; ///< List of examples.
 
   float mPageWidth;  ///< The width of a page within the scroll-view, used to calculate the domain
   int   mTotalPages; ///< Total pages within scrollview.
 
   bool mScrolling : 1;          ///< Flag indicating whether view is currently being scrolled
   bool mSortAlphabetically : 1; ///< Sort examples alphabetically.
+  bool mVirtualized : 1;        ///< Create pages on demand and recycle them.
 };
 
 #endif // DALI_DEMO_TABLEVIEW_H
@@ -0,0 +1,104 @@
+#ifndef DALI_DEMO_FRAME_TIME_CALLBACK_H
+#define DALI_DEMO_FRAME_TIME_CALLBACK_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/update/frame-callback-interface.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace DemoHelper
+{
+/**
+ * @brief The FrameTimeCallback class
+ * Measures the frame times on the update thread, so the statistics reflect the rendered
+ * frames rather than the interval of the event thread timers.
+ *
+ * Only the update thread writes the counters, the event thread reads and resets them.
+ */
+class FrameTimeCallback : public Dali::FrameCallbackInterface
+{
+public:
+  /**
+   * Creates an instance of FrameTimeCallback
+   */
+  FrameTimeCallback()
+  : mFrameCount(0u),
+    mTotalMicroseconds(0u),
+    mMaxMicroseconds(0u)
+  {
+  }
+
+  /**
+   * Starts a new measurement
+   */
+  void Reset()
+  {
+    mFrameCount        = 0u;
+    mTotalMicroseconds = 0u;
+    mMaxMicroseconds   = 0u;
+  }
+
+  /**
+   * Retrieves the number of frames since the last reset
+   */
+  uint32_t GetFrameCount() const
+  {
+    return mFrameCount;
+  }
+
+  /**
+   * Retrieves the average frame time since the last reset in milliseconds
+   */
+  float GetAverageMilliseconds() const
+  {
+    const uint32_t frameCount = mFrameCount;
+    return frameCount ? mTotalMicroseconds / (frameCount * 1000.0f) : 0.0f;
+  }
+
+  /**
+   * Retrieves the longest frame time since the last reset in milliseconds
+   */
+  float GetMaxMilliseconds() const
+  {
+    return mMaxMicroseconds / 1000.0f;
+  }
+
+private:
+  bool Update(Dali::UpdateProxy& /* updateProxy */, float elapsedSeconds) override
+  {
+    const uint64_t microseconds = static_cast<uint64_t>(elapsedSeconds * 1000000.0f);
+    mTotalMicroseconds += microseconds;
+    if(microseconds > mMaxMicroseconds)
+    {
+      mMaxMicroseconds = microseconds;
+    }
+    ++mFrameCount;
+    return false;
+  }
+
+private:
+  std::atomic<uint32_t> mFrameCount;        ///< Number of frames since the last reset
+  std::atomic<uint64_t> mTotalMicroseconds; ///< Sum of the frame times
+  std::atomic<uint64_t> mMaxMicroseconds;   ///< The longest frame time
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_FRAME_TIME_CALLBACK_H
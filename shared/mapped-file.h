@@ -0,0 +1,172 @@
+#ifndef DALI_DEMO_MAPPED_FILE_H
+#define DALI_DEMO_MAPPED_FILE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/devel-api/adaptor-framework/file-stream.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DALI_DEMO_MAPPED_FILE_USE_MMAP
+#endif
+
+namespace DemoHelper
+{
+/**
+ * @brief Gives read-only access to the whole content of a file.
+ *
+ * Where supported the file is memory mapped, so the data is paged in on demand and never copied.
+ * Otherwise ( or if mapping fails, ie. for files packed within the application package ) the file
+ * is read into memory through a Dali::FileStream.
+ */
+class MappedFile
+{
+public:
+  /**
+   * @brief Creates an instance of MappedFile, no file is opened.
+   */
+  MappedFile()
+  : mMapping(nullptr),
+    mSize(0u)
+  {
+  }
+
+  /**
+   * @brief Destroys an instance of MappedFile and unmaps the file.
+   */
+  ~MappedFile()
+  {
+    Close();
+  }
+
+  /**
+   * @brief Opens and maps the file, any previously opened file is closed.
+   *
+   * @param[in] path The file path.
+   * @return True if the file content is accessible.
+   */
+  bool Open(const char* path)
+  {
+    Close();
+
+#ifdef DALI_DEMO_MAPPED_FILE_USE_MMAP
+    int fd = open(path, O_RDONLY);
+    if(fd >= 0)
+    {
+      struct stat fileStat;
+      if(fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+      {
+        void* mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapping != MAP_FAILED)
+        {
+          mMapping = mapping;
+          mSize    = static_cast<size_t>(fileStat.st_size);
+        }
+      }
+      // the mapping stays valid after the descriptor is closed
+      close(fd);
+
+      if(mMapping)
+      {
+        return true;
+      }
+    }
+#endif
+
+    // file is not on the file system or can't be mapped, read it through the FileStream
+    Dali::FileStream fileStream(path, Dali::FileStream::READ | Dali::FileStream::BINARY);
+    FILE*            fp(fileStream.GetFile());
+    if(!fp || fseek(fp, 0, SEEK_END))
+    {
+      return false;
+    }
+    long int size = ftell(fp);
+    if(size <= 0 || fseek(fp, 0, SEEK_SET))
+    {
+      return false;
+    }
+    mBytes.resize(static_cast<size_t>(size));
+    if(fread(mBytes.data(), mBytes.size(), 1u, fp) != 1)
+    {
+      Close();
+      return false;
+    }
+    mSize = mBytes.size();
+    return true;
+  }
+
+  /**
+   * @brief Unmaps the file and releases the loaded content.
+   */
+  void Close()
+  {
+#ifdef DALI_DEMO_MAPPED_FILE_USE_MMAP
+    if(mMapping)
+    {
+      munmap(mMapping, mSize);
+    }
+#endif
+    mMapping = nullptr;
+    mSize    = 0u;
+    std::vector<uint8_t>().swap(mBytes);
+  }
+
+  /**
+   * @brief Retrieves the file content, nullptr if no file is open.
+   */
+  const uint8_t* GetData() const
+  {
+    return mMapping ? static_cast<const uint8_t*>(mMapping) : (mBytes.empty() ? nullptr : mBytes.data());
+  }
+
+  /**
+   * @brief Retrieves the size of the file content in bytes.
+   */
+  size_t GetSize() const
+  {
+    return mSize;
+  }
+
+  /**
+   * @brief Checks whether the file is memory mapped rather than copied.
+   */
+  bool IsMapped() const
+  {
+    return mMapping != nullptr;
+  }
+
+private:
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+private:
+  std::vector<uint8_t> mBytes;   ///< File content when the file couldn't be mapped
+  void*                mMapping; ///< Address of the mapping
+  size_t               mSize;    ///< Size of the file content
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_MAPPED_FILE_H
@@ -0,0 +1,496 @@
+#ifndef DALI_DEMO_OBJ_READER_H
+#define DALI_DEMO_OBJ_READER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/file-loader.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace DemoHelper
+{
+/**
+ * @brief A triangle of an OBJ file.
+ *
+ * The indices are zero based and already resolved when the file used relative ( negative ) ones.
+ * A normal or texture coordinate index is -1 when the face didn't reference one.
+ */
+struct ObjTriangle
+{
+  int32_t pointIndex[3];
+  int32_t normalIndex[3];
+  int32_t textureIndex[3];
+};
+
+/**
+ * @brief The content of an OBJ file.
+ *
+ * Texture coordinates are stored as they are in the file, v pointing up.
+ * The tangents, binormals and second texture coordinates are read from the "#_#tangent",
+ * "#_#binormal" and "#_#vt1" comment lines written by the exporter of the PBR models.
+ */
+struct ObjData
+{
+  /**
+   * @brief Empties every array and resets the bounding box
+   */
+  void Clear()
+  {
+    points.Clear();
+    normals.Clear();
+    textureCoordinates.Clear();
+    textureCoordinates2.Clear();
+    tangents.Clear();
+    binormals.Clear();
+    triangles.Clear();
+    pointMin          = Dali::Vector3(FLT_MAX, FLT_MAX, FLT_MAX);
+    pointMax          = Dali::Vector3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    hasNormals        = false;
+    hasTextureIndices = false;
+  }
+
+  Dali::Vector<Dali::Vector3> points;
+  Dali::Vector<Dali::Vector3> normals;
+  Dali::Vector<Dali::Vector2> textureCoordinates;
+  Dali::Vector<Dali::Vector2> textureCoordinates2;
+  Dali::Vector<Dali::Vector3> tangents;
+  Dali::Vector<Dali::Vector3> binormals;
+  Dali::Vector<ObjTriangle>   triangles;
+
+  Dali::Vector3 pointMin{FLT_MAX, FLT_MAX, FLT_MAX};    ///< Minimum of the bounding box of the points
+  Dali::Vector3 pointMax{-FLT_MAX, -FLT_MAX, -FLT_MAX}; ///< Maximum of the bounding box of the points
+  bool          hasNormals{false};                      ///< Whether a face referenced a normal
+  bool          hasTextureIndices{false};               ///< Whether a face referenced a texture coordinate
+};
+
+/**
+ * @brief The ObjReader class
+ * Reads the geometry of Wavefront OBJ files in a single pass over the file buffer.
+ *
+ * The buffer is scanned once with a pointer, numbers are converted in place without copying the
+ * lines into strings or streams, and faces with more than three vertices are split into a fan
+ * of triangles. Unknown statements ( o, g, s, usemtl, mtllib, l... ) and comments are skipped.
+ *
+ * A malformed statement stops the parsing: GetError() returns a description of the problem
+ * and GetErrorLine() the number of the offending line, counting from 1.
+ */
+class ObjReader
+{
+public:
+  /**
+   * @brief Reads an OBJ file
+   * @param[in] url The path of the file
+   * @param[out] data The content of the file
+   * @return True if the file was read and parsed without error
+   */
+  bool Read(const std::string& url, ObjData& data)
+  {
+    std::streampos     bufferSize = 0;
+    Dali::Vector<char> buffer;
+    if(!Dali::FileLoader::ReadFile(url, bufferSize, buffer, Dali::FileLoader::FileType::TEXT))
+    {
+      data.Clear();
+      mError     = "can't read " + url;
+      mErrorLine = 0u;
+      return false;
+    }
+    return Parse(buffer.Begin(), static_cast<size_t>(bufferSize), data);
+  }
+
+  /**
+   * @brief Parses the content of an OBJ file
+   * @param[in] buffer The file content, it doesn't have to be null terminated
+   * @param[in] size The size of the content in bytes
+   * @param[out] data The content of the file, cleared first
+   * @return True if the content was parsed without error
+   */
+  bool Parse(const char* buffer, size_t size, ObjData& data)
+  {
+    data.Clear();
+    mError.clear();
+    mErrorLine = 0u;
+
+    mCursor = buffer;
+    mEnd    = buffer + size;
+    mLine   = 1u;
+
+    while(mCursor < mEnd)
+    {
+      SkipSpaces();
+      if(mCursor >= mEnd)
+      {
+        break;
+      }
+
+      const char* keyword = mCursor;
+      while(mCursor < mEnd && !IsSpace(*mCursor) && *mCursor != '\n' && *mCursor != '\r')
+      {
+        ++mCursor;
+      }
+      const size_t keywordLength = mCursor - keyword;
+
+      bool parsed = true;
+      if(IsKeyword(keyword, keywordLength, "v"))
+      {
+        Dali::Vector3 point;
+        parsed = ReadFloats(&point.x, 3u, "vertex position");
+        if(parsed)
+        {
+          data.points.PushBack(point);
+          data.pointMin.x = std::min(data.pointMin.x, point.x);
+          data.pointMin.y = std::min(data.pointMin.y, point.y);
+          data.pointMin.z = std::min(data.pointMin.z, point.z);
+          data.pointMax.x = std::max(data.pointMax.x, point.x);
+          data.pointMax.y = std::max(data.pointMax.y, point.y);
+          data.pointMax.z = std::max(data.pointMax.z, point.z);
+        }
+      }
+      else if(IsKeyword(keyword, keywordLength, "vn"))
+      {
+        parsed = ReadVector3(data.normals, "normal");
+      }
+      else if(IsKeyword(keyword, keywordLength, "vt"))
+      {
+        parsed = ReadVector2(data.textureCoordinates, "texture coordinate");
+      }
+      else if(IsKeyword(keyword, keywordLength, "f"))
+      {
+        parsed = ReadFace(data);
+      }
+      else if(IsKeyword(keyword, keywordLength, "#_#tangent"))
+      {
+        parsed = ReadVector3(data.tangents, "tangent");
+      }
+      else if(IsKeyword(keyword, keywordLength, "#_#binormal"))
+      {
+        parsed = ReadVector3(data.binormals, "binormal");
+      }
+      else if(IsKeyword(keyword, keywordLength, "#_#vt1"))
+      {
+        parsed = ReadVector2(data.textureCoordinates2, "texture coordinate");
+      }
+
+      if(!parsed)
+      {
+        mErrorLine = mLine;
+        return false;
+      }
+      SkipLine();
+    }
+    return true;
+  }
+
+  /**
+   * @brief Retrieves the description of the last parse error, empty if there was none
+   */
+  const std::string& GetError() const
+  {
+    return mError;
+  }
+
+  /**
+   * @brief Retrieves the line of the last parse error, 0 if there was none or the file couldn't be read
+   */
+  uint32_t GetErrorLine() const
+  {
+    return mErrorLine;
+  }
+
+private:
+  static bool IsSpace(char c)
+  {
+    return c == ' ' || c == '\t';
+  }
+
+  static bool IsDigit(char c)
+  {
+    return static_cast<unsigned char>(c - '0') < 10u;
+  }
+
+  static bool IsKeyword(const char* keyword, size_t length, const char* expected)
+  {
+    return length == strlen(expected) && memcmp(keyword, expected, length) == 0;
+  }
+
+  void SkipSpaces()
+  {
+    while(mCursor < mEnd && IsSpace(*mCursor))
+    {
+      ++mCursor;
+    }
+  }
+
+  /**
+   * @brief Moves the cursor to the start of the next line, ignoring the rest of the current one
+   */
+  void SkipLine()
+  {
+    const void* lineEnd = memchr(mCursor, '\n', mEnd - mCursor);
+    mCursor             = lineEnd ? static_cast<const char*>(lineEnd) + 1 : mEnd;
+    ++mLine;
+  }
+
+  bool AtLineEnd() const
+  {
+    return mCursor >= mEnd || *mCursor == '\n' || *mCursor == '\r' || *mCursor == '#';
+  }
+
+  bool Fail(const std::string& message)
+  {
+    mError = message;
+    return false;
+  }
+
+  /**
+   * @brief Converts a decimal number ( optional sign, fraction and exponent ) at the cursor
+   */
+  bool ReadFloat(float& value)
+  {
+    SkipSpaces();
+    const char* start    = mCursor;
+    bool        negative = false;
+    if(mCursor < mEnd && (*mCursor == '-' || *mCursor == '+'))
+    {
+      negative = *mCursor++ == '-';
+    }
+
+    uint64_t mantissa = 0u;
+    int32_t  exponent = 0;
+    uint32_t digits   = 0u;
+    for(; mCursor < mEnd && IsDigit(*mCursor); ++mCursor, ++digits)
+    {
+      if(mantissa < 100000000000000000ull)
+      {
+        mantissa = mantissa * 10u + (*mCursor - '0');
+      }
+      else
+      {
+        ++exponent; // Digits beyond the precision of a float only scale the value
+      }
+    }
+    if(mCursor < mEnd && *mCursor == '.')
+    {
+      for(++mCursor; mCursor < mEnd && IsDigit(*mCursor); ++mCursor, ++digits)
+      {
+        if(mantissa < 100000000000000000ull)
+        {
+          mantissa = mantissa * 10u + (*mCursor - '0');
+          --exponent;
+        }
+      }
+    }
+    if(digits == 0u)
+    {
+      mCursor = start;
+      return false;
+    }
+    if(mCursor < mEnd && (*mCursor == 'e' || *mCursor == 'E'))
+    {
+      const char* exponentStart    = mCursor++;
+      bool        negativeExponent = false;
+      if(mCursor < mEnd && (*mCursor == '-' || *mCursor == '+'))
+      {
+        negativeExponent = *mCursor++ == '-';
+      }
+      if(mCursor >= mEnd || !IsDigit(*mCursor))
+      {
+        mCursor = exponentStart;
+        return false;
+      }
+      int32_t explicitExponent = 0;
+      for(; mCursor < mEnd && IsDigit(*mCursor); ++mCursor)
+      {
+        explicitExponent = std::min(explicitExponent * 10 + (*mCursor - '0'), 1000);
+      }
+      exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+
+    double result = static_cast<double>(mantissa);
+    if(exponent != 0 && mantissa != 0u)
+    {
+      static const double POWERS_OF_TEN[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+      uint32_t            remaining       = std::abs(exponent);
+      while(remaining > 0u && result != 0.0 && result <= DBL_MAX)
+      {
+        const uint32_t step = std::min(remaining, 22u);
+        result              = exponent < 0 ? result / POWERS_OF_TEN[step] : result * POWERS_OF_TEN[step];
+        remaining -= step;
+      }
+    }
+    value = static_cast<float>(negative ? -result : result);
+    return mCursor >= mEnd || !(IsDigit(*mCursor) || *mCursor == '.' || *mCursor == '-' || *mCursor == '+');
+  }
+
+  bool ReadFloats(float* values, uint32_t count, const char* what)
+  {
+    for(uint32_t i = 0u; i < count; ++i)
+    {
+      if(!ReadFloat(values[i]))
+      {
+        return Fail(std::string("malformed ") + what);
+      }
+    }
+    return true;
+  }
+
+  bool ReadVector3(Dali::Vector<Dali::Vector3>& array, const char* what)
+  {
+    Dali::Vector3 vector;
+    if(!ReadFloats(&vector.x, 3u, what))
+    {
+      return false;
+    }
+    array.PushBack(vector);
+    return true;
+  }
+
+  bool ReadVector2(Dali::Vector<Dali::Vector2>& array, const char* what)
+  {
+    Dali::Vector2 vector;
+    if(!ReadFloats(&vector.x, 2u, what))
+    {
+      return false;
+    }
+    array.PushBack(vector);
+    return true;
+  }
+
+  /**
+   * @brief Reads a one based, possibly relative index and resolves it into a zero based one
+   *
+   * Some exporters reference texture coordinates or normals they never wrote, an optional
+   * attribute without any element in the file is then resolved to -1 instead of failing.
+   * @param[in] count The number of elements read so far, relative indices count back from it
+   * @param[in] optional Whether the attribute may be missing from the file
+   * @param[out] index The zero based index
+   */
+  bool ReadIndex(uint32_t count, bool optional, int32_t& index)
+  {
+    bool negative = false;
+    if(mCursor < mEnd && *mCursor == '-')
+    {
+      negative = true;
+      ++mCursor;
+    }
+    if(mCursor >= mEnd || !IsDigit(*mCursor))
+    {
+      return false;
+    }
+    int64_t value = 0;
+    for(; mCursor < mEnd && IsDigit(*mCursor); ++mCursor)
+    {
+      value = std::min<int64_t>(value * 10 + (*mCursor - '0'), INT32_MAX);
+    }
+    value = negative ? static_cast<int64_t>(count) - value : value - 1;
+    if(optional && count == 0u)
+    {
+      value = -1;
+    }
+    else if(value < 0 || value >= static_cast<int64_t>(count))
+    {
+      return false;
+    }
+    index = static_cast<int32_t>(value);
+    return true;
+  }
+
+  /**
+   * @brief Reads a face in any of the forms A, A/B, A//C and A/B/C and adds its triangles
+   */
+  bool ReadFace(ObjData& data)
+  {
+    const uint32_t pointCount   = data.points.Count();
+    const uint32_t textureCount = data.textureCoordinates.Count();
+    const uint32_t normalCount  = data.normals.Count();
+
+    ObjTriangle triangle;
+    uint32_t    vertexCount = 0u;
+    SkipSpaces();
+    while(!AtLineEnd())
+    {
+      int32_t point   = -1;
+      int32_t texture = -1;
+      int32_t normal  = -1;
+      if(!ReadIndex(pointCount, false, point))
+      {
+        return Fail("invalid vertex index in face");
+      }
+      if(mCursor < mEnd && *mCursor == '/')
+      {
+        ++mCursor;
+        if(mCursor < mEnd && *mCursor != '/' && !ReadIndex(textureCount, true, texture))
+        {
+          return Fail("invalid texture coordinate index in face");
+        }
+        if(mCursor < mEnd && *mCursor == '/')
+        {
+          ++mCursor;
+          if(!ReadIndex(normalCount, true, normal))
+          {
+            return Fail("invalid normal index in face");
+          }
+        }
+      }
+      if(!AtLineEnd() && !IsSpace(*mCursor))
+      {
+        return Fail("unexpected character in face");
+      }
+
+      // Fan triangulation: ( 0, 1, 2 ), ( 0, 2, 3 )...
+      const uint32_t slot = vertexCount < 3u ? vertexCount : 2u;
+      if(vertexCount >= 3u)
+      {
+        data.triangles.PushBack(triangle);
+        triangle.pointIndex[1]   = triangle.pointIndex[2];
+        triangle.normalIndex[1]  = triangle.normalIndex[2];
+        triangle.textureIndex[1] = triangle.textureIndex[2];
+      }
+      triangle.pointIndex[slot]   = point;
+      triangle.normalIndex[slot]  = normal;
+      triangle.textureIndex[slot] = texture;
+      data.hasNormals             = data.hasNormals || normal >= 0;
+      data.hasTextureIndices      = data.hasTextureIndices || texture >= 0;
+      ++vertexCount;
+      SkipSpaces();
+    }
+
+    if(vertexCount < 3u)
+    {
+      return Fail("face with less than three vertices");
+    }
+    data.triangles.PushBack(triangle);
+    return true;
+  }
+
+private:
+  const char* mCursor{nullptr}; ///< Current position in the buffer
+  const char* mEnd{nullptr};    ///< End of the buffer
+  uint32_t    mLine{0u};        ///< Line of the cursor, counting from 1
+  uint32_t    mErrorLine{0u};   ///< Line of the last parse error
+  std::string mError;           ///< Description of the last parse error
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_OBJ_READER_H
@@ -0,0 +1,54 @@
+#ifndef DALI_DEMO_PROCESS_MEMORY_H
+#define DALI_DEMO_PROCESS_MEMORY_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace DemoHelper
+{
+/**
+ * @brief Reads a memory field of a /proc file of the process.
+ *
+ * ie. "VmHWM:" of /proc/self/status for the peak resident set size, or "Pss:" of
+ * /proc/self/smaps_rollup for the proportional set size.
+ *
+ * @param[in] field The name of the field, including the colon
+ * @param[in] path The file to read the field from
+ * @return Value in kilobytes, 0 if not available on the platform
+ */
+inline unsigned long GetProcessMemoryKb(const char* field, const char* path = "/proc/self/status")
+{
+  std::ifstream file(path);
+  std::string   line;
+  while(std::getline(file, line))
+  {
+    if(line.compare(0, strlen(field), field) == 0)
+    {
+      return strtoul(line.c_str() + strlen(field), nullptr, 10);
+    }
+  }
+  return 0;
+}
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_PROCESS_MEMORY_H
@@ -0,0 +1,375 @@
+#ifndef DALI_DEMO_STATIC_BATCHER_H
+#define DALI_DEMO_STATIC_BATCHER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/dali.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+namespace DemoHelper
+{
+/**
+ * @brief The StaticBatcher class
+ * Merges static actors rendering the textured quad of CreateTexturedQuad() with a shared shader
+ * into a few large renderers, one or more per texture set.
+ *
+ * The quads of all members are transformed to the space of the batch root on the CPU and stored
+ * in the vertex buffers of the batches, so every batch is a single draw call. The renderers of the
+ * members are removed while they are batched. The batch root ( and its parents ) can move freely,
+ * moving a member requires its batch to be rebuilt: Update() compares the transforms of all
+ * members with the ones baked into the batches and rebuilds only the batches with a changed member.
+ *
+ * The batch shader gets the batch root space position ( aPosition, vec3 ) and the texture
+ * coordinate ( aTexCoord, vec2 ) of every vertex, uSize is not applied. The texture coordinates of
+ * members with a uAtlasRect property ( x, y, width, height ) are mapped into that rectangle, like
+ * the texture coordinates of a quad showing an image of a texture atlas.
+ */
+class StaticBatcher
+{
+public:
+  /**
+   * Creates an instance of StaticBatcher
+   * @param[in] root The batch root, the batch actors are added to it and the members have to be its descendants
+   * @param[in] geometry The quad geometry shared by the members, only actors rendering it are batched
+   * @param[in] batchShader The shader of the batch renderers
+   * @param[in] maxQuadsPerBatch Maximum number of quads in a single batch, smaller batches rebuild faster
+   */
+  StaticBatcher(Dali::Actor root, Dali::Geometry geometry, Dali::Shader batchShader, uint32_t maxQuadsPerBatch = 4096u)
+  : mRoot(root),
+    mGeometry(geometry),
+    mShader(batchShader),
+    mMaxQuadsPerBatch(std::min(maxQuadsPerBatch, MAX_QUADS_PER_BATCH))
+  {
+  }
+
+  /**
+   * Destroys an instance of StaticBatcher, the batches stay on the scene until Clear() is called
+   */
+  ~StaticBatcher() = default;
+
+  /**
+   * Adds every descendant of the actor rendering the shared geometry with a single renderer
+   * @param[in] subtree The root of the subtree, it is added as well if it matches
+   * @return The number of actors added
+   */
+  uint32_t AddSubtree(Dali::Actor subtree)
+  {
+    uint32_t added = 0u;
+    if(subtree.GetRendererCount() == 1u && subtree.GetRendererAt(0u).GetGeometry() == mGeometry)
+    {
+      AddMember(subtree, subtree.GetRendererAt(0u));
+      ++added;
+    }
+    for(uint32_t i = 0; i < subtree.GetChildCount(); ++i)
+    {
+      Dali::Actor child = subtree.GetChildAt(i);
+      if(std::find(mBatchActors.begin(), mBatchActors.end(), child) == mBatchActors.end())
+      {
+        added += AddSubtree(child);
+      }
+    }
+
+    Rebuild();
+    return added;
+  }
+
+  /**
+   * Marks the batch of the member for rebuild, e.g. when one of its parents below the batch root moved
+   */
+  void MarkDirty(Dali::Actor member)
+  {
+    for(Member& candidate : mMembers)
+    {
+      if(candidate.actor == member)
+      {
+        mBatches[candidate.batch].dirty = true;
+        return;
+      }
+    }
+  }
+
+  /**
+   * Rebuilds the batches with moved, resized or hidden members and the ones marked dirty
+   * @return The number of rebuilt batches
+   */
+  uint32_t Update()
+  {
+    for(Member& member : mMembers)
+    {
+      if(!mBatches[member.batch].dirty && member.transform != ReadTransform(member.actor))
+      {
+        mBatches[member.batch].dirty = true;
+      }
+    }
+    return Rebuild();
+  }
+
+  /**
+   * Gives the members their renderers back and removes all batches
+   */
+  void Clear()
+  {
+    for(Member& member : mMembers)
+    {
+      if(member.actor)
+      {
+        member.actor.AddRenderer(member.renderer);
+      }
+    }
+    for(Dali::Actor& batchActor : mBatchActors)
+    {
+      batchActor.Unparent();
+    }
+    mMembers.clear();
+    mBatches.clear();
+    mBatchActors.clear();
+  }
+
+  /**
+   * Returns the number of batches, the number of draw calls of all members
+   */
+  uint32_t GetBatchCount() const
+  {
+    return static_cast<uint32_t>(mBatches.size());
+  }
+
+  /**
+   * Returns the number of batched actors
+   */
+  uint32_t GetMemberCount() const
+  {
+    return static_cast<uint32_t>(mMembers.size());
+  }
+
+private:
+  static constexpr uint32_t MAX_QUADS_PER_BATCH = 16384u; ///< Keeps the vertex indices within 16 bits
+
+  /**
+   * Local transform properties of a member, compared to detect changes
+   */
+  struct Transform
+  {
+    Dali::Vector3    position;
+    Dali::Vector3    size;
+    Dali::Vector3    scale;
+    Dali::Quaternion orientation;
+    bool             visible{true};
+
+    bool operator!=(const Transform& rhs) const
+    {
+      return position != rhs.position || size != rhs.size || scale != rhs.scale || orientation != rhs.orientation || visible != rhs.visible;
+    }
+  };
+
+  struct Member
+  {
+    Dali::Actor    actor;
+    Dali::Renderer renderer; ///< The renderer removed from the actor while it is batched
+    Transform      transform;
+    uint32_t       batch;
+    Dali::Vector4  textureRect; ///< Part of the texture shown by the member
+  };
+
+  struct Batch
+  {
+    Dali::TextureSet      textureSet;
+    Dali::VertexBuffer    vertexBuffer;
+    std::vector<uint32_t> members;
+    bool                  dirty{true};
+  };
+
+  struct Vertex
+  {
+    Dali::Vector3 aPosition;
+    Dali::Vector2 aTexCoord;
+  };
+
+  static Transform ReadTransform(Dali::Actor actor)
+  {
+    Transform transform;
+    transform.position    = actor.GetProperty<Dali::Vector3>(Dali::Actor::Property::POSITION);
+    transform.size        = actor.GetProperty<Dali::Vector3>(Dali::Actor::Property::SIZE);
+    transform.scale       = actor.GetProperty<Dali::Vector3>(Dali::Actor::Property::SCALE);
+    transform.orientation = actor.GetProperty<Dali::Quaternion>(Dali::Actor::Property::ORIENTATION);
+    transform.visible     = actor.GetProperty<bool>(Dali::Actor::Property::VISIBLE);
+    return transform;
+  }
+
+  void AddMember(Dali::Actor actor, Dali::Renderer renderer)
+  {
+    // A new batch is started when all batches of the texture set are full
+    Dali::TextureSet textureSet = renderer.GetTextures();
+    uint32_t         batchIndex = static_cast<uint32_t>(mBatches.size());
+    for(uint32_t i = 0; i < mBatches.size(); ++i)
+    {
+      if(mBatches[i].textureSet == textureSet && mBatches[i].members.size() < mMaxQuadsPerBatch)
+      {
+        batchIndex = i;
+        break;
+      }
+    }
+
+    if(batchIndex == mBatches.size())
+    {
+      Batch batch;
+      batch.textureSet   = textureSet;
+      batch.vertexBuffer = Dali::VertexBuffer::New(Dali::Property::Map()
+                                                     .Add("aPosition", Dali::Property::VECTOR3)
+                                                     .Add("aTexCoord", Dali::Property::VECTOR2));
+      mBatches.push_back(batch);
+      mBatchActors.push_back(CreateBatchActor(mBatches.back(), renderer));
+    }
+
+    mBatches[batchIndex].members.push_back(static_cast<uint32_t>(mMembers.size()));
+    mBatches[batchIndex].dirty = true;
+    const Dali::Property::Index textureRectIndex = actor.GetPropertyIndex("uAtlasRect");
+    const Dali::Vector4         textureRect      = textureRectIndex != Dali::Property::INVALID_INDEX ? actor.GetProperty<Dali::Vector4>(textureRectIndex) : Dali::Vector4(0.0f, 0.0f, 1.0f, 1.0f);
+    mMembers.push_back(Member{actor, renderer, ReadTransform(actor), batchIndex, textureRect});
+    actor.RemoveRenderer(renderer);
+  }
+
+  Dali::Actor CreateBatchActor(Batch& batch, Dali::Renderer source)
+  {
+    Dali::Geometry geometry = Dali::Geometry::New();
+    geometry.AddVertexBuffer(batch.vertexBuffer);
+
+    std::vector<uint16_t> indices(mMaxQuadsPerBatch * 6u);
+    for(uint32_t quad = 0; quad < mMaxQuadsPerBatch; ++quad)
+    {
+      const uint16_t first      = static_cast<uint16_t>(quad * 4u);
+      const uint16_t corners[6] = {first, static_cast<uint16_t>(first + 1u), static_cast<uint16_t>(first + 2u), static_cast<uint16_t>(first + 2u), static_cast<uint16_t>(first + 1u), static_cast<uint16_t>(first + 3u)};
+      std::copy(corners, corners + 6, &indices[quad * 6u]);
+    }
+    geometry.SetIndexBuffer(indices.data(), static_cast<uint32_t>(indices.size()));
+    geometry.SetType(Dali::Geometry::TRIANGLES);
+
+    Dali::Renderer renderer = Dali::Renderer::New(geometry, mShader);
+    renderer.SetTextures(batch.textureSet);
+    renderer.SetProperty(Dali::Renderer::Property::BLEND_MODE, source.GetProperty<int>(Dali::Renderer::Property::BLEND_MODE));
+
+    Dali::Actor actor = Dali::Actor::New();
+    actor.SetProperty(Dali::Actor::Property::PARENT_ORIGIN, Dali::ParentOrigin::CENTER);
+    actor.SetProperty(Dali::Actor::Property::PIVOT, Dali::Pivot::CENTER);
+    actor.AddRenderer(renderer);
+    mRoot.Add(actor);
+    return actor;
+  }
+
+  /**
+   * Transforms a point from the local space of the actor to the space of the batch root,
+   * positions are relative to the centers of the actors
+   */
+  Dali::Vector3 TransformToRoot(Dali::Actor actor, Dali::Vector3 point) const
+  {
+    while(actor && actor != mRoot)
+    {
+      Dali::Actor parent = actor.GetParent();
+
+      const Dali::Vector3    size         = actor.GetProperty<Dali::Vector3>(Dali::Actor::Property::SIZE);
+      const Dali::Vector3    pivot        = actor.GetProperty<Dali::Vector3>(Dali::Actor::Property::PIVOT);
+      const Dali::Vector3    parentOrigin = actor.GetProperty<Dali::Vector3>(Dali::Actor::Property::PARENT_ORIGIN);
+      const Dali::Vector3    parentSize   = parent ? parent.GetProperty<Dali::Vector3>(Dali::Actor::Property::SIZE) : Dali::Vector3::ZERO;
+      const Dali::Vector3    scale        = actor.GetProperty<Dali::Vector3>(Dali::Actor::Property::SCALE);
+      const Dali::Quaternion orientation  = actor.GetProperty<Dali::Quaternion>(Dali::Actor::Property::ORIENTATION);
+
+      // Same as the actor world transform: the pivot is offset in the scaled and rotated space
+      point = orientation * ((point + (Dali::Pivot::CENTER - pivot) * size) * scale);
+      point += actor.GetProperty<Dali::Vector3>(Dali::Actor::Property::POSITION) + (parentOrigin - Dali::ParentOrigin::CENTER) * parentSize;
+      actor = parent;
+    }
+    return point;
+  }
+
+  /**
+   * Rebuilds the vertex buffers of the dirty batches
+   * @return The number of rebuilt batches
+   */
+  uint32_t Rebuild()
+  {
+    static const Dali::Vector3 CORNERS[4] = {Dali::Vector3(-0.5f, -0.5f, 0.0f), Dali::Vector3(0.5f, -0.5f, 0.0f), Dali::Vector3(-0.5f, 0.5f, 0.0f), Dali::Vector3(0.5f, 0.5f, 0.0f)};
+
+    uint32_t rebuilt = 0u;
+    for(uint32_t batchIndex = 0; batchIndex < mBatches.size(); ++batchIndex)
+    {
+      Batch& batch = mBatches[batchIndex];
+      if(!batch.dirty)
+      {
+        continue;
+      }
+
+      std::vector<Vertex> vertices(batch.members.size() * 4u);
+      Dali::Vector3       minimum(FLT_MAX, FLT_MAX, FLT_MAX);
+      Dali::Vector3       maximum(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+      for(uint32_t i = 0; i < batch.members.size(); ++i)
+      {
+        Member& member   = mMembers[batch.members[i]];
+        member.transform = ReadTransform(member.actor);
+        for(uint32_t corner = 0; corner < 4u; ++corner)
+        {
+          Vertex& vertex   = vertices[i * 4u + corner];
+          vertex.aTexCoord = Dali::Vector2(member.textureRect.x + (CORNERS[corner].x + 0.5f) * member.textureRect.z,
+                                           member.textureRect.y + (CORNERS[corner].y + 0.5f) * member.textureRect.w);
+
+          // Hidden members keep their place in the buffer as a degenerate quad
+          if(member.transform.visible)
+          {
+            vertex.aPosition = TransformToRoot(member.actor, CORNERS[corner] * member.transform.size);
+            minimum          = Dali::Vector3(std::min(minimum.x, vertex.aPosition.x), std::min(minimum.y, vertex.aPosition.y), std::min(minimum.z, vertex.aPosition.z));
+            maximum          = Dali::Vector3(std::max(maximum.x, vertex.aPosition.x), std::max(maximum.y, vertex.aPosition.y), std::max(maximum.z, vertex.aPosition.z));
+          }
+        }
+      }
+
+      // The batch actor covers the bounds of its quads, so it is culled like the members would be
+      if(minimum.x > maximum.x)
+      {
+        minimum = maximum = Dali::Vector3::ZERO;
+      }
+      const Dali::Vector3 center = (minimum + maximum) * 0.5f;
+      for(Vertex& vertex : vertices)
+      {
+        vertex.aPosition -= center;
+      }
+      mBatchActors[batchIndex].SetProperty(Dali::Actor::Property::POSITION, center);
+      mBatchActors[batchIndex].SetProperty(Dali::Actor::Property::SIZE, maximum - minimum);
+
+      batch.vertexBuffer.SetData(vertices.data(), static_cast<uint32_t>(vertices.size()));
+      mBatchActors[batchIndex].GetRendererAt(0u).SetProperty(Dali::Renderer::Property::INDEX_RANGE_COUNT, static_cast<int>(batch.members.size() * 6u));
+      batch.dirty = false;
+      ++rebuilt;
+    }
+    return rebuilt;
+  }
+
+private:
+  Dali::Actor              mRoot;
+  Dali::Geometry           mGeometry;
+  Dali::Shader             mShader;
+  uint32_t                 mMaxQuadsPerBatch;
+  std::vector<Member>      mMembers;
+  std::vector<Batch>       mBatches;
+  std::vector<Dali::Actor> mBatchActors; ///< Actors of the batch renderers, in the order of mBatches
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_STATIC_BATCHER_H
@@ -19,11 +19,26 @@
  */
 
 #include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/integration-api/debug.h>
 #include <dali/public-api/math/int-pair.h>
 #include <dali/public-api/rendering/geometry.h>
 #include <dali/public-api/rendering/texture.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace DemoHelper
 {
 Dali::Texture LoadTexture(const char*              imagePath,
@@ -43,6 +58,185 @@ Dali::Texture LoadTexture(const char*              imagePath,
   return texture;
 }
 
+/**
+ * @brief Loads textures without blocking the event thread
+ *
+ * The images are decoded and converted by a pool of worker threads, the textures are created and
+ * uploaded on the event thread, then handed to the completion callbacks. Requests with the same
+ * path, size, sampling mode and orientation correction share a single decode and texture, so the
+ * loader works as a texture cache for as long as it exists.
+ *
+ * It has to be created and used on the event thread, after the application is initialised.
+ */
+class AsyncTextureLoader
+{
+public:
+  using Callback = std::function<void(Dali::Texture)>; ///< Receives the texture, an empty handle if the image failed to load
+
+  /**
+   * Creates an instance of AsyncTextureLoader and starts the workers
+   * @param[in] threadCount Number of decoding threads, the number of hardware threads by default
+   */
+  explicit AsyncTextureLoader(uint32_t threadCount = 0u)
+  : mEventCallback(new Dali::EventThreadCallback(Dali::MakeCallback(this, &AsyncTextureLoader::OnDecoded)))
+  {
+    threadCount = std::max(1u, threadCount ? threadCount : std::thread::hardware_concurrency());
+    for(uint32_t i = 0; i < threadCount; ++i)
+    {
+      mThreads.emplace_back(&AsyncTextureLoader::DecodeLoop, this);
+    }
+  }
+
+  /**
+   * Stops the workers, the callbacks of the pending requests are not called
+   */
+  ~AsyncTextureLoader()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mStop = true;
+    }
+    mCondition.notify_all();
+    for(std::thread& thread : mThreads)
+    {
+      thread.join();
+    }
+  }
+
+  /**
+   * Requests a texture, the parameters match DemoHelper::LoadTexture()
+   * @param[in] callback Called on the event thread with the texture, immediately if the texture is cached
+   */
+  void LoadTexture(const std::string&       imagePath,
+                   Callback                 callback,
+                   Dali::ImageDimensions    size                  = Dali::ImageDimensions(),
+                   Dali::SamplingMode::Type samplingMode          = Dali::SamplingMode::DEFAULT,
+                   bool                     orientationCorrection = true)
+  {
+    const std::string key = imagePath + '|' + std::to_string(size.GetWidth()) + 'x' + std::to_string(size.GetHeight()) + '|' + std::to_string(samplingMode) + '|' + (orientationCorrection ? '1' : '0');
+
+    auto iter = mCache.find(key);
+    if(iter != mCache.end())
+    {
+      if(iter->second->loaded)
+      {
+        callback(iter->second->texture);
+      }
+      else
+      {
+        iter->second->callbacks.push_back(std::move(callback));
+      }
+      return;
+    }
+
+    std::shared_ptr<Entry> entry(new Entry{imagePath, size, samplingMode, orientationCorrection});
+    entry->callbacks.push_back(std::move(callback));
+    mCache[key] = entry;
+    ++mPendingCount;
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mQueue.push_back(entry);
+    }
+    mCondition.notify_one();
+  }
+
+  /**
+   * Returns the number of textures still being decoded
+   */
+  uint32_t GetPendingCount() const
+  {
+    return mPendingCount;
+  }
+
+  /**
+   * Returns the number of distinct images requested, every one of them is decoded once
+   */
+  uint32_t GetDecodeCount() const
+  {
+    return static_cast<uint32_t>(mCache.size());
+  }
+
+private:
+  struct Entry
+  {
+    std::string              imagePath;
+    Dali::ImageDimensions    size;
+    Dali::SamplingMode::Type samplingMode;
+    bool                     orientationCorrection;
+    Dali::PixelData          pixelData;     ///< Decoded by a worker, released after the upload
+    Dali::Texture            texture;       ///< Created on the event thread
+    bool                     loaded{false}; ///< Whether the callbacks have been called
+    std::vector<Callback>    callbacks;     ///< Callbacks of the requests waiting for the texture
+  };
+
+  void DecodeLoop()
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    while(true)
+    {
+      mCondition.wait(lock, [this]()
+      { return mStop || !mQueue.empty(); });
+      if(mStop)
+      {
+        return;
+      }
+
+      std::shared_ptr<Entry> entry = mQueue.front();
+      mQueue.pop_front();
+      lock.unlock();
+
+      Dali::Devel::PixelBuffer pixelBuffer = LoadImageFromFile(entry->imagePath, entry->size, entry->samplingMode, entry->orientationCorrection);
+      if(pixelBuffer)
+      {
+        entry->pixelData = Dali::Devel::PixelBuffer::Convert(pixelBuffer);
+      }
+
+      lock.lock();
+      mDecoded.push_back(entry);
+      mEventCallback->Trigger();
+    }
+  }
+
+  void OnDecoded()
+  {
+    std::vector<std::shared_ptr<Entry>> decoded;
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      decoded.swap(mDecoded);
+    }
+
+    for(std::shared_ptr<Entry>& entry : decoded)
+    {
+      if(entry->pixelData)
+      {
+        entry->texture = Dali::Texture::New(Dali::TextureType::TEXTURE_2D, entry->pixelData.GetPixelFormat(), entry->pixelData.GetWidth(), entry->pixelData.GetHeight());
+        entry->texture.Upload(entry->pixelData);
+        entry->pixelData.Reset();
+      }
+      entry->loaded = true;
+      --mPendingCount;
+
+      std::vector<Callback> callbacks;
+      callbacks.swap(entry->callbacks);
+      for(Callback& callback : callbacks)
+      {
+        callback(entry->texture);
+      }
+    }
+  }
+
+  std::map<std::string, std::shared_ptr<Entry>> mCache;            ///< Every requested image, by path, size, sampling mode and orientation correction
+  uint32_t                                      mPendingCount{0u}; ///< Number of entries not loaded yet
+
+  std::mutex                                 mMutex;         ///< Guards the queues and mStop
+  std::condition_variable                    mCondition;     ///< Wakes the workers up
+  std::deque<std::shared_ptr<Entry>>         mQueue;         ///< Entries waiting for a worker
+  std::vector<std::shared_ptr<Entry>>        mDecoded;       ///< Entries waiting for the upload
+  bool                                       mStop{false};   ///< Stops the workers
+  std::vector<std::thread>                   mThreads;       ///< The decoding workers
+  std::unique_ptr<Dali::EventThreadCallback> mEventCallback; ///< Runs OnDecoded() on the event thread
+};
+
 Dali::Texture LoadWindowFillingTexture(Dali::Uint16Pair size, const char* imagePath)
 {
   return LoadTexture(imagePath, size, Dali::SamplingMode::BOX_THEN_LINEAR);
@@ -77,6 +271,285 @@ Dali::Geometry CreateTexturedQuad()
 
   return geometry;
 }
+/**
+ * @brief Image packed into a page of a texture atlas
+ */
+struct AtlasRegion
+{
+  static constexpr uint32_t INVALID_PAGE = 0xFFFFFFFFu; ///< Page of the images which could not be loaded
+
+  uint32_t      page;        ///< Index of the atlas page holding the image, INVALID_PAGE if it is not in the atlas
+  Dali::Vector4 textureRect; ///< Texture coordinates of the image in the page ( x, y, width, height )
+};
+
+/**
+ * @brief Images packed into a few large textures
+ */
+struct TextureAtlas
+{
+  std::vector<Dali::Texture> pages;        ///< RGBA8888 atlas textures
+  std::vector<AtlasRegion>   regions;      ///< Regions of the images, in the order of the image paths
+  size_t                     imageBytes{}; ///< Size of the decoded images, as they would be uploaded one by one
+  size_t                     pageBytes{};  ///< Size of the uploaded atlas pages
+};
+
+/**
+ * @brief Packs rectangles into a page, every rectangle is placed on the lowest fitting part of the skyline
+ */
+class SkylinePacker
+{
+public:
+  SkylinePacker(uint32_t width, uint32_t height)
+  : mWidth(width),
+    mHeight(height),
+    mSkyline{{0u, 0u, width}}
+  {
+  }
+
+  /**
+   * Finds a place for a rectangle and raises the skyline over it
+   * @return false if the rectangle does not fit in the page
+   */
+  bool Pack(uint32_t width, uint32_t height, uint32_t& x, uint32_t& y)
+  {
+    size_t   bestIndex = mSkyline.size();
+    uint32_t bestTop   = mHeight;
+    uint32_t bestWidth = mWidth;
+    for(size_t i = 0; i < mSkyline.size(); ++i)
+    {
+      uint32_t top = 0u;
+      if(Fits(i, width, height, top) && (top < bestTop || (top == bestTop && mSkyline[i].width < bestWidth)))
+      {
+        bestIndex = i;
+        bestTop   = top;
+        bestWidth = mSkyline[i].width;
+      }
+    }
+    if(bestIndex == mSkyline.size())
+    {
+      return false;
+    }
+
+    x = mSkyline[bestIndex].x;
+    y = bestTop;
+
+    // The new segment replaces the parts of the skyline under the rectangle
+    const uint32_t right = x + width;
+    mSkyline.insert(mSkyline.begin() + bestIndex, Segment{x, y + height, width});
+    for(size_t i = bestIndex + 1; i < mSkyline.size() && mSkyline[i].x < right;)
+    {
+      Segment& segment = mSkyline[i];
+      if(segment.x + segment.width <= right)
+      {
+        mSkyline.erase(mSkyline.begin() + i);
+      }
+      else
+      {
+        segment.width -= right - segment.x;
+        segment.x = right;
+        break;
+      }
+    }
+
+    for(size_t i = 1; i < mSkyline.size();)
+    {
+      if(mSkyline[i - 1].y == mSkyline[i].y)
+      {
+        mSkyline[i - 1].width += mSkyline[i].width;
+        mSkyline.erase(mSkyline.begin() + i);
+      }
+      else
+      {
+        ++i;
+      }
+    }
+    return true;
+  }
+
+private:
+  struct Segment
+  {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+  };
+
+  bool Fits(size_t index, uint32_t width, uint32_t height, uint32_t& top) const
+  {
+    if(mSkyline[index].x + width > mWidth)
+    {
+      return false;
+    }
+
+    uint32_t remaining = width;
+    for(size_t i = index; remaining > 0u && i < mSkyline.size(); ++i)
+    {
+      top = std::max(top, mSkyline[i].y);
+      if(top + height > mHeight)
+      {
+        return false;
+      }
+      remaining -= std::min(remaining, mSkyline[i].width);
+    }
+    return true;
+  }
+
+  uint32_t             mWidth;
+  uint32_t             mHeight;
+  std::vector<Segment> mSkyline; ///< Top edge of the packed rectangles, from left to right
+};
+
+/**
+ * @brief Decodes the images on worker threads and packs them into RGBA8888 atlas pages
+ *
+ * The images are surrounded by a gutter repeating their edge pixels, so linear filtering does not
+ * bleed the neighbouring images in. Images larger than a page get a page of their own size.
+ * Images which fail to decode or have an unsupported format are logged and left out of the atlas,
+ * their regions have the INVALID_PAGE page and an empty rectangle.
+ *
+ * @param[in] imagePaths The images to load, RGB888, RGBA8888, L8 and LA88 images are supported
+ * @param[in] imageSize The desired size of the images, they are loaded in their own size by default
+ * @param[in] pageSize Width and height of the atlas pages
+ * @param[in] threadCount Number of decoding threads, the number of hardware threads by default
+ * @return The atlas pages and the regions of the images
+ */
+TextureAtlas LoadTextureAtlas(const std::vector<std::string>& imagePaths,
+                              Dali::ImageDimensions           imageSize   = Dali::ImageDimensions(),
+                              uint32_t                        pageSize    = 2048u,
+                              uint32_t                        threadCount = 0u)
+{
+  const uint32_t GUTTER = 1u;
+
+  // Decode in parallel, the textures are created and uploaded on the event thread afterwards
+  std::vector<Dali::Devel::PixelBuffer> images(imagePaths.size());
+  std::atomic<size_t>                   nextImage(0u);
+  std::vector<std::thread>              threads;
+  threadCount = std::max(1u, threadCount ? threadCount : std::thread::hardware_concurrency());
+  for(uint32_t i = 0; i < std::min<size_t>(threadCount, imagePaths.size()); ++i)
+  {
+    threads.emplace_back([&]()
+    {
+      for(size_t index = nextImage++; index < imagePaths.size(); index = nextImage++)
+      {
+        images[index] = Dali::LoadImageFromFile(imagePaths[index], imageSize);
+      }
+    });
+  }
+  for(std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  TextureAtlas atlas;
+  atlas.regions.resize(images.size(), AtlasRegion{AtlasRegion::INVALID_PAGE, Dali::Vector4::ZERO});
+
+  // Only the decoded images in a supported format are packed
+  std::vector<size_t> order;
+  for(size_t i = 0; i < images.size(); ++i)
+  {
+    const Dali::Devel::PixelBuffer& image = images[i];
+    if(!image || !image.GetWidth() || !image.GetHeight())
+    {
+      DALI_LOG_ERROR("Atlas: failed to load %s, skipped\n", imagePaths[i].c_str());
+      continue;
+    }
+    const Dali::Pixel::Format format = image.GetPixelFormat();
+    if(format != Dali::Pixel::RGB888 && format != Dali::Pixel::RGBA8888 && format != Dali::Pixel::L8 && format != Dali::Pixel::LA88)
+    {
+      DALI_LOG_ERROR("Atlas: unsupported pixel format %d of %s, skipped\n", static_cast<int>(format), imagePaths[i].c_str());
+      continue;
+    }
+    order.push_back(i);
+  }
+
+  // Taller images first, so every skyline row is filled with images of similar height
+  std::stable_sort(order.begin(), order.end(), [&images](size_t lhs, size_t rhs)
+  { return images[lhs].GetHeight() > images[rhs].GetHeight(); });
+
+  struct Placement
+  {
+    uint32_t page;
+    uint32_t x;
+    uint32_t y;
+  };
+  std::vector<Placement>     placements(images.size());
+  std::vector<SkylinePacker> packers;
+  std::vector<uint32_t>      pageSizes;
+  for(size_t index : order)
+  {
+    const uint32_t width  = images[index].GetWidth() + GUTTER * 2u;
+    const uint32_t height = images[index].GetHeight() + GUTTER * 2u;
+
+    Placement& placement = placements[index];
+    for(placement.page = 0u; placement.page < packers.size(); ++placement.page)
+    {
+      if(packers[placement.page].Pack(width, height, placement.x, placement.y))
+      {
+        break;
+      }
+    }
+    if(placement.page == packers.size())
+    {
+      pageSizes.push_back(std::max(pageSize, std::max(width, height)));
+      packers.emplace_back(pageSizes.back(), pageSizes.back());
+      packers.back().Pack(width, height, placement.x, placement.y);
+    }
+  }
+
+  std::vector<std::unique_ptr<uint8_t[]>> pages;
+  for(uint32_t size : pageSizes)
+  {
+    pages.emplace_back(new uint8_t[size * size * 4u]());
+  }
+
+  for(size_t index : order)
+  {
+    const Dali::Devel::PixelBuffer& image     = images[index];
+    const Placement&                placement = placements[index];
+    const Dali::Pixel::Format       format    = image.GetPixelFormat();
+    const uint32_t                  width     = image.GetWidth();
+    const uint32_t                  height    = image.GetHeight();
+    const uint32_t                  bpp       = Dali::Pixel::GetBytesPerPixel(format);
+    const uint32_t                  stride    = (image.GetStride() ? image.GetStride() : width) * bpp;
+    const uint8_t*                  source    = image.GetBuffer();
+    const uint32_t                  page      = pageSizes[placement.page];
+
+    // Every pixel of the gutter repeats the closest edge pixel of the image
+    for(uint32_t row = 0; row < height + GUTTER * 2u; ++row)
+    {
+      const uint8_t* sourceRow = source + std::min(height - 1u, row > GUTTER ? row - GUTTER : 0u) * stride;
+      uint8_t*       target    = pages[placement.page].get() + ((placement.y + row) * page + placement.x) * 4u;
+      for(uint32_t column = 0; column < width + GUTTER * 2u; ++column, target += 4u)
+      {
+        const uint8_t* pixel = sourceRow + std::min(width - 1u, column > GUTTER ? column - GUTTER : 0u) * bpp;
+        const bool     gray  = bpp < 3u;
+        target[0]            = pixel[0];
+        target[1]            = gray ? pixel[0] : pixel[1];
+        target[2]            = gray ? pixel[0] : pixel[2];
+        target[3]            = bpp == 4u ? pixel[3] : (bpp == 2u ? pixel[1] : 0xFF);
+      }
+    }
+
+    atlas.regions[index].page        = placement.page;
+    atlas.regions[index].textureRect = Dali::Vector4(static_cast<float>(placement.x + GUTTER) / page,
+                                                     static_cast<float>(placement.y + GUTTER) / page,
+                                                     static_cast<float>(width) / page,
+                                                     static_cast<float>(height) / page);
+    atlas.imageBytes += static_cast<size_t>(width) * height * bpp;
+  }
+
+  for(size_t i = 0; i < pages.size(); ++i)
+  {
+    const uint32_t  size      = pageSizes[i];
+    Dali::PixelData pixelData = Dali::PixelData::New(pages[i].release(), size * size * 4u, size, size, Dali::Pixel::RGBA8888, Dali::PixelData::DELETE_ARRAY);
+    Dali::Texture   texture   = Dali::Texture::New(Dali::TextureType::TEXTURE_2D, Dali::Pixel::RGBA8888, size, size);
+    texture.Upload(pixelData);
+    atlas.pages.push_back(texture);
+    atlas.pageBytes += static_cast<size_t>(size) * size * 4u;
+  }
+
+  return atlas;
+}
 } // namespace DemoHelper
 
 #endif // DALI_DEMO_UTILITY_H
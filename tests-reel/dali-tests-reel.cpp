@@ -47,6 +47,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   demo.AddExample(Example("image-view-yuv.example", DALI_DEMO_STR_TITLE_IMAGE_VIEW_YUV));
   demo.AddExample(Example("inherit-test.example", DALI_DEMO_STR_TITLE_INHERIT_TEST));
   demo.AddExample(Example("instance-rendering.example", DALI_DEMO_STR_TITLE_INSTANCE_RENDERING));
+  demo.AddExample(Example("obj-reader-test.example", DALI_DEMO_STR_TITLE_OBJ_READER_TEST));
   demo.AddExample(Example("pre-render-callback.example", DALI_DEMO_STR_TITLE_PRE_RENDER_CALLBACK));
   demo.AddExample(Example("precompile-shader.example", DALI_DEMO_STR_TITLE_PRECOMPILE_SHADER));
   demo.AddExample(Example("perf-scroll.example", DALI_DEMO_STR_TITLE_PERF_SCROLL));
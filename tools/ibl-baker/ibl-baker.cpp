@@ -0,0 +1,1148 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * ibl-baker precomputes the image based lighting maps used by the rendering-basic-pbr example
+ * from an environment map, on the CPU.
+ *
+ * Usage:
+ *   ibl-baker [options] <environment.hdr>
+ *   ibl-baker [options] <environment.ktx>
+ *   ibl-baker [options] <+x.hdr> <-x.hdr> <+y.hdr> <-y.hdr> <+z.hdr> <-z.hdr>
+ *
+ *   --irradiance <out.ktx>     writes the diffuse irradiance cube map
+ *   --specular <out.ktx>       writes the GGX prefiltered specular cube map and its mipmaps
+ *   --brdf <out.ktx>           writes the split sum BRDF lookup table ( scale in red, bias in green )
+ *   --irradiance-size <n>      face size of the irradiance map ( default 128 )
+ *   --specular-size <n>        face size of the largest specular mipmap ( default 256 )
+ *   --specular-levels <n>      number of specular mipmaps ( default down to 4x4 )
+ *   --brdf-size <n>            size of the BRDF lookup table ( default 128 )
+ *   --samples <n>              GGX samples per texel ( default 512 )
+ *   --threads <n>              number of worker threads ( default every hardware thread )
+ *
+ * The input is a Radiance RGBE equirectangular image ( +y up, -z in the center ), six Radiance
+ * images holding the faces, or a RGB16F / RGB32F ktx cube map, whose largest mipmap is used.
+ * Every output is a RGB16F ktx file, the format of the maps shipped with the example.
+ *
+ * The irradiance is projected to 3rd order spherical harmonics and stored divided by pi, so it
+ * is the radiance reflected by a white lambertian surface. The specular mipmap of a level holds
+ * the environment prefiltered for the roughness that pbr_shader.fsh selects that level for.
+ *
+ * The results only depend on the input and the options, not on the number of threads, so the
+ * maps can be regenerated by the build. The tool has no DALi dependencies.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define IBL_BAKER_SSE
+#endif
+
+namespace
+{
+const float PI(3.14159265358979f);
+
+const uint32_t DEFAULT_IRRADIANCE_SIZE(128u);
+const uint32_t DEFAULT_SPECULAR_SIZE(256u);
+const uint32_t DEFAULT_BRDF_SIZE(128u);
+const uint32_t DEFAULT_SAMPLES(512u);
+const uint32_t MAX_SOURCE_SIZE(1024u);     ///< Largest face of the cube map an equirectangular image is resampled to
+const uint32_t SH_SOURCE_SIZE(64u);        ///< Largest face of the source mipmap projected to spherical harmonics
+const uint32_t SMALLEST_SPECULAR_SIZE(4u); ///< The example's shader expects the 2x2 and 1x1 mipmaps to be missing
+
+// The constants of pbr_shader.fsh used to select the specular mipmap by roughness
+const float REFLECTION_CAPTURE_ROUGHEST_MIP(1.0f);
+const float REFLECTION_CAPTURE_ROUGHNESS_MIP_SCALE(1.2f);
+
+// The format of the shipped maps
+const uint32_t GL_HALF_FLOAT(0x140B);
+const uint32_t GL_RGB(0x1907);
+const uint32_t GL_RGB16F(0x881B);
+const uint32_t GL_RGB32F(0x8815);
+
+const uint8_t KTX_IDENTIFIER[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+/**
+ * RGB color and weight, 4 floats processed at once where SSE is available
+ */
+struct alignas(16) Vec4
+{
+  float x, y, z, w;
+
+  Vec4()
+  : x(0.0f),
+    y(0.0f),
+    z(0.0f),
+    w(0.0f)
+  {
+  }
+
+  Vec4(float red, float green, float blue, float weight)
+  : x(red),
+    y(green),
+    z(blue),
+    w(weight)
+  {
+  }
+
+  Vec4& operator+=(const Vec4& rhs)
+  {
+#ifdef IBL_BAKER_SSE
+    _mm_store_ps(&x, _mm_add_ps(_mm_load_ps(&x), _mm_load_ps(&rhs.x)));
+#else
+    x += rhs.x;
+    y += rhs.y;
+    z += rhs.z;
+    w += rhs.w;
+#endif
+    return *this;
+  }
+
+  /**
+   * Adds rhs * scale
+   */
+  void MultiplyAdd(const Vec4& rhs, float scale)
+  {
+#ifdef IBL_BAKER_SSE
+    _mm_store_ps(&x, _mm_add_ps(_mm_load_ps(&x), _mm_mul_ps(_mm_load_ps(&rhs.x), _mm_set1_ps(scale))));
+#else
+    x += rhs.x * scale;
+    y += rhs.y * scale;
+    z += rhs.z * scale;
+    w += rhs.w * scale;
+#endif
+  }
+
+  Vec4 operator*(float scale) const
+  {
+    Vec4 result;
+#ifdef IBL_BAKER_SSE
+    _mm_store_ps(&result.x, _mm_mul_ps(_mm_load_ps(&x), _mm_set1_ps(scale)));
+#else
+    result = Vec4(x * scale, y * scale, z * scale, w * scale);
+#endif
+    return result;
+  }
+};
+
+/**
+ * Direction
+ */
+struct Vec3
+{
+  float x, y, z;
+
+  Vec3 operator*(float scale) const
+  {
+    return Vec3{x * scale, y * scale, z * scale};
+  }
+
+  Vec3 operator+(const Vec3& rhs) const
+  {
+    return Vec3{x + rhs.x, y + rhs.y, z + rhs.z};
+  }
+};
+
+float Dot(const Vec3& a, const Vec3& b)
+{
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+Vec3 Cross(const Vec3& a, const Vec3& b)
+{
+  return Vec3{a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+Vec3 Normalize(const Vec3& v)
+{
+  return v * (1.0f / std::sqrt(Dot(v, v)));
+}
+
+/**
+ * RGB image, the color of every pixel is stored in a Vec4
+ */
+struct Image
+{
+  uint32_t          width{0u};
+  uint32_t          height{0u};
+  std::vector<Vec4> pixels;
+};
+
+/**
+ * Cube map with its mipmaps, faces are in the GL order: +X, -X, +Y, -Y, +Z, -Z
+ */
+struct CubeMap
+{
+  std::vector<Image> faces[6]; ///< Mipmaps of every face, the largest one first
+
+  uint32_t GetSize(uint32_t level = 0u) const
+  {
+    return faces[0][level].width;
+  }
+
+  uint32_t GetLevelCount() const
+  {
+    return static_cast<uint32_t>(faces[0].size());
+  }
+};
+
+/**
+ * Runs job(i) for every i in [0, count) on threadCount threads
+ */
+void ParallelFor(uint32_t count, uint32_t threadCount, const std::function<void(uint32_t)>& job)
+{
+  std::atomic<uint32_t> next{0u};
+  auto                  worker = [&]()
+  {
+    for(uint32_t i = next++; i < count; i = next++)
+    {
+      job(i);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(uint32_t i = 1u; i < std::min(threadCount, count); ++i)
+  {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for(std::thread& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+/**
+ * Direction of the center of a texel, u and v are within [-1, 1]
+ */
+Vec3 FaceDirection(uint32_t face, float u, float v)
+{
+  switch(face)
+  {
+    case 0:
+      return Normalize(Vec3{1.0f, -v, -u});
+    case 1:
+      return Normalize(Vec3{-1.0f, -v, u});
+    case 2:
+      return Normalize(Vec3{u, 1.0f, v});
+    case 3:
+      return Normalize(Vec3{u, -1.0f, -v});
+    case 4:
+      return Normalize(Vec3{u, -v, 1.0f});
+    default:
+      return Normalize(Vec3{-u, -v, -1.0f});
+  }
+}
+
+/**
+ * Face and texture coordinates within [0, 1] pointed by a direction
+ */
+void DirectionToFace(const Vec3& dir, uint32_t& face, float& u, float& v)
+{
+  const float ax = std::fabs(dir.x);
+  const float ay = std::fabs(dir.y);
+  const float az = std::fabs(dir.z);
+  float       sc, tc, ma;
+  if(ax >= ay && ax >= az)
+  {
+    face = dir.x > 0.0f ? 0u : 1u;
+    sc   = dir.x > 0.0f ? -dir.z : dir.z;
+    tc   = -dir.y;
+    ma   = ax;
+  }
+  else if(ay >= az)
+  {
+    face = dir.y > 0.0f ? 2u : 3u;
+    sc   = dir.x;
+    tc   = dir.y > 0.0f ? dir.z : -dir.z;
+    ma   = ay;
+  }
+  else
+  {
+    face = dir.z > 0.0f ? 4u : 5u;
+    sc   = dir.z > 0.0f ? dir.x : -dir.x;
+    tc   = -dir.y;
+    ma   = az;
+  }
+  u = 0.5f * (sc / ma + 1.0f);
+  v = 0.5f * (tc / ma + 1.0f);
+}
+
+/**
+ * Bilinear sample of an image, u and v are within [0, 1], the edges are clamped
+ */
+Vec4 SampleImage(const Image& image, float u, float v, bool wrapU)
+{
+  const float fx = u * image.width - 0.5f;
+  const float fy = std::min(std::max(v * image.height - 0.5f, 0.0f), image.height - 1.0f);
+  const float x0 = std::floor(fx);
+  const float y0 = std::floor(fy);
+  const float tx = fx - x0;
+  const float ty = fy - y0;
+
+  auto column = [&](int32_t x)
+  {
+    const int32_t width = static_cast<int32_t>(image.width);
+    return static_cast<uint32_t>(wrapU ? ((x % width) + width) % width : std::min(std::max(x, 0), width - 1));
+  };
+  const uint32_t left   = column(static_cast<int32_t>(x0));
+  const uint32_t right  = column(static_cast<int32_t>(x0) + 1);
+  const uint32_t top    = static_cast<uint32_t>(y0);
+  const uint32_t bottom = std::min(top + 1u, image.height - 1u);
+
+  Vec4 result;
+  result.MultiplyAdd(image.pixels[top * image.width + left], (1.0f - tx) * (1.0f - ty));
+  result.MultiplyAdd(image.pixels[top * image.width + right], tx * (1.0f - ty));
+  result.MultiplyAdd(image.pixels[bottom * image.width + left], (1.0f - tx) * ty);
+  result.MultiplyAdd(image.pixels[bottom * image.width + right], tx * ty);
+  return result;
+}
+
+/**
+ * Trilinear sample of a cube map
+ */
+Vec4 SampleCube(const CubeMap& cube, const Vec3& dir, float lod)
+{
+  uint32_t face;
+  float    u, v;
+  DirectionToFace(dir, face, u, v);
+
+  lod                  = std::min(std::max(lod, 0.0f), static_cast<float>(cube.GetLevelCount() - 1u));
+  const uint32_t level = static_cast<uint32_t>(lod);
+  const float    t     = lod - level;
+  Vec4           result(SampleImage(cube.faces[face][level], u, v, false) * (1.0f - t));
+  if(t > 0.0f)
+  {
+    result.MultiplyAdd(SampleImage(cube.faces[face][level + 1u], u, v, false), t);
+  }
+  return result;
+}
+
+/**
+ * Adds the mipmaps of every face down to 1x1, with a box filter
+ */
+void GenerateMipmaps(CubeMap& cube)
+{
+  for(std::vector<Image>& levels : cube.faces)
+  {
+    levels.resize(1u);
+    while(levels.back().width > 1u)
+    {
+      const Image& source = levels.back();
+      Image        mipmap;
+      mipmap.width  = source.width / 2u;
+      mipmap.height = source.height / 2u;
+      mipmap.pixels.resize(mipmap.width * mipmap.height);
+      for(uint32_t y = 0u; y < mipmap.height; ++y)
+      {
+        for(uint32_t x = 0u; x < mipmap.width; ++x)
+        {
+          Vec4& pixel = mipmap.pixels[y * mipmap.width + x];
+          pixel.MultiplyAdd(source.pixels[(2u * y) * source.width + 2u * x], 0.25f);
+          pixel.MultiplyAdd(source.pixels[(2u * y) * source.width + 2u * x + 1u], 0.25f);
+          pixel.MultiplyAdd(source.pixels[(2u * y + 1u) * source.width + 2u * x], 0.25f);
+          pixel.MultiplyAdd(source.pixels[(2u * y + 1u) * source.width + 2u * x + 1u], 0.25f);
+        }
+      }
+      levels.push_back(std::move(mipmap));
+    }
+  }
+}
+
+bool ReadFile(const std::string& filename, std::vector<uint8_t>& bytes)
+{
+  std::ifstream file(filename, std::ios::binary);
+  if(!file)
+  {
+    return false;
+  }
+  bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  return true;
+}
+
+float HalfToFloat(uint16_t half)
+{
+  const uint32_t sign     = static_cast<uint32_t>(half & 0x8000u) << 16;
+  const uint32_t exponent = (half >> 10) & 0x1Fu;
+  const uint32_t mantissa = half & 0x3FFu;
+
+  float value;
+  if(exponent == 0u)
+  {
+    value = std::ldexp(static_cast<float>(mantissa), -24);
+  }
+  else if(exponent == 0x1Fu)
+  {
+    value = mantissa ? NAN : INFINITY;
+  }
+  else
+  {
+    value = std::ldexp(static_cast<float>(mantissa | 0x400u), static_cast<int>(exponent) - 25);
+  }
+  return sign ? -value : value;
+}
+
+uint16_t FloatToHalf(float value)
+{
+  // The largest half float, brighter texels are clamped rather than becoming infinite
+  value = std::min(value, 65504.0f);
+
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+
+  const uint32_t sign     = (bits >> 16) & 0x8000u;
+  const int32_t  exponent = static_cast<int32_t>((bits >> 23) & 0xFFu) - 127 + 15;
+  uint32_t       mantissa = bits & 0x7FFFFFu;
+
+  if(((bits >> 23) & 0xFFu) == 0xFFu)
+  {
+    // NaN, there is no infinity after the clamp
+    return static_cast<uint16_t>(sign | 0x7E00u);
+  }
+  if(exponent <= 0)
+  {
+    if(exponent < -10)
+    {
+      return static_cast<uint16_t>(sign);
+    }
+    // denormal
+    mantissa |= 0x800000u;
+    const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+    uint32_t       half  = mantissa >> shift;
+    if((mantissa >> (shift - 1)) & 1u)
+    {
+      ++half;
+    }
+    return static_cast<uint16_t>(sign | half);
+  }
+
+  // round to nearest, the carry may correctly bump the exponent
+  uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+  if(mantissa & 0x1000u)
+  {
+    ++half;
+  }
+  return static_cast<uint16_t>(half);
+}
+
+/**
+ * Reads a Radiance RGBE image, flat or with run length encoded scanlines
+ */
+bool ReadHdr(const std::string& filename, Image& image)
+{
+  std::vector<uint8_t> bytes;
+  if(!ReadFile(filename, bytes) || bytes.size() < 2u || bytes[0] != '#' || bytes[1] != '?')
+  {
+    return false;
+  }
+
+  // The header ends with an empty line, followed by the resolution line
+  size_t      position = 0u;
+  std::string line;
+  bool        headerEnd = false;
+  while(position < bytes.size())
+  {
+    const char c = static_cast<char>(bytes[position++]);
+    if(c != '\n')
+    {
+      line += c;
+      continue;
+    }
+    if(headerEnd)
+    {
+      break;
+    }
+    if(line.compare(0, 7, "FORMAT=") == 0 && line != "FORMAT=32-bit_rle_rgbe")
+    {
+      return false;
+    }
+    headerEnd = line.empty();
+    line.clear();
+  }
+
+  int width = 0, height = 0;
+  if(sscanf(line.c_str(), "-Y %d +X %d", &height, &width) != 2 || width <= 0 || height <= 0)
+  {
+    return false;
+  }
+
+  image.width  = static_cast<uint32_t>(width);
+  image.height = static_cast<uint32_t>(height);
+  image.pixels.resize(image.width * image.height);
+
+  std::vector<uint8_t> scanline(image.width * 4u);
+  for(uint32_t y = 0u; y < image.height; ++y)
+  {
+    if(position + 4u > bytes.size())
+    {
+      return false;
+    }
+
+    const bool runLength = image.width >= 8u && image.width < 32768u && bytes[position] == 2u && bytes[position + 1u] == 2u &&
+                           ((bytes[position + 2u] << 8) | bytes[position + 3u]) == static_cast<int>(image.width);
+    if(runLength)
+    {
+      // Every channel of the scanline is encoded separately
+      position += 4u;
+      for(uint32_t channel = 0u; channel < 4u; ++channel)
+      {
+        uint32_t x = 0u;
+        while(x < image.width)
+        {
+          if(position >= bytes.size())
+          {
+            return false;
+          }
+          uint32_t count = bytes[position++];
+          if(count > 128u)
+          {
+            count -= 128u;
+            if(count > image.width - x || position >= bytes.size())
+            {
+              return false;
+            }
+            const uint8_t value = bytes[position++];
+            for(; count > 0u; --count)
+            {
+              scanline[4u * x++ + channel] = value;
+            }
+          }
+          else
+          {
+            if(count == 0u || count > image.width - x || position + count > bytes.size())
+            {
+              return false;
+            }
+            for(; count > 0u; --count)
+            {
+              scanline[4u * x++ + channel] = bytes[position++];
+            }
+          }
+        }
+      }
+    }
+    else
+    {
+      if(position + scanline.size() > bytes.size())
+      {
+        return false;
+      }
+      memcpy(scanline.data(), &bytes[position], scanline.size());
+      position += scanline.size();
+    }
+
+    for(uint32_t x = 0u; x < image.width; ++x)
+    {
+      const uint8_t* rgbe  = &scanline[4u * x];
+      const float    scale = rgbe[3] ? std::ldexp(1.0f, static_cast<int>(rgbe[3]) - (128 + 8)) : 0.0f;
+      image.pixels[y * image.width + x] = Vec4(rgbe[0] * scale, rgbe[1] * scale, rgbe[2] * scale, 0.0f);
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Reads the largest mipmap of a RGB16F or RGB32F ktx cube map
+ */
+bool ReadKtxCube(const std::string& filename, CubeMap& cube)
+{
+  std::vector<uint8_t> bytes;
+  uint32_t             header[13];
+  if(!ReadFile(filename, bytes) || bytes.size() < 64u || memcmp(bytes.data(), KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER)))
+  {
+    return false;
+  }
+  memcpy(header, &bytes[12], sizeof(header));
+
+  // endianness, glType, glTypeSize, glFormat, glInternalFormat, glBaseInternalFormat, width, height, depth, array elements, faces, levels, key value bytes
+  const bool     half   = header[4] == GL_RGB16F;
+  const uint32_t width  = header[6];
+  const uint32_t height = header[7];
+  if(header[0] != 0x04030201u || (header[4] != GL_RGB16F && header[4] != GL_RGB32F) || width != height || header[10] != 6u)
+  {
+    return false;
+  }
+
+  size_t         position  = 64u + header[12] + 4u;
+  const uint32_t faceBytes = width * height * 3u * (half ? 2u : 4u);
+  for(uint32_t face = 0u; face < 6u; ++face)
+  {
+    if(position + faceBytes > bytes.size())
+    {
+      return false;
+    }
+
+    Image image;
+    image.width  = width;
+    image.height = height;
+    image.pixels.resize(width * height);
+    for(uint32_t i = 0u; i < width * height; ++i)
+    {
+      float rgb[3];
+      for(uint32_t c = 0u; c < 3u; ++c)
+      {
+        if(half)
+        {
+          uint16_t value;
+          memcpy(&value, &bytes[position + (3u * i + c) * 2u], 2u);
+          rgb[c] = HalfToFloat(value);
+        }
+        else
+        {
+          memcpy(&rgb[c], &bytes[position + (3u * i + c) * 4u], 4u);
+        }
+      }
+      image.pixels[i] = Vec4(rgb[0], rgb[1], rgb[2], 0.0f);
+    }
+    cube.faces[face].assign(1u, std::move(image));
+    position += (faceBytes + 3u) & ~3u;
+  }
+
+  return true;
+}
+
+/**
+ * Resamples an equirectangular image to a cube map
+ */
+void EquirectangularToCube(const Image& image, uint32_t size, uint32_t threadCount, CubeMap& cube)
+{
+  for(std::vector<Image>& levels : cube.faces)
+  {
+    levels.resize(1u);
+    levels[0].width  = size;
+    levels[0].height = size;
+    levels[0].pixels.resize(size * size);
+  }
+
+  // Every texel averages 2x2 samples of the image, so the resampling doesn't alias
+  ParallelFor(6u * size, threadCount, [&](uint32_t job)
+  {
+    const uint32_t face = job / size;
+    const uint32_t y    = job % size;
+    for(uint32_t x = 0u; x < size; ++x)
+    {
+      Vec4 color;
+      for(uint32_t s = 0u; s < 4u; ++s)
+      {
+        const float u   = 2.0f * (x + 0.25f + 0.5f * (s & 1u)) / size - 1.0f;
+        const float v   = 2.0f * (y + 0.25f + 0.5f * (s >> 1u)) / size - 1.0f;
+        const Vec3  dir = FaceDirection(face, u, v);
+        const float phi = std::atan2(dir.x, -dir.z);
+        color.MultiplyAdd(SampleImage(image, 0.5f + phi / (2.0f * PI), std::acos(std::min(std::max(dir.y, -1.0f), 1.0f)) / PI, true), 0.25f);
+      }
+      cube.faces[face][0].pixels[y * size + x] = color;
+    }
+  });
+}
+
+/**
+ * Solid angle of the part of a face between the center and (x, y), see "Cube Map Texel Solid Angle"
+ */
+float AreaElement(float x, float y)
+{
+  return std::atan2(x * y, std::sqrt(x * x + y * y + 1.0f));
+}
+
+float TexelSolidAngle(uint32_t x, uint32_t y, uint32_t size)
+{
+  const float x0 = 2.0f * x / size - 1.0f;
+  const float y0 = 2.0f * y / size - 1.0f;
+  const float x1 = 2.0f * (x + 1u) / size - 1.0f;
+  const float y1 = 2.0f * (y + 1u) / size - 1.0f;
+  return AreaElement(x0, y0) - AreaElement(x0, y1) - AreaElement(x1, y0) + AreaElement(x1, y1);
+}
+
+void ShBasis(const Vec3& dir, float basis[9])
+{
+  basis[0] = 0.282095f;
+  basis[1] = 0.488603f * dir.y;
+  basis[2] = 0.488603f * dir.z;
+  basis[3] = 0.488603f * dir.x;
+  basis[4] = 1.092548f * dir.x * dir.y;
+  basis[5] = 1.092548f * dir.y * dir.z;
+  basis[6] = 0.315392f * (3.0f * dir.z * dir.z - 1.0f);
+  basis[7] = 1.092548f * dir.x * dir.z;
+  basis[8] = 0.546274f * (dir.x * dir.x - dir.y * dir.y);
+}
+
+/**
+ * Computes the irradiance map, the environment is projected to 9 spherical harmonics coefficients
+ */
+void BakeIrradiance(const CubeMap& source, uint32_t size, uint32_t threadCount, CubeMap& irradiance)
+{
+  // A small mipmap holds enough detail for the lowest frequencies
+  uint32_t level = 0u;
+  while(source.GetSize(level) > SH_SOURCE_SIZE && level + 1u < source.GetLevelCount())
+  {
+    ++level;
+  }
+  const uint32_t sourceSize = source.GetSize(level);
+
+  // Every row is projected separately, the rows are summed in order so the result is deterministic
+  std::vector<Vec4> rows(6u * sourceSize * 9u);
+  ParallelFor(6u * sourceSize, threadCount, [&](uint32_t job)
+  {
+    const uint32_t face = job / sourceSize;
+    const uint32_t y    = job % sourceSize;
+    const Image&   image(source.faces[face][level]);
+    for(uint32_t x = 0u; x < sourceSize; ++x)
+    {
+      float basis[9];
+      ShBasis(FaceDirection(face, 2.0f * (x + 0.5f) / sourceSize - 1.0f, 2.0f * (y + 0.5f) / sourceSize - 1.0f), basis);
+      const float solidAngle = TexelSolidAngle(x, y, sourceSize);
+      for(uint32_t i = 0u; i < 9u; ++i)
+      {
+        rows[job * 9u + i].MultiplyAdd(image.pixels[y * sourceSize + x], basis[i] * solidAngle);
+      }
+    }
+  });
+
+  // The cosine lobe convolution of every band, divided by pi
+  const float band[9] = {1.0f, 2.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f};
+  Vec4        coefficients[9];
+  for(uint32_t row = 0u; row < 6u * sourceSize; ++row)
+  {
+    for(uint32_t i = 0u; i < 9u; ++i)
+    {
+      coefficients[i].MultiplyAdd(rows[row * 9u + i], band[i]);
+    }
+  }
+
+  for(std::vector<Image>& levels : irradiance.faces)
+  {
+    levels.resize(1u);
+    levels[0].width  = size;
+    levels[0].height = size;
+    levels[0].pixels.resize(size * size);
+  }
+  ParallelFor(6u * size, threadCount, [&](uint32_t job)
+  {
+    const uint32_t face = job / size;
+    const uint32_t y    = job % size;
+    for(uint32_t x = 0u; x < size; ++x)
+    {
+      float basis[9];
+      ShBasis(FaceDirection(face, 2.0f * (x + 0.5f) / size - 1.0f, 2.0f * (y + 0.5f) / size - 1.0f), basis);
+      Vec4 color;
+      for(uint32_t i = 0u; i < 9u; ++i)
+      {
+        color.MultiplyAdd(coefficients[i], basis[i]);
+      }
+      color.x = std::max(color.x, 0.0f);
+      color.y = std::max(color.y, 0.0f);
+      color.z = std::max(color.z, 0.0f);
+      irradiance.faces[face][0].pixels[y * size + x] = color;
+    }
+  });
+}
+
+/**
+ * Hammersley point i of count
+ */
+void Hammersley(uint32_t i, uint32_t count, float& u, float& v)
+{
+  uint32_t bits = i;
+  bits          = (bits << 16u) | (bits >> 16u);
+  bits          = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+  bits          = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+  bits          = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+  bits          = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+  u             = static_cast<float>(i) / count;
+  v             = static_cast<float>(bits) * 2.3283064365386963e-10f;
+}
+
+/**
+ * GGX half vector around +z
+ */
+Vec3 ImportanceSampleGgx(float u, float v, float roughness)
+{
+  const float a        = roughness * roughness;
+  const float phi      = 2.0f * PI * u;
+  const float cosTheta = std::sqrt((1.0f - v) / (1.0f + (a * a - 1.0f) * v));
+  const float sinTheta = std::sqrt(1.0f - cosTheta * cosTheta);
+  return Vec3{sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta};
+}
+
+/**
+ * The roughness pbr_shader.fsh selects the specular level for, ignoring the convexity term
+ */
+float LevelRoughness(uint32_t level, uint32_t size)
+{
+  // finalLod = (uMaxLOD - 3) - LevelFrom1x1, LevelFrom1x1 = ROUGHEST_MIP - MIP_SCALE * log2(roughness), uMaxLOD = log2(size)
+  const float levelFrom1x1 = std::log2(static_cast<float>(size)) - 3.0f - level;
+  return std::min(std::exp2((REFLECTION_CAPTURE_ROUGHEST_MIP - levelFrom1x1) / REFLECTION_CAPTURE_ROUGHNESS_MIP_SCALE), 1.0f);
+}
+
+struct SpecularSample
+{
+  Vec3  direction; ///< Light direction around +z
+  float weight;    ///< N dot L
+  float lod;       ///< Source mipmap matching the solid angle of the sample
+};
+
+/**
+ * Computes the GGX prefiltered specular mipmaps, assuming the view direction is the normal
+ */
+void BakeSpecular(const CubeMap& source, uint32_t size, uint32_t levelCount, uint32_t sampleCount, uint32_t threadCount, CubeMap& specular)
+{
+  const float sourceSize = static_cast<float>(source.GetSize());
+  const float texelSolidAngle(4.0f * PI / (6.0f * sourceSize * sourceSize));
+
+  for(std::vector<Image>& levels : specular.faces)
+  {
+    levels.resize(levelCount);
+  }
+
+  for(uint32_t level = 0u; level < levelCount; ++level)
+  {
+    const uint32_t levelSize = std::max(size >> level, 1u);
+    const float    roughness = LevelRoughness(level, size);
+
+    // The samples only depend on the roughness, the source mipmap of every sample is selected by its pdf
+    std::vector<SpecularSample> samples;
+    for(uint32_t i = 0u; i < sampleCount; ++i)
+    {
+      float u, v;
+      Hammersley(i, sampleCount, u, v);
+      const Vec3  h        = ImportanceSampleGgx(u, v, roughness);
+      const Vec3  l        = Vec3{0.0f, 0.0f, -1.0f} + h * (2.0f * h.z);
+      const float nDotL    = l.z;
+      const float a2       = std::pow(roughness, 4.0f);
+      const float d        = a2 / (PI * std::pow(h.z * h.z * (a2 - 1.0f) + 1.0f, 2.0f));
+      const float pdf      = d / 4.0f;
+      const float solidAng = 1.0f / (sampleCount * pdf + 0.0001f);
+      if(nDotL > 0.0f)
+      {
+        samples.push_back(SpecularSample{Vec3{l.x, l.y, l.z}, nDotL, 0.5f * std::log2(solidAng / texelSolidAngle) + 1.0f});
+      }
+    }
+
+    for(std::vector<Image>& levels : specular.faces)
+    {
+      levels[level].width  = levelSize;
+      levels[level].height = levelSize;
+      levels[level].pixels.resize(levelSize * levelSize);
+    }
+
+    ParallelFor(6u * levelSize, threadCount, [&](uint32_t job)
+    {
+      const uint32_t face = job / levelSize;
+      const uint32_t y    = job % levelSize;
+      for(uint32_t x = 0u; x < levelSize; ++x)
+      {
+        const Vec3 n = FaceDirection(face, 2.0f * (x + 0.5f) / levelSize - 1.0f, 2.0f * (y + 0.5f) / levelSize - 1.0f);
+        const Vec3 up(std::fabs(n.z) < 0.999f ? Vec3{0.0f, 0.0f, 1.0f} : Vec3{1.0f, 0.0f, 0.0f});
+        const Vec3 tangent   = Normalize(Cross(up, n));
+        const Vec3 bitangent = Cross(n, tangent);
+
+        Vec4  color;
+        float weight = 0.0f;
+        for(const SpecularSample& sample : samples)
+        {
+          const Vec3 l = tangent * sample.direction.x + bitangent * sample.direction.y + n * sample.direction.z;
+          color.MultiplyAdd(SampleCube(source, l, sample.lod), sample.weight);
+          weight += sample.weight;
+        }
+        specular.faces[face][level].pixels[y * levelSize + x] = color * (weight > 0.0f ? 1.0f / weight : 0.0f);
+      }
+    });
+
+    std::cout << "  specular " << levelSize << "x" << levelSize << ", roughness " << roughness << "\n";
+  }
+}
+
+/**
+ * Computes the split sum BRDF lookup table, N dot V along x and roughness along y
+ */
+void BakeBrdf(uint32_t size, uint32_t sampleCount, uint32_t threadCount, Image& brdf)
+{
+  brdf.width  = size;
+  brdf.height = size;
+  brdf.pixels.resize(size * size);
+
+  ParallelFor(size, threadCount, [&](uint32_t y)
+  {
+    const float roughness = (y + 0.5f) / size;
+    const float k         = roughness * roughness / 2.0f;
+    for(uint32_t x = 0u; x < size; ++x)
+    {
+      const float nDotV = (x + 0.5f) / size;
+      const Vec3  view{std::sqrt(1.0f - nDotV * nDotV), 0.0f, nDotV};
+
+      float scale = 0.0f;
+      float bias  = 0.0f;
+      for(uint32_t i = 0u; i < sampleCount; ++i)
+      {
+        float u, v;
+        Hammersley(i, sampleCount, u, v);
+        const Vec3  h     = ImportanceSampleGgx(u, v, roughness);
+        const float vDotH = Dot(view, h);
+        const Vec3  l     = h * (2.0f * vDotH) + view * -1.0f;
+        if(l.z > 0.0f)
+        {
+          const float nDotL = l.z;
+          const float nDotH = std::max(h.z, 0.0f);
+          const float g     = (nDotL / (nDotL * (1.0f - k) + k)) * (nDotV / (nDotV * (1.0f - k) + k));
+          const float gVis  = g * std::max(vDotH, 0.0f) / (nDotH * nDotV);
+          const float fc    = std::pow(1.0f - std::max(vDotH, 0.0f), 5.0f);
+          scale += (1.0f - fc) * gVis;
+          bias += fc * gVis;
+        }
+      }
+      brdf.pixels[y * size + x] = Vec4(scale / sampleCount, bias / sampleCount, 0.0f, 0.0f);
+    }
+  });
+}
+
+/**
+ * Writes RGB16F ktx file, a single face or a cube map
+ */
+bool WriteKtx(const std::string& filename, const std::vector<const std::vector<Image>*>& faces)
+{
+  const std::vector<Image>& levels = *faces[0];
+  const uint32_t            header[13] =
+    {0x04030201u, GL_HALF_FLOAT, 2u, GL_RGB, GL_RGB16F, GL_RGB, levels[0].width, levels[0].height, 0u, 0u, static_cast<uint32_t>(faces.size()), static_cast<uint32_t>(levels.size()), 0u};
+
+  std::vector<uint8_t> out(KTX_IDENTIFIER, KTX_IDENTIFIER + sizeof(KTX_IDENTIFIER));
+  out.resize(64u);
+  memcpy(&out[12], header, sizeof(header));
+
+  for(uint32_t level = 0u; level < levels.size(); ++level)
+  {
+    // The image size of a cube map is the size of a single face, every face is padded to 4 bytes
+    const uint32_t faceBytes = levels[level].width * levels[level].height * 6u;
+    const size_t   sizeOffset(out.size());
+    out.resize(out.size() + 4u);
+    memcpy(&out[sizeOffset], &faceBytes, 4u);
+
+    for(const std::vector<Image>* face : faces)
+    {
+      for(const Vec4& pixel : (*face)[level].pixels)
+      {
+        for(float value : {pixel.x, pixel.y, pixel.z})
+        {
+          const uint16_t half = FloatToHalf(value);
+          out.push_back(static_cast<uint8_t>(half & 0xFFu));
+          out.push_back(static_cast<uint8_t>(half >> 8));
+        }
+      }
+      out.resize((out.size() + 3u) & ~size_t(3u));
+    }
+  }
+
+  std::ofstream file(filename, std::ios::binary);
+  return static_cast<bool>(file.write(reinterpret_cast<const char*>(out.data()), out.size()));
+}
+
+bool WriteKtx(const std::string& filename, const CubeMap& cube)
+{
+  std::vector<const std::vector<Image>*> faces;
+  for(const std::vector<Image>& levels : cube.faces)
+  {
+    faces.push_back(&levels);
+  }
+  return WriteKtx(filename, faces);
+}
+
+bool IsPowerOfTwo(uint32_t value)
+{
+  return value && !(value & (value - 1u));
+}
+
+void PrintUsage(const char* program)
+{
+  std::cerr << "Usage: " << program << " [options] <environment.hdr | environment.ktx | +x.hdr -x.hdr +y.hdr -y.hdr +z.hdr -z.hdr>\n"
+            << "  --irradiance <out.ktx>  --specular <out.ktx>  --brdf <out.ktx>\n"
+            << "  --irradiance-size <n>  --specular-size <n>  --specular-levels <n>  --brdf-size <n>\n"
+            << "  --samples <n>  --threads <n>\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  std::string              irradianceFile, specularFile, brdfFile;
+  uint32_t                 irradianceSize = DEFAULT_IRRADIANCE_SIZE;
+  uint32_t                 specularSize   = DEFAULT_SPECULAR_SIZE;
+  uint32_t                 specularLevels = 0u;
+  uint32_t                 brdfSize       = DEFAULT_BRDF_SIZE;
+  uint32_t                 sampleCount    = DEFAULT_SAMPLES;
+  uint32_t                 threadCount    = std::max(std::thread::hardware_concurrency(), 1u);
+  std::vector<std::string> files;
+
+  for(int i = 1; i < argc; ++i)
+  {
+    const std::string arg(argv[i]);
+    const bool        hasValue = i + 1 < argc;
+    if(arg == "--irradiance" && hasValue)
+    {
+      irradianceFile = argv[++i];
+    }
+    else if(arg == "--specular" && hasValue)
+    {
+      specularFile = argv[++i];
+    }
+    else if(arg == "--brdf" && hasValue)
+    {
+      brdfFile = argv[++i];
+    }
+    else if(arg == "--irradiance-size" && hasValue)
+    {
+      irradianceSize = static_cast<uint32_t>(std::stoul(argv[++i]));
+    }
+    else if(arg == "--specular-size" && hasValue)
+    {
+      specularSize = static_cast<uint32_t>(std::stoul(argv[++i]));
+    }
+    else if(arg == "--specular-levels" && hasValue)
+    {
+      specularLevels = static_cast<uint32_t>(std::stoul(argv[++i]));
+    }
+    else if(arg == "--brdf-size" && hasValue)
+    {
+      brdfSize = static_cast<uint32_t>(std::stoul(argv[++i]));
+    }
+    else if(arg == "--samples" && hasValue)
+    {
+      sampleCount = std::max(static_cast<uint32_t>(std::stoul(argv[++i])), 1u);
+    }
+    else if(arg == "--threads" && hasValue)
+    {
+      threadCount = std::max(static_cast<uint32_t>(std::stoul(argv[++i])), 1u);
+    }
+    else if(arg.compare(0, 2, "--") == 0)
+    {
+      PrintUsage(argv[0]);
+      return 1;
+    }
+    else
+    {
+      files.push_back(arg);
+    }
+  }
+
+  if((files.size() != 1u && files.size() != 6u) || (irradianceFile.empty() && specularFile.empty() && brdfFile.empty()) ||
+     !IsPowerOfTwo(irradianceSize) || !IsPowerOfTwo(specularSize))
+  {
+    PrintUsage(argv[0]);
+    return 1;
+  }
+
+  // By default the levels go down to 4x4, like the maps shipped with the example
+  uint32_t maxLevels = 1u;
+  while((specularSize >> maxLevels) >= SMALLEST_SPECULAR_SIZE)
+  {
+    ++maxLevels;
+  }
+  specularLevels = specularLevels ? std::min(specularLevels, maxLevels) : maxLevels;
+
+  CubeMap source;
+  if(!irradianceFile.empty() || !specularFile.empty())
+  {
+    if(files.size() == 6u)
+    {
+      for(uint32_t face = 0u; face < 6u; ++face)
+      {
+        Image image;
+        if(!ReadHdr(files[face], image) || image.width != image.height || !IsPowerOfTwo(image.width) ||
+           (face && image.width != source.GetSize()))
+        {
+          std::cerr << "Invalid cube map face " << files[face] << "\n";
+          return 1;
+        }
+        source.faces[face].assign(1u, std::move(image));
+      }
+    }
+    else if(!ReadKtxCube(files[0], source))
+    {
+      Image image;
+      if(!ReadHdr(files[0], image))
+      {
+        std::cerr << "Failed to read " << files[0] << "\n";
+        return 1;
+      }
+
+      // A quarter of the width keeps the resolution of the image around the horizon
+      uint32_t size = 1u;
+      while(size * 2u <= std::min(image.width / 4u, MAX_SOURCE_SIZE))
+      {
+        size *= 2u;
+      }
+      EquirectangularToCube(image, size, threadCount, source);
+    }
+
+    if(!IsPowerOfTwo(source.GetSize()))
+    {
+      std::cerr << "The faces of " << files[0] << " are not a power of two\n";
+      return 1;
+    }
+    GenerateMipmaps(source);
+    std::cout << "Source cube map " << source.GetSize() << "x" << source.GetSize() << ", " << threadCount << " threads\n";
+  }
+
+  if(!irradianceFile.empty())
+  {
+    CubeMap irradiance;
+    BakeIrradiance(source, irradianceSize, threadCount, irradiance);
+    if(!WriteKtx(irradianceFile, irradiance))
+    {
+      std::cerr << "Failed to write " << irradianceFile << "\n";
+      return 1;
+    }
+    std::cout << irradianceFile << ": irradiance " << irradianceSize << "x" << irradianceSize << "\n";
+  }
+
+  if(!specularFile.empty())
+  {
+    CubeMap specular;
+    BakeSpecular(source, specularSize, specularLevels, sampleCount, threadCount, specular);
+    if(!WriteKtx(specularFile, specular))
+    {
+      std::cerr << "Failed to write " << specularFile << "\n";
+      return 1;
+    }
+    std::cout << specularFile << ": specular " << specularSize << "x" << specularSize << ", " << specularLevels << " levels\n";
+  }
+
+  if(!brdfFile.empty())
+  {
+    std::vector<Image> brdf(1u);
+    BakeBrdf(brdfSize, sampleCount, threadCount, brdf[0]);
+    if(!WriteKtx(brdfFile, {&brdf}))
+    {
+      std::cerr << "Failed to write " << brdfFile << "\n";
+      return 1;
+    }
+    std::cout << brdfFile << ": BRDF " << brdfSize << "x" << brdfSize << "\n";
+  }
+
+  return 0;
+}
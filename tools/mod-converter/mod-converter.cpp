@@ -0,0 +1,502 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * mod-converter converts '.mod' model files used by the fpp-game example
+ * to the version 2 format ( see examples/fpp-game/game-model-format.h ).
+ *
+ * Usage:
+ *   mod-converter [--index] [--quantize] <input.mod> <output.mod>
+ *   mod-converter --info <input.mod>
+ *
+ *   --index     removes duplicated vertices and stores an index buffer ( if there are any )
+ *   --quantize  stores normals as snorm16 and texture coordinates as half floats
+ *
+ * The tool has no DALi dependencies.
+ */
+
+#include "examples/fpp-game/game-model-format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace GameModelFormat;
+
+namespace
+{
+// Version 1 header: tag, version, vertexBufferSize, attributeCount, format[16], offset[16], size[16], stride, reserved, dataBeginOffset
+const uint32_t V1_HEADER_SIZE(4u * (4u + 16u * 3u + 3u));
+const uint32_t V1_VERTEX_STRIDE_OFFSET(4u * (4u + 16u * 3u));
+const uint32_t V1_DATA_BEGIN_OFFSET(V1_VERTEX_STRIDE_OFFSET + 8u);
+const uint32_t V1_ATTRIBUTE_OFFSETS(4u * (4u + 16u));
+
+// Number of floats in the decoded vertex ( position, normal, texture coordinate )
+const uint32_t VERTEX_FLOATS(8u);
+
+/**
+ * Decoded vertex, compared bitwise when removing duplicates
+ */
+struct Vertex
+{
+  float data[VERTEX_FLOATS];
+
+  bool operator<(const Vertex& rhs) const
+  {
+    return memcmp(data, rhs.data, sizeof(data)) < 0;
+  }
+};
+
+/**
+ * Decoded model
+ */
+struct Model
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+};
+
+bool ReadFile(const std::string& filename, std::vector<uint8_t>& bytes)
+{
+  std::ifstream file(filename, std::ios::binary);
+  if(!file)
+  {
+    return false;
+  }
+  bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  return true;
+}
+
+uint32_t ReadU32BE(const uint8_t* data)
+{
+  return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) | (static_cast<uint32_t>(data[2]) << 8) | static_cast<uint32_t>(data[3]);
+}
+
+/**
+ * Decodes version 1 file, the little-endian copy is preferred
+ */
+bool DecodeVersion1(const std::vector<uint8_t>& bytes, Model& model)
+{
+  const size_t half = bytes.size() / 2;
+  bool         littleEndian;
+  size_t       headerOffset;
+  if(half >= V1_HEADER_SIZE && ReadU32(&bytes[half]) == MODV_TAG)
+  {
+    littleEndian = true;
+    headerOffset = half;
+  }
+  else if(bytes.size() >= V1_HEADER_SIZE && ReadU32BE(&bytes[0]) == MODV_TAG)
+  {
+    littleEndian = false;
+    headerOffset = 0;
+  }
+  else
+  {
+    return false;
+  }
+
+  const uint8_t* header = &bytes[headerOffset];
+  auto           read   = [littleEndian](const uint8_t* data) { return littleEndian ? ReadU32(data) : ReadU32BE(data); };
+
+  const uint32_t vertexBufferSize = read(header + 8);
+  const uint32_t stride           = read(header + V1_VERTEX_STRIDE_OFFSET);
+  const uint32_t dataBegin        = read(header + V1_DATA_BEGIN_OFFSET);
+  if(stride != VERTEX_FLOATS * sizeof(float) || static_cast<uint64_t>(dataBegin) + vertexBufferSize > bytes.size())
+  {
+    return false;
+  }
+
+  uint32_t offsets[ATTRIBUTE_COUNT];
+  for(uint32_t i = 0; i < ATTRIBUTE_COUNT; ++i)
+  {
+    offsets[i] = read(header + V1_ATTRIBUTE_OFFSETS + i * sizeof(uint32_t));
+  }
+
+  const uint32_t components[ATTRIBUTE_COUNT] = {3u, 3u, 2u};
+  const uint32_t vertexCount                 = vertexBufferSize / stride;
+  model.vertices.resize(vertexCount);
+  for(uint32_t v = 0; v < vertexCount; ++v)
+  {
+    const uint8_t* in  = &bytes[dataBegin + v * stride];
+    float*         out = model.vertices[v].data;
+    for(uint32_t i = 0; i < ATTRIBUTE_COUNT; ++i)
+    {
+      for(uint32_t c = 0; c < components[i]; ++c)
+      {
+        const uint32_t bits = read(in + offsets[i] + c * sizeof(float));
+        memcpy(out++, &bits, sizeof(float));
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Decodes version 2 file, so already converted files can be re-encoded
+ */
+bool DecodeVersion2(const std::vector<uint8_t>& bytes, Model& model)
+{
+  ModelHeaderV2 header;
+  if(!ReadHeaderV2(bytes.data(), bytes.size(), header))
+  {
+    return false;
+  }
+
+  const uint32_t components[ATTRIBUTE_COUNT] = {3u, 3u, 2u};
+  model.vertices.resize(header.vertexCount);
+  for(uint32_t v = 0; v < header.vertexCount; ++v)
+  {
+    const uint8_t* in  = &bytes[header.vertexDataOffset + v * header.vertexStride];
+    float*         out = model.vertices[v].data;
+    for(uint32_t i = 0; i < ATTRIBUTE_COUNT; ++i)
+    {
+      const ModelAttributeV2& attribute = header.attributes[i];
+      for(uint32_t c = 0; c < components[i]; ++c)
+      {
+        *out++ = c < attribute.components ? ReadComponent(in + attribute.offset + c * GetComponentSize(attribute.format), attribute.format) : 0.0f;
+      }
+    }
+  }
+
+  model.indices.resize(header.indexCount);
+  for(uint32_t i = 0; i < header.indexCount; ++i)
+  {
+    const uint8_t* in = &bytes[header.indexDataOffset + i * header.indexSize];
+    model.indices[i]  = header.indexSize == 2u ? ReadU16(in) : ReadU32(in);
+  }
+  return true;
+}
+
+/**
+ * Expands indexed model to the plain triangle list
+ */
+void Unindex(Model& model)
+{
+  if(model.indices.empty())
+  {
+    return;
+  }
+  std::vector<Vertex> vertices;
+  vertices.reserve(model.indices.size());
+  for(uint32_t index : model.indices)
+  {
+    vertices.push_back(model.vertices[index]);
+  }
+  model.vertices.swap(vertices);
+  model.indices.clear();
+}
+
+/**
+ * Removes duplicated vertices and builds the index buffer, the model stays
+ * unindexed if there are no duplicates
+ */
+void Index(Model& model)
+{
+  Unindex(model);
+
+  std::map<Vertex, uint32_t> unique;
+  std::vector<Vertex>        vertices;
+  model.indices.reserve(model.vertices.size());
+  for(const Vertex& vertex : model.vertices)
+  {
+    auto result = unique.insert(std::make_pair(vertex, static_cast<uint32_t>(vertices.size())));
+    if(result.second)
+    {
+      vertices.push_back(vertex);
+    }
+    model.indices.push_back(result.first->second);
+  }
+
+  if(vertices.size() == model.vertices.size())
+  {
+    model.indices.clear();
+    return;
+  }
+  model.vertices.swap(vertices);
+}
+
+uint16_t FloatToHalf(float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+
+  const uint32_t sign     = (bits >> 16) & 0x8000u;
+  const int32_t  exponent = static_cast<int32_t>((bits >> 23) & 0xFFu) - 127 + 15;
+  uint32_t       mantissa = bits & 0x7FFFFFu;
+
+  if(((bits >> 23) & 0xFFu) == 0xFFu)
+  {
+    // infinity or NaN
+    return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+  }
+  if(exponent >= 0x1F)
+  {
+    // overflow, clamp to infinity
+    return static_cast<uint16_t>(sign | 0x7C00u);
+  }
+  if(exponent <= 0)
+  {
+    if(exponent < -10)
+    {
+      return static_cast<uint16_t>(sign);
+    }
+    // denormal
+    mantissa |= 0x800000u;
+    const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+    uint32_t       half  = mantissa >> shift;
+    if((mantissa >> (shift - 1)) & 1u)
+    {
+      ++half;
+    }
+    return static_cast<uint16_t>(sign | half);
+  }
+
+  // round to nearest, the carry may correctly bump the exponent
+  uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+  if(mantissa & 0x1000u)
+  {
+    ++half;
+  }
+  return static_cast<uint16_t>(half);
+}
+
+uint16_t FloatToSnorm16(float value)
+{
+  const float clamped = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+  return static_cast<uint16_t>(static_cast<int16_t>(std::lround(clamped * 32767.0f)));
+}
+
+void WriteU16(std::vector<uint8_t>& out, size_t offset, uint16_t value)
+{
+  out[offset]     = static_cast<uint8_t>(value);
+  out[offset + 1] = static_cast<uint8_t>(value >> 8);
+}
+
+void WriteU32(std::vector<uint8_t>& out, size_t offset, uint32_t value)
+{
+  for(uint32_t i = 0; i < 4; ++i)
+  {
+    out[offset + i] = static_cast<uint8_t>(value >> (i * 8));
+  }
+}
+
+void WriteF32(std::vector<uint8_t>& out, size_t offset, float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  WriteU32(out, offset, bits);
+}
+
+/**
+ * Encodes the model as version 2 file
+ */
+void EncodeVersion2(const Model& model, bool quantize, std::vector<uint8_t>& out)
+{
+  ModelHeaderV2 header;
+  memset(&header, 0, sizeof(header));
+  header.tag         = MODV_TAG;
+  header.version     = VERSION_2;
+  header.vertexCount = static_cast<uint32_t>(model.vertices.size());
+
+  header.attributes[POSITION] = {FLOAT32, 3u, 0u};
+  if(quantize)
+  {
+    // normal is padded to 8 bytes to keep texture coordinates aligned
+    header.attributes[NORMAL]   = {SNORM16, 3u, 12u};
+    header.attributes[TEXCOORD] = {FLOAT16, 2u, 20u};
+    header.vertexStride         = 24u;
+  }
+  else
+  {
+    header.attributes[NORMAL]   = {FLOAT32, 3u, 12u};
+    header.attributes[TEXCOORD] = {FLOAT32, 2u, 24u};
+    header.vertexStride         = 32u;
+  }
+
+  header.indexCount       = static_cast<uint32_t>(model.indices.size());
+  header.indexSize        = header.indexCount ? (model.vertices.size() <= 0xFFFFu ? 2u : 4u) : 0u;
+  header.vertexDataOffset = sizeof(ModelHeaderV2);
+  header.indexDataOffset  = header.indexCount ? header.vertexDataOffset + header.vertexCount * header.vertexStride : 0u;
+
+  for(uint32_t axis = 0; axis < 3; ++axis)
+  {
+    header.boundsMin[axis] = model.vertices.empty() ? 0.0f : model.vertices[0].data[axis];
+    header.boundsMax[axis] = header.boundsMin[axis];
+    for(const Vertex& vertex : model.vertices)
+    {
+      header.boundsMin[axis] = std::min(header.boundsMin[axis], vertex.data[axis]);
+      header.boundsMax[axis] = std::max(header.boundsMax[axis], vertex.data[axis]);
+    }
+  }
+
+  out.assign(header.vertexDataOffset + header.vertexCount * header.vertexStride + header.indexCount * header.indexSize, 0u);
+
+  // header consists of 32-bit fields only
+  for(size_t i = 0; i < sizeof(ModelHeaderV2) / sizeof(uint32_t); ++i)
+  {
+    uint32_t word;
+    memcpy(&word, reinterpret_cast<const uint8_t*>(&header) + i * sizeof(uint32_t), sizeof(uint32_t));
+    WriteU32(out, i * sizeof(uint32_t), word);
+  }
+
+  for(uint32_t v = 0; v < header.vertexCount; ++v)
+  {
+    const float* in     = model.vertices[v].data;
+    const size_t vertex = header.vertexDataOffset + v * header.vertexStride;
+    for(uint32_t c = 0; c < 3; ++c)
+    {
+      WriteF32(out, vertex + c * 4, in[c]);
+    }
+    if(quantize)
+    {
+      for(uint32_t c = 0; c < 3; ++c)
+      {
+        WriteU16(out, vertex + 12 + c * 2, FloatToSnorm16(in[3 + c]));
+      }
+      for(uint32_t c = 0; c < 2; ++c)
+      {
+        WriteU16(out, vertex + 20 + c * 2, FloatToHalf(in[6 + c]));
+      }
+    }
+    else
+    {
+      for(uint32_t c = 3; c < VERTEX_FLOATS; ++c)
+      {
+        WriteF32(out, vertex + c * 4, in[c]);
+      }
+    }
+  }
+
+  for(uint32_t i = 0; i < header.indexCount; ++i)
+  {
+    const size_t offset = header.indexDataOffset + i * header.indexSize;
+    if(header.indexSize == 2u)
+    {
+      WriteU16(out, offset, static_cast<uint16_t>(model.indices[i]));
+    }
+    else
+    {
+      WriteU32(out, offset, model.indices[i]);
+    }
+  }
+}
+
+bool Decode(const std::vector<uint8_t>& bytes, Model& model, uint32_t& version)
+{
+  version = VERSION_2;
+  if(DecodeVersion2(bytes, model))
+  {
+    return true;
+  }
+  version = VERSION_1;
+  return DecodeVersion1(bytes, model);
+}
+
+void PrintUsage(const char* program)
+{
+  std::cerr << "Usage: " << program << " [--index] [--quantize] <input.mod> <output.mod>\n"
+            << "       " << program << " --info <input.mod>\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  bool                     index    = false;
+  bool                     quantize = false;
+  bool                     info     = false;
+  std::vector<std::string> files;
+
+  for(int i = 1; i < argc; ++i)
+  {
+    const std::string arg(argv[i]);
+    if(arg == "--index")
+    {
+      index = true;
+    }
+    else if(arg == "--quantize")
+    {
+      quantize = true;
+    }
+    else if(arg == "--info")
+    {
+      info = true;
+    }
+    else
+    {
+      files.push_back(arg);
+    }
+  }
+
+  if(files.size() != (info ? 1u : 2u))
+  {
+    PrintUsage(argv[0]);
+    return 1;
+  }
+
+  std::vector<uint8_t> input;
+  if(!ReadFile(files[0], input))
+  {
+    std::cerr << "Failed to read " << files[0] << "\n";
+    return 1;
+  }
+
+  Model    model;
+  uint32_t version;
+  if(!Decode(input, model, version))
+  {
+    std::cerr << "Invalid model file " << files[0] << "\n";
+    return 1;
+  }
+
+  if(info)
+  {
+    std::cout << files[0] << ": version " << version << ", " << model.vertices.size() << " vertices, "
+              << model.indices.size() << " indices, " << input.size() << " bytes\n";
+    return 0;
+  }
+
+  if(index)
+  {
+    Index(model);
+  }
+  else
+  {
+    Unindex(model);
+  }
+
+  std::vector<uint8_t> output;
+  EncodeVersion2(model, quantize, output);
+
+  std::ofstream file(files[1], std::ios::binary);
+  if(!file.write(reinterpret_cast<const char*>(output.data()), output.size()))
+  {
+    std::cerr << "Failed to write " << files[1] << "\n";
+    return 1;
+  }
+
+  std::cout << files[0] << " (" << input.size() << " bytes) -> " << files[1] << " (" << output.size() << " bytes, "
+            << model.vertices.size() << " vertices, " << model.indices.size() << " indices)\n";
+  return 0;
+}